@@ -0,0 +1,95 @@
+//********************************************************************************************
+//*
+//*    This file is part of Cartman.
+//*
+//*    Cartman is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Cartman is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Cartman.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//*
+//********************************************************************************************
+
+
+/// @file cartman/VertexStore.cpp
+/// @brief The vertices of a Cartman map.
+
+#include "cartman/VertexStore.hpp"
+#include "egolib/Mesh/Info.hpp"
+
+namespace Cartman {
+
+VertexStore::VertexStore() :
+	_vertices(MAP_VERTICES_MAX), _tiles(Info<float>::Grid::Size())
+{}
+
+mpd_vertex_t& VertexStore::operator[](uint32_t ivrt) {
+	return _vertices[ivrt];
+}
+
+const mpd_vertex_t& VertexStore::operator[](uint32_t ivrt) const {
+	return _vertices[ivrt];
+}
+
+int VertexStore::allocate() {
+	uint32_t ivrt = _vertices.allocate();
+	if (decltype(_vertices)::NONE == ivrt) {
+		return -1;
+	}
+	mpd_vertex_t& vertex = _vertices[ivrt];
+	vertex.reset();
+	vertex.a = 1;
+	_tiles.set(ivrt, vertex.x, vertex.y);
+	return ivrt;
+}
+
+bool VertexStore::release(uint32_t ivrt) {
+	if (!_vertices.release(ivrt)) {
+		return false;
+	}
+	_vertices[ivrt].reset();
+	_tiles.remove(ivrt);
+	return true;
+}
+
+void VertexStore::moved(uint32_t ivrt) {
+	if (_vertices.isAllocated(ivrt)) {
+		_tiles.set(ivrt, _vertices[ivrt].x, _vertices[ivrt].y);
+	}
+}
+
+void VertexStore::clear() {
+	_vertices.clear();
+	_tiles.clear();
+}
+
+void VertexStore::resize(size_t tileCountX, size_t tileCountY) {
+	_tiles.resize(tileCountX, tileCountY);
+}
+
+uint32_t VertexStore::getFreeCount() const {
+	return _vertices.getFreeCount();
+}
+
+void VertexStore::findInBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ, std::vector<uint32_t>& result) const {
+	const size_t first = result.size();
+	_tiles.findInRect(minX, minY, maxX, maxY, result);
+	result.erase(std::remove_if(result.begin() + first, result.end(), [&](uint32_t ivrt) {
+		const mpd_vertex_t& vertex = _vertices[ivrt];
+		return !(vertex.z >= minZ && vertex.z <= maxZ);
+	}), result.end());
+}
+
+void VertexStore::findInRadius(float x, float y, float radius, std::vector<uint32_t>& result) const {
+	_tiles.findInRadius(x, y, radius, result);
+}
+
+} // namespace Cartman
@@ -0,0 +1,138 @@
+//********************************************************************************************
+//*
+//*    This file is part of Cartman.
+//*
+//*    Cartman is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Cartman is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Cartman.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//*
+//********************************************************************************************
+
+
+/// @file cartman/VertexStore.hpp
+/// @brief The vertices of a Cartman map.
+
+#pragma once
+
+#include "cartman/Vertex.hpp"
+#include "egolib/Core/ChunkedPool.hpp"
+#include "egolib/Core/GridIndex.hpp"
+#include "egolib/FileFormats/map_file.h"
+
+namespace Cartman {
+
+/**
+ * @brief
+ *	The vertices of a Cartman map, addressed by vertex index.
+ *	The vertices are stored in chunks which are allocated as the map grows,
+ *	and the used vertices are bucketed by the tile they are in.
+ * @remark
+ *	A vertex is used if and only if its basic light is not @a VERTEXUNUSED.
+ *	Call moved() whenever the x- or y-coordinate of a used vertex changed,
+ *	otherwise the rectangle and radius queries miss the vertex.
+ */
+struct VertexStore {
+private:
+	Ego::Core::ChunkedPool<mpd_vertex_t> _vertices;
+	Ego::Core::GridIndex _tiles;
+
+public:
+	/**
+	 * @brief
+	 *  Construct this store without any used vertex.
+	 */
+	VertexStore();
+
+	/**@{*/
+	/**
+	 * @brief
+	 *  Get the vertex at a vertex index.
+	 * @param ivrt
+	 *  the vertex index, must be smaller than @a MAP_VERTICES_MAX
+	 */
+	mpd_vertex_t& operator[](uint32_t ivrt);
+	const mpd_vertex_t& operator[](uint32_t ivrt) const;
+	/**@}*/
+
+	/**
+	 * @brief
+	 *  Get a free vertex and mark it as used.
+	 * @return
+	 *  the index of the vertex, @a -1 if all vertices are used
+	 * @remark
+	 *  The vertex is reset to its default values except for its basic light which is @a 1.
+	 */
+	int allocate();
+
+	/**
+	 * @brief
+	 *  Reset a vertex to its default values, which marks it as unused.
+	 * @param ivrt
+	 *  the vertex index
+	 * @return
+	 *  @a true if the vertex was used, @a false otherwise
+	 */
+	bool release(uint32_t ivrt);
+
+	/**
+	 * @brief
+	 *  Update the tile of a used vertex after it was moved.
+	 * @param ivrt
+	 *  the vertex index
+	 */
+	void moved(uint32_t ivrt);
+
+	/**
+	 * @brief
+	 *  Reset all vertices to their default values.
+	 */
+	void clear();
+
+	/**
+	 * @brief
+	 *  Set the size of the map.
+	 * @param tileCountX, tileCountY
+	 *  the number of tiles along the x- and y-axes
+	 */
+	void resize(size_t tileCountX, size_t tileCountY);
+
+	/**
+	 * @brief
+	 *  Get the number of unused vertices.
+	 */
+	uint32_t getFreeCount() const;
+
+	/**
+	 * @brief
+	 *  Find the used vertices within a box.
+	 * @param minX, minY, minZ, maxX, maxY, maxZ
+	 *  the box, including its border
+	 * @param result
+	 *  the indices of the vertices are appended to this, in ascending order
+	 */
+	void findInBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ, std::vector<uint32_t>& result) const;
+
+	/**
+	 * @brief
+	 *  Find the used vertices within a radius in the xy-plane.
+	 * @param x, y
+	 *  the center
+	 * @param radius
+	 *  the radius
+	 * @param result
+	 *  the indices of the vertices are appended to this, in ascending order
+	 */
+	void findInRadius(float x, float y, float radius, std::vector<uint32_t>& result) const;
+};
+
+} // namespace Cartman
@@ -60,9 +60,6 @@ static void cart_mouse_data_mesh_replace_fx();
 
 std::string egoboo_path = "";
 
-int     onscreen_count = 0;
-Uint32  onscreen_vert[MAXPOINTS];
-
 //--------------------------------------------------------------------------------------------
 
 static float cartman_zoom_hrz = 1.0f;
@@ -138,8 +135,6 @@ static void bound_camera( cartman_mpd_info_t * pinfo );
 static void mesh_calc_vrta( cartman_mpd_t * pmesh );
 static void fan_calc_vrta( cartman_mpd_t * pmesh, int fan );
 static int  vertex_calc_vrta( cartman_mpd_t * pmesh, Uint32 vert );
-static void make_onscreen();
-static void onscreen_add_fan( cartman_mpd_t * pmesh, Uint32 fan );
 static void ease_up_mesh( cartman_mpd_t& mesh, float zoom_vrt );
 
 // cartman versions of these functions
@@ -359,72 +354,6 @@ int cartman_get_vertex( cartman_mpd_t * pmesh, Index2D index2d, int num )
 
 //--------------------------------------------------------------------------------------------
 
-void onscreen_add_fan( cartman_mpd_t * pmesh, Uint32 fan )
-{
-    // ZZ> This function flags a fan's points as being "onscreen"
-    int cnt;
-    Uint32 vert, fan_type, vert_count;
-    cartman_mpd_tile_t * pfan;
-
-    if ( NULL == pmesh ) pmesh = &mesh;
-
-    pfan = CART_MPD_FAN_PTR( pmesh, fan );
-    if ( NULL == pfan ) return;
-
-    fan_type    = pfan->type;
-    vert_count  = tile_dict.def_lst[fan_type].numvertices;
-
-    for ( cnt = 0, vert = pfan->vrtstart;
-          cnt < vert_count && CHAINEND != vert;
-          cnt++, vert = pmesh->vrt2[vert].next )
-    {
-        if ( !CART_VALID_VERTEX_RANGE( vert ) ) break;
-
-        if ( VERTEXUNUSED == pmesh->vrt2[vert].a ) continue;
-
-        if ( onscreen_count < MAXPOINTS )
-        {
-            onscreen_vert[onscreen_count] = vert;
-            onscreen_count++;
-        }
-        else
-        {
-            break;
-        }
-    }
-}
-
-//--------------------------------------------------------------------------------------------
-
-void make_onscreen( cartman_mpd_t * pmesh )
-{
-    if ( NULL == pmesh ) pmesh = &mesh;
-
-    int mapxstt = std::floor(( cam.x - cam.w  * 0.5f ) / Info<float>::Grid::Size()) - 1.0f;
-    int mapystt = std::floor(( cam.y - cam.h  * 0.5f ) / Info<float>::Grid::Size()) - 1.0f;
-
-    int mapxend = std::ceil(( cam.x + cam.w  * 0.5f ) / Info<float>::Grid::Size()) + 1.0f;
-    int mapyend = std::ceil(( cam.y + cam.h  * 0.5f ) / Info<float>::Grid::Size()) + 1.0f;
-
-    onscreen_count = 0;
-    for (int mapy = mapystt; mapy <= mapyend; mapy++ )
-    {
-        if ( mapy < 0 || mapy >= pmesh->info.getTileCountY() ) continue;
-
-        for (int mapx = mapxstt; mapx <= mapxend; mapx++ )
-        {
-            if ( mapx < 0 || mapx >= pmesh->info.getTileCountX() ) continue;
-
-            int fan = pmesh->get_ifan({mapx, mapy});
-            if ( !VALID_MPD_TILE_RANGE( fan ) ) continue;
-
-            onscreen_add_fan( pmesh, fan );
-        }
-    }
-}
-
-//--------------------------------------------------------------------------------------------
-
 void gfx_system_load_basic_textures( const std::string& modname )
 {
     // ZZ> This function loads the standard textures for a module
@@ -505,8 +434,6 @@ void Cartman::Gui::Window::render()
         renderer.setScissorRectangle(position.x(), drawableSize.height() - ( position.y() + size.height() ),
                                      size.width(), size.height());
 
-        make_onscreen( pmesh );
-
         if ( HAS_BITS( mode, WINMODE_TILE ) )
         {
             Views::tileView.render( *this, cartman_zoom_hrz, cartman_zoom_vrt );
@@ -1228,7 +1155,7 @@ void cartman_check_mouse_vertex(std::shared_ptr<Cartman::Gui::Window> pwin, floa
 
         if (CART_KEYDOWN(SDLK_p) || (CART_BUTTONDOWN(SDL_BUTTON_RIGHT) && 0 == mdata.win_select.count()))
         {
-            MeshEditor::raise_mesh( mdata.win_mesh != nullptr ? *mdata.win_mesh : mesh, onscreen_vert, onscreen_count, mdata.win_mpos_x, mdata.win_mpos_y, brushamount, brushsize );
+            MeshEditor::raise_mesh( mdata.win_mesh != nullptr ? *mdata.win_mesh : mesh, mdata.win_mpos_x, mdata.win_mpos_y, brushamount, brushsize );
         }
     }
 }
@@ -1619,7 +1546,7 @@ void draw_lotsa_stuff( cartman_mpd_t * pmesh )
     gfx_font_ptr->drawText("S = Slippy", 0, y); y -= step;
 
     // Vertices left
-    gfx_font_ptr->drawText("Vertices " + std::to_string(pmesh->vrt_free), 0, y); y -= step;
+    gfx_font_ptr->drawText("Vertices " + std::to_string(pmesh->vrt2.getFreeCount()), 0, y); y -= step;
 
     // Misc data
     gfx_font_ptr->drawText("Ambient   " + std::to_string(ambi), 0, y); y -= step;
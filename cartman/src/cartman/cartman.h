@@ -48,13 +48,8 @@
 //#define ONSIZE 600            // Max size of raise mesh
 #define ONSIZE 264          // Max size of raise mesh
 
-#define MAXPOINTS 20480         // Max number of points to draw
-
 //--------------------------------------------------------------------------------------------
 
 extern std::string egoboo_path;
 
-extern int     onscreen_count;
-extern Uint32  onscreen_vert[MAXPOINTS];
-
 //--------------------------------------------------------------------------------------------
@@ -450,6 +450,7 @@ int select_lst_add_fan_vertex( select_lst_t& plst, Index2D index2d, int grid_ix,
                 pvrt->x = vtmp[kX];
                 pvrt->y = vtmp[kY];
                 pvrt->z = vtmp[kZ];
+                plst.get_mesh()->vrt2.moved(ivrt);
             }
         }
     }
@@ -565,8 +566,6 @@ void select_lst_add_rect( select_lst_t& plst, const Vector3f& a, const Vector3f&
 {
     // ZZ> This function checks the rectangular selection
 
-    Uint32 ivrt;
-
     float xmin, ymin, zmin;
     float xmax, ymax, zmax;
 
@@ -584,35 +583,14 @@ void select_lst_add_rect( select_lst_t& plst, const Vector3f& a, const Vector3f&
     std::tie(ymin, ymax) = std::minmax(a.y(), b.y());
     std::tie(zmin, zmax) = std::minmax(a.z(), b.z());
 
-    if ( mode == WINMODE_VERTEX )
-    {
-        for ( ivrt = 0; ivrt < MAP_VERTICES_MAX; ivrt++)
-        {
-            Cartman::mpd_vertex_t& pvrt = pmesh->vrt2[ivrt];
-            if (VERTEXUNUSED == pvrt.a) continue;
-
-            
-            if (pvrt.x >= xmin && pvrt.x <= xmax &&
-                pvrt.y >= ymin && pvrt.y <= ymax &&
-                pvrt.z >= zmin && pvrt.z <= zmax)
-            {
-                plst.add( ivrt );
-            }
-        }
-    }
-    else if ( mode == WINMODE_SIDE )
+    if ( mode == WINMODE_VERTEX || mode == WINMODE_SIDE )
     {
-        for (ivrt = 0; ivrt < MAP_VERTICES_MAX; ivrt++)
+        // the vertices are found in ascending order, as by a scan of all vertices
+        std::vector<uint32_t> found;
+        pmesh->vrt2.findInBox(xmin, ymin, zmin, xmax, ymax, zmax, found);
+        for (uint32_t ivrt : found)
         {
-            Cartman::mpd_vertex_t& pvrt = pmesh->vrt2[ivrt];
-            if (VERTEXUNUSED == pvrt.a) continue;
-
-            if (pvrt.x >= xmin && pvrt.x <= xmax &&
-                pvrt.y >= ymin && pvrt.y <= ymax &&
-                pvrt.z >= zmin && pvrt.z <= zmax )
-            {
-                plst.add( ivrt );
-            }
+            plst.add( ivrt );
         }
     }
 }
@@ -637,36 +615,13 @@ void select_lst_remove_rect( select_lst_t& plst, const Vector3f& a, const Vector
     std::tie(ymin, ymax) = std::minmax(a.y(), b.y());
     std::tie(zmin, zmax) = std::minmax(a.z(), b.z());
 
-    if ( mode == WINMODE_VERTEX )
-    {
-		Uint32 ivrt;
-        for ( ivrt = 0; ivrt < MAP_VERTICES_MAX; ivrt++)
-        {
-            Cartman::mpd_vertex_t& pvrt = pmesh->vrt2[ivrt];
-            if ( VERTEXUNUSED == pvrt.a ) continue;
-
-            if ( pvrt.x >= xmin && pvrt.x <= xmax &&
-                 pvrt.y >= ymin && pvrt.y <= ymax &&
-                 pvrt.z >= zmin && pvrt.z <= zmax )
-            {
-                plst.remove( ivrt );
-            }
-        }
-    }
-    else if ( mode == WINMODE_SIDE )
+    if ( mode == WINMODE_VERTEX || mode == WINMODE_SIDE )
     {
-		Uint32 ivrt;
-        for ( ivrt = 0; ivrt < MAP_VERTICES_MAX; ivrt++)
+        std::vector<uint32_t> found;
+        pmesh->vrt2.findInBox(xmin, ymin, zmin, xmax, ymax, zmax, found);
+        for (uint32_t ivrt : found)
         {
-            Cartman::mpd_vertex_t& pvrt = pmesh->vrt2[ivrt];
-            if ( VERTEXUNUSED == pvrt.a ) continue;
-
-            if ( pvrt.x >= xmin && pvrt.x <= xmax &&
-                 pvrt.y >= ymin && pvrt.y <= ymax &&
-                 pvrt.z >= zmin && pvrt.z <= zmax )
-            {
-                plst.remove( ivrt );
-            }
+            plst.remove( ivrt );
         }
     }
 }
@@ -766,6 +721,7 @@ void mesh_select_move( select_lst_t& plst, float x, float y, float z )
         pmesh->vrt2[ivrt].x = newx;
         pmesh->vrt2[ivrt].y = newy;
         pmesh->vrt2[ivrt].z = newz;
+        pmesh->vrt2.moved(ivrt);
     }
 }
 
@@ -824,13 +780,10 @@ void mesh_select_verts_connected(select_lst_t& plst) {
                   cnt < pdef->numvertices;
                   cnt++, vert = pmesh->vrt2[vert].next)
             {
-                for ( int tnc = 0; tnc < plst.count(); tnc++ )
+                if ( CART_VALID_VERTEX_RANGE( vert ) && -1 != plst.find( vert ) )
                 {
-                    if ( select_lst_t::at(plst,tnc) == vert )
-                    {
-                        select_vertsfan = true;
-                        break;
-                    }
+                    select_vertsfan = true;
+                    break;
                 }
             }
 
@@ -898,6 +851,7 @@ void mesh_select_weld(select_lst_t& plst)
             pmesh->vrt2[vertex].y = avg_y;
             pmesh->vrt2[vertex].z = avg_z;
             pmesh->vrt2[vertex].a = Ego::Math::constrain(avg_a, 1.0f, 255.0f);
+            pmesh->vrt2.moved(vertex);
         }
     }
 }
@@ -984,18 +938,20 @@ void MeshEditor::move_vert( cartman_mpd_t& mesh, int vert, float x, float y, flo
     mesh.vrt2[vert].x = newx;
     mesh.vrt2[vert].y = newy;
     mesh.vrt2[vert].z = newz;
+    mesh.vrt2.moved(vert);
 }
 
 //--------------------------------------------------------------------------------------------
-void MeshEditor::raise_mesh( cartman_mpd_t& mesh, Uint32 point_lst[], size_t point_cnt, float x, float y, int amount, int size )
+void MeshEditor::raise_mesh( cartman_mpd_t& mesh, float x, float y, int amount, int size )
 {
-    if ( NULL == point_lst || 0 == point_cnt ) return;
+    if ( 0 == amount || size <= 0 ) return;
 
-    for ( size_t cnt = 0; cnt < point_cnt; cnt++ )
-    {
-        Uint32 vert = point_lst[cnt];
-        if ( !CART_VALID_VERTEX_RANGE( vert ) ) break;
+    // vertices farther away than this are not moved
+    std::vector<uint32_t> point_lst;
+    mesh.vrt2.findInRadius( x, y, std::abs( amount ) * size * 0.5f, point_lst );
 
+    for ( Uint32 vert : point_lst )
+    {
         float disx = mesh.vrt2[vert].x - x;
         float disy = mesh.vrt2[vert].y - y;
         float dis  = std::sqrt( disx * disx + disy * disy );
@@ -1704,21 +1660,25 @@ void MeshEditor::mesh_replace_tile(cartman_mpd_t& mesh, int _xfan, int _yfan, in
             mesh.vrt2[vert].x = pos[CORNER_TL][kX];
             mesh.vrt2[vert].y = pos[CORNER_TL][kY];
             mesh.vrt2[vert].z = pos[CORNER_TL][kZ];
+            mesh.vrt2.moved(vert);
 
             vert = mesh.vrt2[vert].next;
             mesh.vrt2[vert].x = pos[CORNER_TR][kX];
             mesh.vrt2[vert].y = pos[CORNER_TR][kY];
             mesh.vrt2[vert].z = pos[CORNER_TR][kZ];
+            mesh.vrt2.moved(vert);
 
             vert = mesh.vrt2[vert].next;
             mesh.vrt2[vert].x = pos[CORNER_BR][kX];
             mesh.vrt2[vert].y = pos[CORNER_BR][kY];
             mesh.vrt2[vert].z = pos[CORNER_BR][kZ];
+            mesh.vrt2.moved(vert);
 
             vert = mesh.vrt2[vert].next;
             mesh.vrt2[vert].x = pos[CORNER_BL][kX];
             mesh.vrt2[vert].y = pos[CORNER_BL][kY];
             mesh.vrt2[vert].z = pos[CORNER_BL][kZ];
+            mesh.vrt2.moved(vert);
         }
     }
 }
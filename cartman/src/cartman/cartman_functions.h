@@ -73,7 +73,7 @@ struct MeshEditor {
 	static void mesh_set_tile(cartman_mpd_t& mesh, Uint16 tiletoset, Uint8 upper, Uint16 presser, Uint8 tx);
 	static void move_mesh_z(cartman_mpd_t& mesh, int z, Uint16 tiletype, Uint16 tileand);
 	static void move_vert(cartman_mpd_t& mesh, int vert, float x, float y, float z);
-	static void raise_mesh(cartman_mpd_t& mesh, Uint32 point_lst[], size_t point_count, float x, float y, int amount, int size);
+	static void raise_mesh(cartman_mpd_t& mesh, float x, float y, int amount, int size);
 	static void level_vrtz(cartman_mpd_t& mesh);
 	static void jitter_mesh(cartman_mpd_t& mesh);
 	static void flatten_mesh(cartman_mpd_t& mesh, int y0);
@@ -61,7 +61,7 @@ Uint8 cartman_mpd_calc_twist( int dx, int dy )
 //--------------------------------------------------------------------------------------------
 
 cartman_mpd_t::cartman_mpd_t() :
-    vrt2(), vrt_free(MAP_VERTICES_MAX), vrt_at(0), info(),
+    vrt2(), info(),
     fan2(), fanstart2()
 {
 }
@@ -72,12 +72,7 @@ cartman_mpd_t::~cartman_mpd_t()
 
 cartman_mpd_t *cartman_mpd_t::reset()
 {
-    for (auto& e : vrt2)
-    {
-        e.reset();
-    }
-    vrt_free = MAP_VERTICES_MAX;
-    vrt_at = 0;
+    vrt2.clear();
 
     info.reset();
 
@@ -232,20 +227,6 @@ Cartman::mpd_vertex_t * cartman_mpd_t::get_pvrt_idx( cartman_mpd_t * pmesh, cart
     return pvrt;
 }
 
-void cartman_mpd_t::free_vertex_count()
-{
-    int num = 0;
-    for (auto& e : vrt2)
-    {
-        if (VERTEXUNUSED == e.a)
-        {
-            num++;
-        }
-    }
-
-    vrt_free = num;
-}
-
 int cartman_mpd_t::count_used_vertices()
 {
     int totalvert = 0;
@@ -276,14 +257,7 @@ void cartman_mpd_free_vertices(cartman_mpd_t *self)
     {
         self = &mesh; /// @todo Bad!
     }
-    for (size_t i = 0; i < MAP_VERTICES_MAX; ++i)
-    {
-        self->vrt2[i].a = VERTEXUNUSED;
-        self->vrt2[i].next = CHAINEND;
-    }
-
-    self->vrt_at = 0;
-    self->vrt_free = MAP_VERTICES_MAX;
+    self->vrt2.clear();
 }
 
 Cartman::mpd_vertex_t *cartman_mpd_t::get_vertex(int ivrt)
@@ -327,31 +301,7 @@ bool cartman_mpd_link_vertex(cartman_mpd_t *self, int iparent, int ichild)
 
 int cartman_mpd_t::find_free_vertex()
 {
-    if (vrt_free <= 0)
-    {
-        return -1;
-    }
-
-    for (int cnt = 0;
-         cnt < MAP_VERTICES_MAX && VERTEXUNUSED != vrt2[vrt_at].a;
-         cnt++)
-    {
-        vrt_at++;
-
-        if (!CART_VALID_VERTEX_RANGE(vrt_at))
-        {
-            vrt_at = 0;
-        }
-    }
-
-    bool found = false;
-    if (VERTEXUNUSED == vrt2[vrt_at].a)
-    {
-        vrt2[vrt_at].a = 1;
-        found = true;
-    }
-
-    return found ? vrt_at : -1;
+    return vrt2.allocate();
 }
 
 Uint8 cartman_mpd_get_fan_twist( cartman_mpd_t * pmesh, Uint32 fan )
@@ -449,8 +399,7 @@ int cartman_mpd_free_vertex_list(cartman_mpd_t *self, int list[], size_t size)
         {
             break;
         }
-        self->vrt2[ivrt].a = VERTEXUNUSED;
-        self->vrt2[ivrt].next = CHAINEND;
+        self->vrt2.release(ivrt);
     }
     return size;
 }
@@ -459,7 +408,6 @@ int cartman_mpd_allocate_vertex_list(cartman_mpd_t * pmesh, int list[], size_t s
 {
 	size_t cnt, valid_verts;
 	int allocated = 0;
-    Uint32 vrt_at_old = 0, vrt_free_old = MAP_VERTICES_MAX;
 
     bool alloc_error = false;
 
@@ -471,8 +419,6 @@ int cartman_mpd_allocate_vertex_list(cartman_mpd_t * pmesh, int list[], size_t s
 
     // grab the mesh
     if ( NULL == pmesh ) pmesh = &mesh;
-    vrt_at_old   = pmesh->vrt_at;
-    vrt_free_old = pmesh->vrt_free;
 
     // try to allocate the vertices
     alloc_error = false;
@@ -492,11 +438,9 @@ int cartman_mpd_allocate_vertex_list(cartman_mpd_t * pmesh, int list[], size_t s
     if ( alloc_error )
     {
         // reset the pmesh memory
-        pmesh->vrt_at   = vrt_at_old;
-        pmesh->vrt_free = vrt_free_old;
         for ( cnt = 0; cnt < valid_verts; cnt++ )
         {
-            pmesh->vrt2[list[cnt]].reset();
+            pmesh->vrt2.release(list[cnt]);
         }
 
         // tell the caller we failed
@@ -507,9 +451,6 @@ int cartman_mpd_allocate_vertex_list(cartman_mpd_t * pmesh, int list[], size_t s
     {
         int parent, child;
 
-        // allocated all the vertices, so adjust the free count
-        pmesh->vrt_free -= valid_verts;
-
         // finish the list
         list[cnt] = CHAINEND;
 
@@ -645,6 +586,7 @@ int cartman_mpd_t::add_pfan(cartman_mpd_tile_t *pfan, float x, float y)
         pvrt->x = x + GRID_TO_POS( pdef->vertices[cnt].grid_ix );
         pvrt->y = y + GRID_TO_POS( pdef->vertices[cnt].grid_iy );
         pvrt->z = 0.0f;
+        vrt2.moved(vertex);
     }
 
     return pfan->vrtstart;
@@ -666,10 +608,12 @@ void cartman_mpd_t::remove_pfan(cartman_mpd_tile_t *pfan)
 
     for (int cnt = 0, vert = pfan->vrtstart;
          cnt < numvert && CHAINEND != vert;
-         cnt++, vert = this->vrt2[vert].next )
+         cnt++)
     {
-        this->vrt2[vert].a = VERTEXUNUSED;
-        this->vrt_free++;
+        // Releasing the vertex resets its link to the next vertex.
+        Uint32 next = this->vrt2[vert].next;
+        this->vrt2.release(vert);
+        vert = next;
     }
 
     pfan->type     = 0;
@@ -747,6 +691,7 @@ cartman_mpd_t * cartman_mpd_convert(cartman_mpd_t *dst, map_t *src)
 
     // set up the destination mesh from the source mesh
     dst->info = cartman_mpd_info_t(info_src.getVertexCount(), info_src.getTileCountX(), info_src.getTileCountY());
+    dst->vrt2.resize(dst->info.getTileCountX(), dst->info.getTileCountY());
 
     // copy all the per-tile info
     for (int itile_src = 0; itile_src < dst->info.getTileCount(); itile_src++ )
@@ -827,6 +772,7 @@ cartman_mpd_t * cartman_mpd_convert(cartman_mpd_t *dst, map_t *src)
             pvrt_dst->y = pvrt_src.pos[kY];
             pvrt_dst->z = pvrt_src.pos[kZ];
             pvrt_dst->a = std::max(pvrt_src.a, (Uint8)(VERTEXUNUSED+1));  // force a != VERTEXUNUSED
+            dst->vrt2.moved(ivrt_dst);
         };
     }
 
@@ -1071,6 +1017,7 @@ cartman_mpd_t *cartman_mpd_create(cartman_mpd_t *self, int tiles_x, int tiles_y)
     cartman_mpd_free_vertices(self);
 
 	self->info = cartman_mpd_info_t(tiles_x, tiles_y);
+    self->vrt2.resize(tiles_x, tiles_y);
 
     int fan = 0;
     for (auto it = self->info.begin(); it != self->info.end(); ++it) {
@@ -19,7 +19,7 @@
 
 #pragma once
 
-#include "cartman/Vertex.hpp"
+#include "cartman/VertexStore.hpp"
 #include "cartman/cartman_typedef.h"
 #include "cartman/Tile.hpp"
 #include "egolib/FileFormats/map_tile_dictionary.h"
@@ -193,13 +193,11 @@ struct cartman_mpd_t
 {
     /**
      * @brief
-     *  The number of free vertices.
-     * @default
-     *  <tt>MAP_VERTICES_MAX</tt>
+     *  The vertices.
+     * @remark
+     *  Call <tt>vrt2.moved(ivrt)</tt> after changing the x- or y-coordinate of a used vertex.
      */
-    Uint32 vrt_free;
-    Uint32 vrt_at;                          // Current vertex check for new
-    std::array<Cartman::mpd_vertex_t, MAP_VERTICES_MAX> vrt2;
+    Cartman::VertexStore vrt2;
 
     cartman_mpd_info_t   info;
     std::array<cartman_mpd_tile_t,MAP_TILE_MAX> fan2;
@@ -319,7 +317,7 @@ struct cartman_mpd_t
 
     /**
      * @brief
-     *  Get the index of a free vertex.
+     *  Get the index of a free vertex and mark the vertex as used.
      * @return
      *  the index of a free vertex, @a -1 if none was found
      */
@@ -418,13 +416,6 @@ public:
      *  the number of used vertices.
      */
     int count_used_vertices();
-
-protected:
-    /**
-     * @brief
-     *  Re-count unused vertices and update self->vrt_free.
-     */
-    void free_vertex_count();
 };
 
 
@@ -36,9 +36,6 @@ select_lst_t& select_lst_default()
 
 void select_lst_t::init(cartman_mpd_t *pmesh)
 {
-    // get proper mesh
-    if (!pmesh) pmesh = &mesh;
-
     // clear the list
     clear();
 
@@ -50,6 +47,7 @@ void select_lst_t::clear()
 {
     _count = 0;
     _which[0] = CHAINEND;
+    _positions.clear();
 }
 
 bool select_lst_t::add(int vertex)
@@ -65,13 +63,19 @@ bool select_lst_t::add(int vertex)
 		// The vertex is already in the list. => Do nothing and return false.
 		return false;
 	}
+	else if (_count >= MAXSELECT)
+	{
+		// The list is full. => Do nothing and return false.
+		return false;
+	}
 	else
 	{
 		// The vertex index is not in the list. => Append it and return true.
         _which[_count] = vertex;
+        _positions[vertex] = _count;
         _count++;
 
-        if (_count < MAP_VERTICES_MAX)
+        if (_count < MAXSELECT)
         {
 			_which[_count] = CHAINEND;
         }
@@ -90,19 +94,18 @@ bool select_lst_t::remove(int vertex)
 	else
 	{
         // The vertex is in the list. => Remove it and return true.
-        if (_count > 1 )
+        _positions.erase(vertex);
+        for (size_t i = index; i + 1 < _count; ++i)
         {
-            for (int i = index; i < _count - 1; ++i)
-            {
-				_which[i] = _which[i-1];
-            }
+			_which[i] = _which[i+1];
+            _positions[_which[i]] = i;
         }
 
-        // blank out the last vertex
-		_which[_count] = CHAINEND;
-
         // shorten the chain
         _count--;
+
+        // blank out the last vertex
+		_which[_count] = CHAINEND;
 		return true;
     }
 }
@@ -113,32 +116,22 @@ int select_lst_t::find(int vertex) const
 		throw Id::RuntimeErrorException(__FILE__, __LINE__, "vertex index out of bounds");
 	}
 
-    for (int i = 0; i < _count; ++i)
-    {
-        if (vertex == _which[i])
-        {
-            return i;
-        }
-    }
-
-    return -1;
+    auto it = _positions.find(vertex);
+    return _positions.end() != it ? static_cast<int>(it->second) : -1;
 }
 
 int select_lst_t::count() const
 {
-    return _count;
+    return static_cast<int>(_count);
 }
 
 void select_lst_t::synch_mesh(cartman_mpd_t *pmesh)
 {
     if ( NULL == _pmesh ) _pmesh = pmesh;
-    if ( NULL == _pmesh ) _pmesh = &mesh;
 }
 
 void select_lst_t::set_mesh( cartman_mpd_t *pmesh )
 {
-    if (!pmesh) pmesh = &mesh;
-
     if (_pmesh != pmesh)
     {
         init(pmesh);
@@ -31,13 +31,15 @@ struct select_lst_t
 private:
 	/// The mesh to to which the selection applies.
     cartman_mpd_t *_pmesh;
-	/// The actualnumber of points selected.
-    int _count;
+	/// The actual number of points selected.
+    size_t _count;
 	/// An array of indices of selected points.
     uint32_t _which[MAXSELECT];
+	/// Maps the indices of the selected points to their indices in @a _which.
+	std::unordered_map<uint32_t, size_t> _positions;
 public:
 	select_lst_t()
-		: _pmesh(nullptr), _count(0), _which{ CHAINEND } {
+		: _pmesh(nullptr), _count(0), _which{ CHAINEND }, _positions() {
 	}
 	static int at(select_lst_t& self, int index) {
 		if (index < 0 || index >= self.count()) {
@@ -46,6 +48,12 @@ public:
 		return self._which[index];
 	}
 
+	/**
+	 * @brief
+	 *  Clear this selection list and attach it to a mesh.
+	 * @param pmesh
+	 *  a pointer to the mesh or a null pointer
+	 */
 	void init(cartman_mpd_t *pmesh);
 	/**
 	 * @brief
@@ -58,7 +66,7 @@ public:
 	 * @param vertex
 	 *  the index of the vertex
 	 * @return
-	 *  @a true if the vertex was not in the list,
+	 *  @a true if the vertex was not in the list and the list was not full,
 	 *  @a false otherwise
 	 */
 	bool add(int vertex);
@@ -89,6 +97,12 @@ public:
 	 */
 	int count() const;
 
+	/**
+	 * @brief
+	 *  Attach this selection list to a mesh if it is not attached to a mesh.
+	 * @param mesh
+	 *  a pointer to the mesh or a null pointer
+	 */
 	void synch_mesh(cartman_mpd_t *mesh);
 	/**
 	 * @brief
@@ -0,0 +1,91 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoTest/EgoTest.hpp"
+#include "cartman/cartman_select.h"
+#include "cartman/cartman_map.h"
+
+namespace Ego {
+namespace Test {
+
+EgoTest_TestCase(Selection) {
+
+    EgoTest_Test(add) {
+        select_lst_t selection;
+        EgoTest_Assert(selection.add(7));
+        EgoTest_Assert(selection.add(3));
+        // Adding a selected vertex again does nothing.
+        EgoTest_Assert(!selection.add(7));
+        EgoTest_Assert(2 == selection.count());
+        EgoTest_Assert(7 == select_lst_t::at(selection, 0));
+        EgoTest_Assert(3 == select_lst_t::at(selection, 1));
+    }
+
+    EgoTest_Test(addToFull) {
+        select_lst_t selection;
+        for (size_t i = 0; i < select_lst_t::MAXSELECT; ++i) {
+            EgoTest_Assert(selection.add(i));
+        }
+        EgoTest_Assert(!selection.add(select_lst_t::MAXSELECT));
+        EgoTest_Assert(-1 == selection.find(select_lst_t::MAXSELECT));
+        EgoTest_Assert(select_lst_t::MAXSELECT == static_cast<size_t>(selection.count()));
+    }
+
+    EgoTest_Test(remove) {
+        select_lst_t selection;
+        for (int vertex : {10, 20, 30, 40}) {
+            selection.add(vertex);
+        }
+        EgoTest_Assert(selection.remove(20));
+        EgoTest_Assert(!selection.remove(20));
+        // The vertices after the removed one move up.
+        EgoTest_Assert(3 == selection.count());
+        EgoTest_Assert(0 == selection.find(10));
+        EgoTest_Assert(1 == selection.find(30));
+        EgoTest_Assert(2 == selection.find(40));
+        EgoTest_Assert(40 == select_lst_t::at(selection, 2));
+        // A removed vertex can be added again, at the end.
+        EgoTest_Assert(selection.add(20));
+        EgoTest_Assert(3 == selection.find(20));
+    }
+
+    EgoTest_Test(find) {
+        select_lst_t selection;
+        EgoTest_Assert(-1 == selection.find(5));
+        selection.add(5);
+        EgoTest_Assert(0 == selection.find(5));
+        selection.clear();
+        EgoTest_Assert(-1 == selection.find(5));
+        EgoTest_Assert(0 == selection.count());
+    }
+
+    EgoTest_Test(findInvalidVertex) {
+        select_lst_t selection;
+        bool thrown = false;
+        try {
+            selection.find(MAP_VERTICES_MAX);
+        } catch (const Id::RuntimeErrorException&) {
+            thrown = true;
+        }
+        EgoTest_Assert(thrown);
+    }
+};
+
+} // namespace Test
+} // namespace Ego
@@ -0,0 +1,67 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Bench {
+
+EgoBench_BenchCase(BoundingBox) {
+    static constexpr size_t NUMBER_OF_BOXES = 256;
+
+    std::vector<oct_bb_t> _boxes;
+
+    static oct_bb_t aRandomBox() {
+        Vector3f position(Random::nextFloat() * 1024.0f, Random::nextFloat() * 1024.0f, Random::nextFloat() * 256.0f);
+        Vector3f size(16.0f + Random::nextFloat() * 128.0f, 16.0f + Random::nextFloat() * 128.0f, 16.0f + Random::nextFloat() * 64.0f);
+        oct_bb_t box = oct_bb_t(oct_vec_v2_t(position));
+        box.join(oct_vec_v2_t(position + size));
+        return box;
+    }
+
+    EgoBench_SetUpBench() {
+        _boxes.clear();
+        for (size_t i = 0; i < NUMBER_OF_BOXES; ++i) {
+            _boxes.push_back(aRandomBox());
+        }
+    }
+
+    EgoBench_Bench(intersection) {
+        size_t i = 0;
+        while (state.keepRunning()) {
+            oct_bb_t box = oct_bb_t::intersection(_boxes[i % NUMBER_OF_BOXES], _boxes[(i + 7) % NUMBER_OF_BOXES]);
+            EgoBench::doNotOptimize(box);
+            ++i;
+        }
+    }
+
+    EgoBench_Bench(cut) {
+        size_t i = 0;
+        while (state.keepRunning()) {
+            oct_bb_t box = _boxes[i % NUMBER_OF_BOXES];
+            box.cut(_boxes[(i + 7) % NUMBER_OF_BOXES]);
+            EgoBench::doNotOptimize(box);
+            ++i;
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
@@ -0,0 +1,66 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Bench {
+
+EgoBench_BenchCase(Math) {
+    static constexpr size_t NUMBER_OF_MATRICES = 256;
+
+    std::vector<Matrix4f4f> _matrices;
+    std::vector<Vector4f> _vectors;
+
+    EgoBench_SetUpBench() {
+        _matrices.resize(NUMBER_OF_MATRICES);
+        _vectors.resize(NUMBER_OF_MATRICES);
+        for (size_t i = 0; i < NUMBER_OF_MATRICES; ++i) {
+            for (size_t r = 0; r < 4; ++r) {
+                for (size_t c = 0; c < 4; ++c) {
+                    _matrices[i](r, c) = Random::nextFloat();
+                }
+            }
+            _vectors[i] = Vector4f(Random::nextFloat(), Random::nextFloat(), Random::nextFloat(), 1.0f);
+        }
+    }
+
+    EgoBench_Bench(matrixMultiply) {
+        size_t i = 0;
+        while (state.keepRunning()) {
+            Matrix4f4f m = _matrices[i % NUMBER_OF_MATRICES] * _matrices[(i + 1) % NUMBER_OF_MATRICES];
+            EgoBench::doNotOptimize(m);
+            ++i;
+        }
+    }
+
+    EgoBench_Bench(matrixTransform) {
+        size_t i = 0;
+        while (state.keepRunning()) {
+            Vector4f v;
+            Utilities::transform(_matrices[i % NUMBER_OF_MATRICES], _vectors[i % NUMBER_OF_MATRICES], v);
+            EgoBench::doNotOptimize(v);
+            ++i;
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
@@ -0,0 +1,80 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Bench {
+
+EgoBench_BenchCase(QuadTree) {
+    class QuadTreeElement {
+    public:
+        QuadTreeElement(float x, float y, float size) : _bounds(Point2f(x - size, y - size), Point2f(x + size, y + size)) {
+            //ctor
+        }
+
+        AxisAlignedBox2f& getAxisAlignedBox2D() { return _bounds; }
+
+        bool isTerminated() { return false; }
+
+    private:
+        AxisAlignedBox2f _bounds;
+    };
+
+    static constexpr size_t NUMBER_OF_ELEMENTS = 512;
+    static constexpr float WORLD_SIZE = 4096.0f;
+
+    std::vector<std::shared_ptr<QuadTreeElement>> _elements;
+    Ego::QuadTree<QuadTreeElement> _quadTree;
+
+    EgoBench_SetUpBench() {
+        _elements.clear();
+        for (size_t i = 0; i < NUMBER_OF_ELEMENTS; ++i) {
+            _elements.push_back(std::make_shared<QuadTreeElement>(Random::nextFloat() * WORLD_SIZE, Random::nextFloat() * WORLD_SIZE, 8.0f + Random::nextFloat() * 56.0f));
+        }
+        _quadTree.clear(0, 0, WORLD_SIZE, WORLD_SIZE);
+        for (const auto& element : _elements) {
+            _quadTree.insert(element);
+        }
+    }
+
+    EgoBench_Bench(rebuild) {
+        while (state.keepRunning()) {
+            _quadTree.clear(0, 0, WORLD_SIZE, WORLD_SIZE);
+            for (const auto& element : _elements) {
+                _quadTree.insert(element);
+            }
+        }
+    }
+
+    EgoBench_Bench(find) {
+        std::vector<std::shared_ptr<QuadTreeElement>> result;
+        size_t i = 0;
+        while (state.keepRunning()) {
+            const auto& center = _elements[i++ % _elements.size()]->getAxisAlignedBox2D().getCenter();
+            result.clear();
+            _quadTree.find(AxisAlignedBox2f(center - Vector2f(256.0f, 256.0f), center + Vector2f(256.0f, 256.0f)), result);
+            EgoBench::doNotOptimize(result.size());
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
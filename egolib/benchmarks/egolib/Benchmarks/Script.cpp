@@ -0,0 +1,47 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+#include "egolib/Script/script.h"
+
+namespace Ego {
+namespace Bench {
+
+/// Benchmarks of the value types of the script interpreter.
+/// The interpreter itself (script_state_t::run_operation() and run_function_call()) is not timed:
+/// running a compiled script needs a loaded GameModule and its objects.
+EgoBench_BenchCase(Script) {
+    static constexpr size_t NUMBER_OF_OPERANDS = 1024;
+
+    EgoBench_Bench(taggedValues) {
+        using namespace Ego::Script::Interpreter;
+        while (state.keepRunning()) {
+            IntegerValue sum = 0;
+            for (size_t i = 0; i < NUMBER_OF_OPERANDS; ++i) {
+                TaggedValue value(static_cast<IntegerValue>(i));
+                sum += static_cast<IntegerValue>(value);
+            }
+            EgoBench::doNotOptimize(sum);
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
@@ -0,0 +1,77 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Bench {
+
+/// Benchmarks of reading a data.txt sized file with ReadContext and with the in-place tokenizer.
+/// Each iteration reads one file, so the time per iteration is the load time per file.
+EgoBench_BenchCase(Tokenizer) {
+    static constexpr size_t NUMBER_OF_ENTRIES = 200;
+
+    std::string _file;
+
+    EgoBench_SetUpBench() {
+        _file = "// Generated data file\n";
+        for (size_t i = 0; i < NUMBER_OF_ENTRIES; ++i) {
+            switch (i % 5) {
+                case 0: _file += "Integer value     : " + std::to_string(i) + "\n"; break;
+                case 1: _file += "Real value        : " + std::to_string(i) + ".25\n"; break;
+                case 2: _file += "Range value       : 1-" + std::to_string(i) + "\n"; break;
+                case 3: _file += "Boolean value     : TRUE\n"; break;
+                case 4: _file += "IDSZ value        : [ABCD]\n"; break;
+            }
+        }
+    }
+
+    template <typename Context>
+    static float readFile(Context& ctxt) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < NUMBER_OF_ENTRIES; ++i) {
+            switch (i % 5) {
+                case 0: sum += vfs_get_next_int(ctxt); break;
+                case 1: sum += vfs_get_next_float(ctxt); break;
+                case 2: sum += vfs_get_next_range(ctxt).getUpperbound(); break;
+                case 3: sum += vfs_get_next_bool(ctxt) ? 1.0f : 0.0f; break;
+                case 4: sum += vfs_get_next_idsz(ctxt).toUint32() & 0xFF; break;
+            }
+        }
+        return sum;
+    }
+
+    EgoBench_Bench(readContext) {
+        while (state.keepRunning()) {
+            ReadContext ctxt("data.txt", _file.c_str(), _file.size());
+            EgoBench::doNotOptimize(readFile(ctxt));
+        }
+    }
+
+    EgoBench_Bench(tokenizer) {
+        while (state.keepRunning()) {
+            Ego::Script::Tokenizer ctxt("data.txt", _file.c_str(), _file.size());
+            EgoBench::doNotOptimize(readFile(ctxt));
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
@@ -31,32 +31,189 @@ bool line_of_sight_info_t::blocked(line_of_sight_info_t& self, std::shared_ptr<c
     return mesh_hit /*|| chr_hit*/;
 }
 
-bool line_of_sight_info_t::with_mesh(line_of_sight_info_t& self, std::shared_ptr<const ego_mesh_t> mesh) {
-    int Dx, Dy;
-    int ix, ix_stt, ix_end;
-    int iy, iy_stt, iy_end;
+namespace {
 
-    int Dbig, Dsmall;
-    int ibig, ibig_stt, ibig_end;
-    int ismall, ismall_stt, ismall_end;
-    int dbig, dsmall;
-    int TwoDsmall, TwoDsmallMinusTwoDbig, TwoDsmallMinusDbig;
+bool g_cachesEnabled = true;
+line_of_sight_info_t::Statistics g_statistics = {0, 0, 0, 0};
+
+/// For each fx bit the number of tiles with that bit in the rectangles from the origin, see setCachesEnabled().
+struct TileRegionTable
+{
+    static const size_t FX_BITS = 8;
+
+    uint32_t revision = 0;
+    int width = 0, height = 0;
+    std::array<std::vector<uint32_t>, FX_BITS> sums;
+
+    /// Get if a rectangle of tiles contains a tile which stops the line of sight.
+    bool any(const ego_mesh_t& mesh, BIT_FIELD bits, int x0, int y0, int x1, int y1)
+    {
+        if (revision != mesh.getRevision())
+        {
+            revision = mesh.getRevision();
+            width = mesh._info.getTileCountX();
+            height = mesh._info.getTileCountY();
+            for (auto& table : sums) table.clear();
+        }
+        for (size_t bit = 0; bit < FX_BITS; ++bit)
+        {
+            if (HAS_NO_BITS(bits, 1 << bit)) continue;
+            const std::vector<uint32_t>& table = get(mesh, bit);
+            const int stride = width + 1;
+            uint32_t count = table[(y1 + 1) * stride + (x1 + 1)] - table[y0 * stride + (x1 + 1)]
+                           - table[(y1 + 1) * stride + x0] + table[y0 * stride + x0];
+            if (0 != count) return true;
+        }
+        return false;
+    }
+
+private:
+    const std::vector<uint32_t>& get(const ego_mesh_t& mesh, size_t bit)
+    {
+        std::vector<uint32_t>& table = sums[bit];
+        if (table.empty())
+        {
+            const int stride = width + 1;
+            table.assign(stride * (height + 1), 0);
+            for (int y = 0; y < height; ++y)
+            {
+                uint32_t row = 0;
+                for (int x = 0; x < width; ++x)
+                {
+                    if (0 != mesh.test_fx(mesh.getTileIndex(Index2D(x, y)), 1 << bit)) row++;
+                    table[(y + 1) * stride + (x + 1)] = table[y * stride + (x + 1)] + row;
+                }
+            }
+        }
+        return table;
+    }
+};
+
+/// The results of recent tests, keyed by the start and end tiles, the major axis and the stopping bits.
+struct TilePairCache
+{
+    static const size_t SIZE = 4096;
+
+    struct Entry
+    {
+        uint64_t tiles;
+        uint32_t stopped_by;
+        uint32_t revision;      ///< 0 if unused, a mesh revision is never 0
+        bool steep;
+        bool blocked;
+        int collide_x, collide_y;
+        uint32_t collide_fx;
+    };
+    std::array<Entry, SIZE> entries;
+
+    TilePairCache() { for (auto& entry : entries) entry.revision = 0; }
+
+    static uint64_t key(int ix_stt, int iy_stt, int ix_end, int iy_end)
+    {
+        return (uint64_t(uint16_t(ix_stt)) << 48) | (uint64_t(uint16_t(iy_stt)) << 32)
+             | (uint64_t(uint16_t(ix_end)) << 16) | uint64_t(uint16_t(iy_end));
+    }
+
+    Entry& find(uint64_t tiles, uint32_t stopped_by, bool steep)
+    {
+        uint64_t hash = (tiles ^ (uint64_t(stopped_by) << 1) ^ uint64_t(steep)) * 0x9E3779B97F4A7C15ULL;
+        return entries[hash >> 52];
+    }
+};
+static_assert(TilePairCache::SIZE == 1 << 12, "the hash uses the upper 12 bits");
+
+TileRegionTable g_regionTable;
+TilePairCache g_pairCache;
+
+/// Walk the tiles from the start tile to the end tile.
+bool walk(line_of_sight_info_t& self, const ego_mesh_t& mesh, int ix_stt, int iy_stt, int ix_end, int iy_end, bool steep);
+
+} // namespace
 
-    bool steep;
+const line_of_sight_info_t::Statistics& line_of_sight_info_t::getStatistics() {
+    return g_statistics;
+}
+
+void line_of_sight_info_t::setCachesEnabled(bool enabled) {
+    g_cachesEnabled = enabled;
+}
 
+bool line_of_sight_info_t::with_mesh(line_of_sight_info_t& self, std::shared_ptr<const ego_mesh_t> mesh) {
     //is there any point of these calculations?
     if (EMPTY_BIT_FIELD == self.stopped_by) return false;
 
-    ix_stt = std::floor(self.x0 / Info<float>::Grid::Size()); /// @todo We have a projection function for that.
-    ix_end = std::floor(self.x1 / Info<float>::Grid::Size());
+    g_statistics.tests++;
 
-    iy_stt = std::floor(self.y0 / Info<float>::Grid::Size()); /// @todo We have a projection function for that.
-    iy_end = std::floor(self.y1 / Info<float>::Grid::Size());
+    int ix_stt = std::floor(self.x0 / Info<float>::Grid::Size()); /// @todo We have a projection function for that.
+    int ix_end = std::floor(self.x1 / Info<float>::Grid::Size());
 
-    Dx = self.x1 - self.x0;
-    Dy = self.y1 - self.y0;
+    int iy_stt = std::floor(self.y0 / Info<float>::Grid::Size()); /// @todo We have a projection function for that.
+    int iy_end = std::floor(self.y1 / Info<float>::Grid::Size());
 
-    steep = (std::abs(Dy) >= std::abs(Dx));
+    int Dx = self.x1 - self.x0;
+    int Dy = self.y1 - self.y0;
+
+    bool steep = (std::abs(Dy) >= std::abs(Dx));
+
+    if (!g_cachesEnabled) {
+        g_statistics.walks++;
+        return walk(self, *mesh, ix_stt, iy_stt, ix_end, iy_end, steep);
+    }
+
+    // The walk stays within the rectangle spanned by the start and end tiles and skips tiles outside of the mesh.
+    const int maxX = int(mesh->_info.getTileCountX()) - 1, maxY = int(mesh->_info.getTileCountY()) - 1;
+    const int x0 = std::max(0, std::min(ix_stt, ix_end)), x1 = std::min(maxX, std::max(ix_stt, ix_end));
+    const int y0 = std::max(0, std::min(iy_stt, iy_end)), y1 = std::min(maxY, std::max(iy_stt, iy_end));
+    if (HAS_NO_BITS(self.stopped_by, ~0xFFu)) {
+        if (x0 > x1 || y0 > y1 || !g_regionTable.any(*mesh, self.stopped_by, x0, y0, x1, y1)) {
+            g_statistics.regionsClear++;
+            return false;
+        }
+    }
+
+    // Tile coordinates which do not fit the key are not cached.
+    const bool cacheable = ix_stt == int16_t(ix_stt) && iy_stt == int16_t(iy_stt) && ix_end == int16_t(ix_end) && iy_end == int16_t(iy_end);
+    if (!cacheable) {
+        g_statistics.walks++;
+        return walk(self, *mesh, ix_stt, iy_stt, ix_end, iy_end, steep);
+    }
+
+    const uint64_t tiles = TilePairCache::key(ix_stt, iy_stt, ix_end, iy_end);
+    TilePairCache::Entry& entry = g_pairCache.find(tiles, self.stopped_by, steep);
+    if (entry.revision == mesh->getRevision() && entry.tiles == tiles && entry.stopped_by == self.stopped_by && entry.steep == steep) {
+        g_statistics.cacheHits++;
+        if (entry.blocked) {
+            self.collide_x = entry.collide_x;
+            self.collide_y = entry.collide_y;
+            self.collide_fx = entry.collide_fx;
+        }
+        return entry.blocked;
+    }
+
+    g_statistics.walks++;
+    entry.blocked = walk(self, *mesh, ix_stt, iy_stt, ix_end, iy_end, steep);
+    entry.tiles = tiles;
+    entry.stopped_by = self.stopped_by;
+    entry.steep = steep;
+    entry.revision = mesh->getRevision();
+    if (entry.blocked) {
+        entry.collide_x = self.collide_x;
+        entry.collide_y = self.collide_y;
+        entry.collide_fx = self.collide_fx;
+    }
+    return entry.blocked;
+}
+
+namespace {
+
+bool walk(line_of_sight_info_t& self, const ego_mesh_t& mesh, int ix_stt, int iy_stt, int ix_end, int iy_end, bool steep) {
+    int ix, iy;
+
+    int Dbig, Dsmall;
+    int ibig, ibig_stt, ibig_end;
+    int ismall, ismall_stt, ismall_end;
+    int dbig, dsmall;
+    int TwoDsmall, TwoDsmallMinusTwoDbig, TwoDsmallMinusDbig;
 
     // determine which are the big and small values
     if (steep)
@@ -119,10 +276,10 @@ bool line_of_sight_info_t::with_mesh(line_of_sight_info_t& self, std::shared_ptr
         }
 
         // check to see if the "ray" collides with the mesh
-        Index1D fan = mesh->getTileIndex(Index2D(ix, iy));
+        Index1D fan = mesh.getTileIndex(Index2D(ix, iy));
         if (Index1D::Invalid != fan && fan != fan_last)
         {
-            uint32_t collide_fx = mesh->test_fx(fan, self.stopped_by);
+            uint32_t collide_fx = mesh.test_fx(fan, self.stopped_by);
             // collide the ray with the mesh
 
             if (EMPTY_BIT_FIELD != collide_fx)
@@ -152,6 +309,8 @@ bool line_of_sight_info_t::with_mesh(line_of_sight_info_t& self, std::shared_ptr
     return false;
 }
 
+} // namespace
+
 bool line_of_sight_info_t::with_characters(line_of_sight_info_t& self) {
     // TODO: Do line/character intersection.
     return false;
@@ -39,4 +39,26 @@ struct line_of_sight_info_t
     static bool blocked(line_of_sight_info_t& self, std::shared_ptr<const ego_mesh_t> mesh);
     static bool with_mesh(line_of_sight_info_t& self, std::shared_ptr<const ego_mesh_t> mesh);
     static bool with_characters(line_of_sight_info_t& self);
+
+    /// Statistics of the mesh line-of-sight tests
+    struct Statistics
+    {
+        size_t tests;           ///< number of tests
+        size_t regionsClear;    ///< tests answered by the tile region table (no blocking tile between the end points)
+        size_t cacheHits;       ///< tests answered by the tile pair cache
+        size_t walks;           ///< tests which walked the tiles
+    };
+    static const Statistics& getStatistics();
+
+    /**
+     * @brief
+     *  Enable or disable the caches of with_mesh(), enabled by default.
+     * @remark
+     *  The result of a test only depends on the start and end tiles, the major axis of the line and the
+     *  @a stopped_by bits. with_mesh() remembers the results of recent tests by these keys and, for each
+     *  fx bit, counts the tiles with that bit in every rectangle of tiles (a summed-area table built on the
+     *  first test against a mesh). Both are rebuilt whenever ego_mesh_t::getRevision() changes.
+     *  The caches are not thread-safe: only test on the update thread.
+     */
+    static void setCachesEnabled(bool enabled);
 };
\ No newline at end of file
@@ -16,6 +16,17 @@ void App::initialize() {
     Ego::FontManager::initialize();
 }
 
+void App::initializeHeadless() {
+    // Initialize the graphics system.
+    Ego::GraphicsSystem::initializeHeadless();
+    // Initialize the image manager.
+    Ego::ImageManager::initialize();
+    // Initialize the texture manager. Without a renderer, its textures are not uploaded.
+    TextureManager::initialize();
+    // Initialize the font manager.
+    Ego::FontManager::initialize();
+}
+
 void App::uninitialize() {
     // Uninitialize the font manager.
     Ego::FontManager::uninitialize();
@@ -4,6 +4,8 @@ namespace Ego {
 // for sharing code between Cartman and Game.
 struct App {
 	static void initialize();
+	/// Initialize without a renderer, for running the game without a display or a GPU.
+	static void initializeHeadless();
 	static void uninitialize();
 };
 }
\ No newline at end of file
@@ -64,7 +64,8 @@ static const std::array<const char*, GSND_COUNT> wavenames =
 AudioSystem::AudioSystem() :
     _musicLoaded(),
     _musicIDToNameMap(),
-    _soundsLoaded(),
+    _music(nullptr),
+    _soundBank(),
     _globalSounds(),
     _loopingSounds(),
     _currentSongPlaying(),
@@ -134,21 +135,42 @@ void AudioSystem::loadGlobalSounds()
             _globalSounds[cnt] = sound;
         }
     }
+
+    // Global sounds are used by the GUI, decode them now to avoid a hitch on first use.
+    prewarmSounds(std::vector<SoundID>(_globalSounds.begin(), _globalSounds.end()));
+}
+
+void AudioSystem::prewarmSounds(const std::vector<SoundID>& soundIDs)
+{
+    if (!egoboo_config_t::get().sound_effects_enable.getValue()) {
+        return;
+    }
+    for (SoundID soundID : soundIDs) {
+        _soundBank.prewarm(soundID);
+    }
+}
+
+void AudioSystem::setSoundBudget(size_t bytes)
+{
+    _soundBank.setBudget(bytes);
+}
+
+const Ego::Audio::SoundBank::Statistics& AudioSystem::getSoundStatistics() const
+{
+    return _soundBank.getStatistics();
 }
 
 AudioSystem::~AudioSystem()
 {
-    for (auto& music : _musicLoaded) {
-        Mix_FreeMusic(music.second);
+    if (_music) {
+        Mix_HaltMusic();
+        Mix_FreeMusic(_music);
+        _music = nullptr;
     }
     _musicLoaded.clear();
     _musicIDToNameMap.clear();
 
-    for (Mix_Chunk *chunk : _soundsLoaded)
-    {
-        Mix_FreeChunk(chunk);
-    }
-    _soundsLoaded.clear();
+    _soundBank.clear();
     _loopingSounds.clear();
 
 	Mix_CloseAudio();
@@ -183,11 +205,8 @@ void AudioSystem::download(egoboo_config_t& cfg)
 
         // Start playing queued/paused song.
         if(!_currentSongPlaying.empty()) {
-            const auto& result = _musicLoaded.find(_currentSongPlaying);
-            if (result != _musicLoaded.end()) {
-                Mix_HaltMusic();
-                Mix_FadeInMusic(result->second, -1, 500);
-            }            
+            Mix_HaltMusic();
+            startMusic(_currentSongPlaying, 500);
         }
     }
 }
@@ -214,43 +233,31 @@ SoundID AudioSystem::loadSound(const std::string &fileName)
         return INVALID_SOUND_ID;
     }
 
-    // blank out the data
-    std::string fullFileName;
-    Mix_Chunk* loadedSound = nullptr;
-    bool fileExists = false;
-
-    // try an ogg file
-    fullFileName = fileName + ".ogg";
-    if (vfs_exists(fullFileName.c_str()))
+    // try an ogg file, then a wav file
+    for (const char *extension : {".ogg", ".wav"})
     {
-        fileExists = true;
-        loadedSound = Mix_LoadWAV_RW(vfs_openRWopsRead(fullFileName.c_str()), 1);
-    }
-
-    //OGG failed, try WAV instead
-    if (nullptr == loadedSound)
-    {
-        fullFileName = fileName + ".wav";
-        if (vfs_exists(fullFileName.c_str()))
-        {
-            fileExists = true;
-            loadedSound = Mix_LoadWAV_RW(vfs_openRWopsRead(fullFileName.c_str()), 1);
+        const std::string fullFileName = fileName + extension;
+        if (!vfs_exists(fullFileName.c_str())) {
+            continue;
         }
-    }
 
-    if (nullptr == loadedSound)
-    {
-        // there is an error only if the file exists and can't be loaded
-        if (fileExists) {
-			Log::get().warn("Sound file not found/loaded %s.\n", fileName.c_str());
+        char *data = nullptr;
+        size_t length = 0;
+        if (!vfs_readEntireFile(fullFileName, &data, &length)) {
+            Log::get().warn("Sound file not found/loaded %s.\n", fullFileName.c_str());
+            continue;
         }
+        std::vector<uint8_t> contents(data, data + length);
+        std::free(data);
 
-        return INVALID_SOUND_ID;
+        // The sound is decoded when it is played for the first time.
+        SoundID soundID = _soundBank.add(std::move(contents));
+        if (soundID != INVALID_SOUND_ID) {
+            return soundID;
+        }
     }
 
-    //Sound loaded!
-    _soundsLoaded.push_back(loadedSound);
-    return _soundsLoaded.size() - 1;
+    return INVALID_SOUND_ID;
 }
 
 MusicID AudioSystem::loadMusic(const std::string &fileName)
@@ -260,23 +267,54 @@ MusicID AudioSystem::loadMusic(const std::string &fileName)
         return INVALID_SOUND_ID;
     }
 
-    Mix_Music* loadedMusic = Mix_LoadMUSType_RW(vfs_openRWopsRead(fileName.c_str()), MUS_NONE, 1);
-
-    if (!loadedMusic)
+    // The track is opened when it is played.
+    if (!vfs_exists(fileName.c_str()))
     {
-		Log::get().warn("Failed to load music (%s): %s.\n", fileName.c_str(), Mix_GetError());
+		Log::get().warn("Failed to load music (%s): file not found.\n", fileName.c_str());
         return INVALID_SOUND_ID;
     }
 
     // Got it!
     const std::string songName = fileName.substr(fileName.find_last_of('/') + 1);
     const MusicID id = _musicLoaded.size();
-    _musicLoaded[songName] = loadedMusic;
+    _musicLoaded[songName] = fileName;
     _musicIDToNameMap[id] = songName;
 
     return id;
 }
 
+bool AudioSystem::startMusic(const std::string& songName, const uint16_t fadetime)
+{
+    //Get the file name of the track from the name of the song
+    const auto& result = _musicLoaded.find(songName);
+    if(result == _musicLoaded.end()) {
+        Log::get().warn("Failed to play music! (Song name does not exist: %s)\n", songName.c_str());        
+        return false;
+    }
+
+    // Open the track, its data is decoded from the file while it is playing
+    Mix_Music* music = Mix_LoadMUSType_RW(vfs_openRWopsRead(result->second.c_str()), MUS_NONE, 1);
+    if (!music)
+    {
+        Log::get().warn("Failed to load music (%s): %s.\n", result->second.c_str(), Mix_GetError());
+        return false;
+    }
+
+    // Mix_FadeOutMusic(fadetime);      // Stops the game too
+    if (Mix_FadeInMusic(music, -1, fadetime) == -1) {
+        Log::get().warn("Failed to play music! (%s)\n", Mix_GetError());
+        Mix_FreeMusic(music);
+        return false;
+    }
+
+    // The previous track has been halted by Mix_FadeInMusic and can be released
+    if (_music) {
+        Mix_FreeMusic(_music);
+    }
+    _music = music;
+    return true;
+}
+
 void AudioSystem::playMusic(const std::string& songName, const uint16_t fadetime)
 { 
     // Dont restart a song we are already playing.
@@ -294,17 +332,7 @@ void AudioSystem::playMusic(const std::string& songName, const uint16_t fadetime
     //Set music volume
     Mix_VolumeMusic(egoboo_config_t::get().sound_music_volume.getValue());
 
-    //Get the actual music data from the name of the song
-    const auto& result = _musicLoaded.find(songName);
-    if(result == _musicLoaded.end()) {
-        Log::get().warn("Failed to play music! (Song name does not exist: %s)\n", songName.c_str());        
-        return;
-    }
-
-    // Mix_FadeOutMusic(fadetime);      // Stops the game too
-    if (Mix_FadeInMusic(result->second, -1, fadetime) == -1) {
-        Log::get().warn("Failed to play music! (%s)\n", Mix_GetError());
-    }
+    startMusic(songName, fadetime);
 }
 
 void AudioSystem::playMusic(const int musicID, const uint16_t fadetime)
@@ -323,7 +351,7 @@ void AudioSystem::loadAllMusic()
     // Open the playlist listing all music files
     ReadContext ctxt("mp_data/music/playlist.txt");
 
-    // Load all music data into memory
+    // Register all music tracks, they are streamed when played
     while (ctxt.skipToColon(true))
     {
         std::string songName;
@@ -366,7 +394,10 @@ void AudioSystem::updateLoopingSound(const std::shared_ptr<LoopingSound> &sound)
     {
         //No channel allocated to this sound yet? try to allocate a free one
         if (channel == INVALID_SOUND_CHANNEL) {
-            channel = Mix_PlayChannel(-1, _soundsLoaded[sound->getSoundID()], -1);
+            Mix_Chunk *chunk = _soundBank.get(sound->getSoundID());
+            if (chunk) {
+                channel = Mix_PlayChannel(-1, chunk, -1);
+            }
         }
 
         //Update sound effects
@@ -427,7 +458,7 @@ void AudioSystem::fadeAllSounds()
 
 int AudioSystem::playSoundFull(SoundID soundID)
 {
-    if (soundID < 0 || soundID >= _soundsLoaded.size())
+    if (!_soundBank.isValid(soundID))
     {
         return INVALID_SOUND_CHANNEL;
     }
@@ -437,8 +468,15 @@ int AudioSystem::playSoundFull(SoundID soundID)
         return INVALID_SOUND_CHANNEL;
     }
 
+    // decode the sound if this is its first use
+    Mix_Chunk *chunk = _soundBank.get(soundID);
+    if (!chunk)
+    {
+        return INVALID_SOUND_CHANNEL;
+    }
+
     // play the sound
-    int channel = Mix_PlayChannel(-1, _soundsLoaded[soundID], 0);
+    int channel = Mix_PlayChannel(-1, chunk, 0);
 
     if (channel != INVALID_SOUND_CHANNEL) {
         //remove any 3D positional mixing effects
@@ -501,7 +539,7 @@ void AudioSystem::playSoundLooped(const SoundID soundID, ObjectRef ownerRef)
     }
 
     // Check for invalid sounds
-    if (soundID < 0 || soundID >= _soundsLoaded.size()) {
+    if (!_soundBank.isValid(soundID)) {
         return;
     }
 
@@ -526,7 +564,7 @@ void AudioSystem::playSoundLooped(const SoundID soundID, ObjectRef ownerRef)
 int AudioSystem::playSound(const Vector3f& snd_pos, const SoundID soundID)
 {
     // If the sound ID is not valid ...
-    if (soundID < 0 || soundID >= _soundsLoaded.size())
+    if (!_soundBank.isValid(soundID))
     {
         // ... return invalid channel.
         return INVALID_SOUND_CHANNEL;
@@ -548,8 +586,15 @@ int AudioSystem::playSound(const Vector3f& snd_pos, const SoundID soundID)
         return INVALID_SOUND_CHANNEL;
     }
 
+    // Decode the sound if this is its first use
+    Mix_Chunk *chunk = _soundBank.get(soundID);
+    if (!chunk)
+    {
+        return INVALID_SOUND_CHANNEL;
+    }
+
     // Play the sound once
-    int channel = Mix_PlayChannel(-1, _soundsLoaded[soundID], 0);
+    int channel = Mix_PlayChannel(-1, chunk, 0);
 
     // could fail if no free channels are available.
     if (INVALID_SOUND_CHANNEL != channel)
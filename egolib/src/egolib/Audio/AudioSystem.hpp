@@ -25,12 +25,11 @@
 #include "egolib/egoboo_setup.h"
 #include "egolib/Math/_Include.hpp"
 #include "egolib/Core/Singleton.hpp"
+#include "egolib/Audio/SoundBank.hpp"
 
 typedef int MusicID;
-typedef int SoundID;
 
 static constexpr int INVALID_SOUND_CHANNEL = -1;
-static constexpr SoundID INVALID_SOUND_ID = -1;
 
 /// Data needed to store and manipulate a looped sound
 class LoopingSound
@@ -138,20 +137,39 @@ public:
 
     /**
     * @author ZF
-    * @details This functions plays a specified track loaded into memory
+    * @details This functions plays a specified track of the playlist
     **/
     void playMusic(const MusicID musicID, const uint16_t fadetime = 0);
 
     /**
     * @author ZF
-    * @details This functions plays a specified track loaded into memory
+    * @details This functions plays a specified track of the playlist. Only the track being
+    *          played is opened, its data is streamed while it plays.
     **/
     void playMusic(const std::string& songName, const uint16_t fadetime = 0);
 
+    /**
+     * @brief
+     *  Add a sound to the sound bank.
+     * @param fileName
+     *  the file name of the sound without extension (OGG is preferred over WAV)
+     * @return
+     *  the sound ID or @a INVALID_SOUND_ID. Files with identical contents share their sound ID.
+     * @remark
+     *  The sound is not decoded before it is played or pre-warmed.
+     */
     SoundID loadSound(const std::string &fileName);
 
+    /**
+     * @brief
+     *  Decode sounds ahead of their first use.
+     * @param soundIDs
+     *  the sound IDs
+     */
+    void prewarmSounds(const std::vector<SoundID>& soundIDs);
+
     /// @author ZF
-    /// @details This function loads all of the music sounds
+    /// @details This function reads the music playlist
     void loadAllMusic();
 
     /**
@@ -243,12 +261,31 @@ public:
     **/
     void setSoundEffectVolume(int value);
 
+    /**
+    * @brief
+    *   Sets the budget of decoded sound effect data.
+    * @param bytes
+    *   the budget in Bytes, least recently played sounds are released when it is exceeded
+    **/
+    void setSoundBudget(size_t bytes);
+
+    /**
+    * @brief
+    *   Gets the statistics of the sound bank (resident bytes, decode time, ...).
+    **/
+    const Ego::Audio::SoundBank::Statistics& getSoundStatistics() const;
+
 private:
     /**
-    * @brief Loads one music track. Returns nullptr if it fails
+    * @brief Adds one music track to the playlist. Returns INVALID_SOUND_ID if it does not exist
     **/
     MusicID loadMusic(const std::string &fileName);
 
+    /**
+    * @brief Opens a music track for streaming and starts playing it.
+    **/
+    bool startMusic(const std::string& songName, const uint16_t fadetime);
+
     /**
      * @brief applies 3D spatial effect to the specified sound (using volume and panning)
      * @param channel
@@ -279,9 +316,10 @@ private:
     void updateLoopingSound(const std::shared_ptr<LoopingSound>& sound);
 
 private:
-    std::unordered_map<std::string, Mix_Music*> _musicLoaded;    //Maps song names to music data
+    std::unordered_map<std::string, std::string> _musicLoaded;   //Maps song names to music file names
     std::unordered_map<MusicID, std::string> _musicIDToNameMap;   //Maps MusicID to song names
-    std::vector<Mix_Chunk*> _soundsLoaded;
+    Mix_Music *_music;                                            //The music track being streamed
+    Ego::Audio::SoundBank _soundBank;
     std::array<SoundID, GSND_COUNT> _globalSounds;
 
     std::forward_list<std::shared_ptr<LoopingSound>> _loopingSounds;
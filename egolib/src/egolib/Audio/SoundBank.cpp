@@ -0,0 +1,193 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Audio/SoundBank.cpp
+/// @brief  A deduplicated bank of lazily decoded sound effects.
+
+#include "egolib/Audio/SoundBank.hpp"
+
+#include "egolib/Log/_Include.hpp"
+
+namespace Ego {
+namespace Audio {
+
+SoundBank::SoundBank(size_t decodedBudget) :
+    _budget(decodedBudget),
+    _sounds(),
+    _soundsByHash(),
+    _lru(),
+    _statistics() {}
+
+SoundBank::~SoundBank() {
+    clear();
+}
+
+uint64_t SoundBank::hash(const std::vector<uint8_t> &data) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint8_t byte : data) {
+        hash ^= byte;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool SoundBank::isPlaying(const Mix_Chunk *chunk) {
+    const int channels = Mix_AllocateChannels(-1);
+    for (int channel = 0; channel < channels; ++channel) {
+        if (Mix_Playing(channel) && Mix_GetChunk(channel) == chunk) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SoundID SoundBank::add(std::vector<uint8_t> data) {
+    if (data.empty()) {
+        return INVALID_SOUND_ID;
+    }
+
+    // Return the existing sound if the contents are identical.
+    const uint64_t dataHash = hash(data);
+    auto range = _soundsByHash.equal_range(dataHash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (_sounds[it->second].data == data) {
+            _statistics.duplicates++;
+            return it->second;
+        }
+    }
+
+    const SoundID soundID = static_cast<SoundID>(_sounds.size());
+    _statistics.encodedBytes += data.size();
+    _sounds.push_back({std::move(data), nullptr, false, _lru.end()});
+    _soundsByHash.emplace(dataHash, soundID);
+    return soundID;
+}
+
+bool SoundBank::isValid(SoundID soundID) const {
+    return soundID >= 0 && static_cast<size_t>(soundID) < _sounds.size();
+}
+
+Mix_Chunk *SoundBank::get(SoundID soundID) {
+    if (!isValid(soundID)) {
+        return nullptr;
+    }
+    Sound &sound = _sounds[soundID];
+
+    // Already decoded, mark as most recently used.
+    if (sound.chunk) {
+        _lru.splice(_lru.begin(), _lru, sound.lruPosition);
+        return sound.chunk;
+    }
+
+    // Decoding failed before, it fails again.
+    if (sound.failed) {
+        return nullptr;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    sound.chunk = Mix_LoadWAV_RW(SDL_RWFromConstMem(sound.data.data(), static_cast<int>(sound.data.size())), 1);
+    auto end = std::chrono::high_resolution_clock::now();
+    _statistics.decodeMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    if (!sound.chunk) {
+        Log::get().warn("unable to decode sound %d: %s\n", soundID, Mix_GetError());
+        sound.failed = true;
+        _statistics.failedDecodes++;
+        return nullptr;
+    }
+
+    _statistics.decodes++;
+    _statistics.decodedSounds++;
+    _statistics.residentBytes += sound.chunk->alen;
+    _lru.push_front(soundID);
+    sound.lruPosition = _lru.begin();
+
+    // Make room for the new sound, it is the most recently used one and is not evicted.
+    evict();
+
+    return sound.chunk;
+}
+
+void SoundBank::prewarm(SoundID soundID) {
+    get(soundID);
+}
+
+void SoundBank::setBudget(size_t decodedBudget) {
+    _budget = decodedBudget;
+    evict();
+}
+
+size_t SoundBank::getBudget() const {
+    return _budget;
+}
+
+void SoundBank::evict() {
+    auto it = _lru.end();
+    while (_statistics.residentBytes > _budget && it != _lru.begin()) {
+        --it;
+        // Never evict the most recently used sound.
+        if (it == _lru.begin()) {
+            break;
+        }
+        Sound &sound = _sounds[*it];
+        if (isPlaying(sound.chunk)) {
+            continue;
+        }
+        auto next = std::next(it);
+        unload(sound);
+        _statistics.evictions++;
+        it = next;
+    }
+}
+
+void SoundBank::unload(Sound &sound) {
+    _statistics.residentBytes -= sound.chunk->alen;
+    _statistics.decodedSounds--;
+    Mix_FreeChunk(sound.chunk);
+    sound.chunk = nullptr;
+    _lru.erase(sound.lruPosition);
+    sound.lruPosition = _lru.end();
+}
+
+void SoundBank::release() {
+    for (Sound &sound : _sounds) {
+        if (sound.chunk && !isPlaying(sound.chunk)) {
+            unload(sound);
+        }
+    }
+}
+
+void SoundBank::clear() {
+    for (Sound &sound : _sounds) {
+        if (sound.chunk) {
+            unload(sound);
+        }
+    }
+    _sounds.clear();
+    _soundsByHash.clear();
+    _lru.clear();
+    _statistics.encodedBytes = 0;
+}
+
+const SoundBank::Statistics &SoundBank::getStatistics() const {
+    return _statistics;
+}
+
+} // namespace Audio
+} // namespace Ego
@@ -0,0 +1,168 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Audio/SoundBank.hpp
+/// @brief  A deduplicated bank of lazily decoded sound effects.
+
+#pragma once
+
+#include "egolib/typedef.h"
+
+typedef int SoundID;
+
+static constexpr SoundID INVALID_SOUND_ID = -1;
+
+namespace Ego {
+namespace Audio {
+
+/**
+ * @brief
+ *  A bank of sound effects.
+ * @details
+ *  Sounds are added as encoded (OGG or WAV) file contents and are identified by a hash of
+ *  these contents, i.e. identical files share one sound ID. A sound is decoded into a
+ *  @a Mix_Chunk when it is played for the first time. The decoded PCM data of sounds that
+ *  are not playing is released in least recently used order once the decoded data exceeds
+ *  the budget of the bank.
+ */
+class SoundBank : public Id::NonCopyable {
+public:
+    /// Default budget of decoded PCM data (32 MiB).
+    static constexpr size_t DEFAULT_DECODED_BUDGET = 32 * 1024 * 1024;
+
+    struct Statistics {
+        size_t encodedBytes = 0;         ///< Size of the encoded data of all sounds.
+        size_t residentBytes = 0;        ///< Size of the decoded PCM data currently held.
+        size_t decodedSounds = 0;        ///< Number of sounds currently decoded.
+        size_t decodes = 0;              ///< Total number of decodes.
+        size_t failedDecodes = 0;        ///< Number of sounds that could not be decoded.
+        size_t evictions = 0;            ///< Total number of decoded sounds released to stay within the budget.
+        size_t duplicates = 0;           ///< Total number of added sounds that were identical to an existing sound.
+        uint64_t decodeMicroseconds = 0; ///< Total time spent decoding.
+    };
+
+    /**
+     * @brief
+     *  Construct this sound bank.
+     * @param decodedBudget
+     *  the budget of decoded PCM data in Bytes
+     */
+    SoundBank(size_t decodedBudget = DEFAULT_DECODED_BUDGET);
+
+    /**
+     * @brief
+     *  Destruct this sound bank, freeing all decoded sounds.
+     */
+    ~SoundBank();
+
+    /**
+     * @brief
+     *  Add a sound.
+     * @param data
+     *  the encoded contents of a sound file
+     * @return
+     *  the sound ID. If a sound with the same contents exists, its ID is returned.
+     *  @a INVALID_SOUND_ID if @a data is empty.
+     */
+    SoundID add(std::vector<uint8_t> data);
+
+    /**
+     * @brief
+     *  Get if a sound ID refers to a sound in this bank.
+     */
+    bool isValid(SoundID soundID) const;
+
+    /**
+     * @brief
+     *  Get the decoded chunk of a sound, decoding it if necessary.
+     * @param soundID
+     *  the sound ID
+     * @return
+     *  the chunk or @a nullptr if the sound ID is invalid or the sound could not be decoded
+     * @remark
+     *  The chunk remains valid until the sound is evicted. Sounds playing on a mixer
+     *  channel are never evicted.
+     * @remark
+     *  A sound which could not be decoded is not decoded again.
+     */
+    Mix_Chunk *get(SoundID soundID);
+
+    /**
+     * @brief
+     *  Decode a sound ahead of its first use.
+     * @param soundID
+     *  the sound ID
+     */
+    void prewarm(SoundID soundID);
+
+    /**
+     * @brief
+     *  Set the budget of decoded PCM data.
+     * @param decodedBudget
+     *  the budget in Bytes
+     */
+    void setBudget(size_t decodedBudget);
+
+    size_t getBudget() const;
+
+    /**
+     * @brief
+     *  Free all decoded sounds that are not playing.
+     */
+    void release();
+
+    /**
+     * @brief
+     *  Remove all sounds. All sound IDs become invalid.
+     */
+    void clear();
+
+    const Statistics &getStatistics() const;
+
+private:
+    struct Sound {
+        std::vector<uint8_t> data;
+        Mix_Chunk *chunk;
+        /// @a true if decoding this sound failed.
+        bool failed;
+        std::list<SoundID>::iterator lruPosition;
+    };
+
+    /// Calculate the 64-bit FNV-1a hash of encoded sound data.
+    static uint64_t hash(const std::vector<uint8_t> &data);
+
+    /// Get if a chunk is currently playing on any mixer channel.
+    static bool isPlaying(const Mix_Chunk *chunk);
+
+    /// Free decoded sounds in least recently used order until the budget is met.
+    void evict();
+
+    /// Free the decoded chunk of a sound.
+    void unload(Sound &sound);
+
+    size_t _budget;
+    std::vector<Sound> _sounds;
+    std::unordered_multimap<uint64_t, SoundID> _soundsByHash;
+    /// The decoded sounds from most to least recently used.
+    std::list<SoundID> _lru;
+    Statistics _statistics;
+};
+
+} // namespace Audio
+} // namespace Ego
@@ -26,12 +26,12 @@
 namespace Ego {
 namespace Time {
 
-Clock<ClockPolicy::NonRecursive>::Clock(const std::string& name, size_t slidingWindowCapacity)
-	: Internal::AbstractClock<ClockPolicy::NonRecursive>(name, slidingWindowCapacity) {
+Clock<ClockPolicy::NonRecursive>::Clock(const std::string& name, size_t slidingWindowCapacity, bool profiled)
+	: Internal::AbstractClock<ClockPolicy::NonRecursive>(name, slidingWindowCapacity, profiled) {
 }
 
-Clock<ClockPolicy::Recursive>::Clock(const std::string& name, size_t slidingWindowCapacity)
-	: Internal::AbstractClock<ClockPolicy::Recursive>(name, slidingWindowCapacity), _balance(0) {
+Clock<ClockPolicy::Recursive>::Clock(const std::string& name, size_t slidingWindowCapacity, bool profiled)
+	: Internal::AbstractClock<ClockPolicy::Recursive>(name, slidingWindowCapacity, profiled), _balance(0) {
 }
 
 void Clock<ClockPolicy::Recursive>::enter() {
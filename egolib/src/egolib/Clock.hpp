@@ -26,6 +26,7 @@
 #include "egolib/Time/LocalTime.hpp"
 #include "egolib/Time/Stopwatch.hpp"
 #include "egolib/Time/SlidingWindow.hpp"
+#include "egolib/Time/Profiler.hpp"
 
 namespace Ego {
 namespace Time {
@@ -121,6 +122,37 @@ namespace Internal {
 
 /**
  * @internal
+ * @brief
+ *	A sliding window of durations which keeps the sum of its durations up to date.
+ */
+struct DurationWindow : public SlidingWindow<double> {
+private:
+	double _sum;
+protected:
+	void onAdd(const double& dataPoint) override {
+		_sum += dataPoint;
+	}
+	void onRemove(const double& dataPoint) override {
+		_sum -= dataPoint;
+	}
+	void onClear() override {
+		_sum = 0;
+	}
+public:
+	DurationWindow(size_t capacity)
+		: SlidingWindow<double>(capacity), _sum(0) {
+	}
+	double sum() const {
+		return _sum;
+	}
+};
+
+/**
+ * @internal
+ * @remark
+ *	A clock constructed with @a profiled set enters and leaves a profiler zone of its name, see
+ *	Ego::Time::Profiler. Clocks entered many times per frame should not be profiled, as each call
+ *	takes a slot in the ring of the profiler.
  */
 template <typename _ClockPolicy>
 struct AbstractClock {
@@ -136,13 +168,25 @@ protected:
 	 * @brief
 	 *	A sliding window holding the a finite, consecutive subset of the measured durations.
 	 */
-	SlidingWindow<double> _slidingWindow;
+	DurationWindow _slidingWindow;
 	/**
 	 * @brief
 	 *	The stopwatch backing this clock.
 	 */
 	Stopwatch _stopwatch;
 
+	/**
+	 * @brief
+	 *	If this clock enters a profiler zone of its name.
+	 */
+	bool _profiled;
+
+	/**
+	 * @brief
+	 *	If this clock entered a profiler zone which it has to leave.
+	 */
+	bool _inZone;
+
 protected:
 
 	/**
@@ -152,13 +196,15 @@ protected:
 	 *	the name of the clock
 	 * @param slidingWindowCapacity
 	 *	the capacity of the sliding window
+	 * @param profiled
+	 *	if the clock enters a profiler zone of its name
 	 * @throw std::invalid_argument
 	 *	if the sliding window capacity is not positive
 	 * @post
 	 *	The clock is in its initial state w.r.t. the current point in time.
 	 */
-	AbstractClock(const std::string& name, size_t slidingWindowCapacity)
-		: _name(name), _stopwatch(), _slidingWindow(slidingWindowCapacity) {
+	AbstractClock(const std::string& name, size_t slidingWindowCapacity, bool profiled)
+		: _name(name), _slidingWindow(slidingWindowCapacity), _stopwatch(), _profiled(profiled && !name.empty()), _inZone(false) {
 		// Intentionally empty.
 	}
 	virtual ~AbstractClock() {
@@ -190,11 +236,7 @@ public:
 			return 0;
 		}
 		else {
-			double totalTime = 0;
-			for (size_t i = 0; i < _slidingWindow.size(); ++i) {
-				totalTime += _slidingWindow.get(i);
-			}
-			return totalTime / _slidingWindow.size();
+			return _slidingWindow.sum() / _slidingWindow.size();
 		}
 	}
 
@@ -222,6 +264,10 @@ public:
 	virtual void enter() {
 		_stopwatch.reset();
 		_stopwatch.start();
+		if (_profiled && !_inZone) {
+			EGO_PROFILE_ENTER(_name.c_str());
+			_inZone = true;
+		}
 	}
 
 	/**
@@ -235,6 +281,10 @@ public:
 		_slidingWindow.add(_stopwatch.elapsed());
 		// Reset the stopwatch.
 		_stopwatch.reset();
+		if (_inZone) {
+			EGO_PROFILE_LEAVE();
+			_inZone = false;
+		}
 	}
 
 	/**
@@ -265,12 +315,14 @@ public:
 	 *	the name of this clock
 	 * @param slidingWindowCapacity
 	 *	the capacity of the sliding window of this clock
+	 * @param profiled
+	 *	if this clock enters a profiler zone of its name
 	 * @throw std::invalid_argument
 	 *	if the sliding window capacity is not positive
 	 * @post
 	 *	The clock is in its initial state w.r.t. the current point in time.
 	 */
-	Clock(const std::string& name, size_t slidingWindowCapacity);
+	Clock(const std::string& name, size_t slidingWindowCapacity, bool profiled = false);
 
 };
 
@@ -299,12 +351,14 @@ public:
 	 *	the name of this clock
 	 * @param slidingWindowCapacity
 	 *	the capacity of the sliding window of this clock
+	 * @param profiled
+	 *	if this clock enters a profiler zone of its name
 	 * @throw std::invalid_argument
 	 *	if the sliding window capacity is not positive
 	 * @post
 	 *	The clock is in its initial state w.r.t. the current point in time.
 	 */
-	Clock(const std::string& name, size_t slidingWindowCapacity);
+	Clock(const std::string& name, size_t slidingWindowCapacity, bool profiled = false);
 
 	/** @internal @copydoc AbstractClock::enter */
 	virtual void enter() override;
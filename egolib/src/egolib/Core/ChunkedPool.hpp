@@ -0,0 +1,227 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Core/ChunkedPool.hpp
+/// @brief  A pool of elements addressed by index, stored in chunks allocated on demand.
+/// @details
+/// The elements keep their index and their address for as long as the pool exists, so the
+/// indices can be stored in place of pointers. Released indices are reused last in, first out,
+/// before any index which was never allocated, which keeps the allocated indices dense.
+
+#pragma once
+
+#include "egolib/typedef.h"
+
+namespace Ego {
+namespace Core {
+
+template <typename Type, size_t ChunkSize = 4096>
+class ChunkedPool : public Id::NonCopyable {
+public:
+    /// The index returned if the pool is exhausted.
+    static const uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief
+     *  Construct an empty pool.
+     * @param capacity
+     *  the maximum number of elements
+     */
+    explicit ChunkedPool(uint32_t capacity) :
+        _capacity(capacity), _allocated(0), _next(0), _chunks(), _free() {
+    }
+
+    /**
+     * @brief
+     *  Allocate an element.
+     * @return
+     *  the index of the element, @a NONE if the pool is exhausted
+     * @remark
+     *  The element is in the state in which it was released or, if it was never allocated,
+     *  default-constructed.
+     */
+    uint32_t allocate() {
+        uint32_t index;
+        if (!_free.empty()) {
+            index = _free.back();
+            _free.pop_back();
+        } else if (_next < _capacity) {
+            index = _next++;
+        } else {
+            return NONE;
+        }
+        getChunk(index).allocated.set(index % ChunkSize);
+        _allocated++;
+        return index;
+    }
+
+    /**
+     * @brief
+     *  Release an element.
+     * @param index
+     *  the index of the element
+     * @return
+     *  @a true if the element was allocated, @a false otherwise
+     */
+    bool release(uint32_t index) {
+        if (!isAllocated(index)) {
+            return false;
+        }
+        _chunks[index / ChunkSize]->allocated.reset(index % ChunkSize);
+        _allocated--;
+        _free.push_back(index);
+        return true;
+    }
+
+    /**
+     * @brief
+     *  Get if an element is allocated.
+     * @param index
+     *  the index of the element
+     * @return
+     *  @a true if the element is allocated, @a false otherwise
+     */
+    bool isAllocated(uint32_t index) const {
+        if (index >= _next) {
+            return false;
+        }
+        const Chunk *chunk = _chunks[index / ChunkSize].get();
+        return nullptr != chunk && chunk->allocated.test(index % ChunkSize);
+    }
+
+    /**
+     * @brief
+     *  Get an element.
+     * @param index
+     *  the index of the element
+     * @throw Id::OutOfBoundsException
+     *  if @a index is not smaller than the capacity
+     * @remark
+     *  The element does not need to be allocated. The chunk of the element is allocated if necessary.
+     */
+    Type& operator[](uint32_t index) {
+        if (index >= _capacity) {
+            throw Id::OutOfBoundsException(__FILE__, __LINE__, "index out of bounds");
+        }
+        return getChunk(index).elements[index % ChunkSize];
+    }
+
+    /**
+     * @brief
+     *  Get an element.
+     * @param index
+     *  the index of the element
+     * @throw Id::OutOfBoundsException
+     *  if @a index is not smaller than the capacity
+     * @remark
+     *  A default-constructed element is returned for elements of chunks which were not allocated yet.
+     */
+    const Type& operator[](uint32_t index) const {
+        static const Type empty{};
+        if (index >= _capacity) {
+            throw Id::OutOfBoundsException(__FILE__, __LINE__, "index out of bounds");
+        }
+        const size_t chunk = index / ChunkSize;
+        if (chunk >= _chunks.size() || nullptr == _chunks[chunk]) {
+            return empty;
+        }
+        return _chunks[chunk]->elements[index % ChunkSize];
+    }
+
+    /**
+     * @brief
+     *  Release all elements and all chunks.
+     */
+    void clear() {
+        _chunks.clear();
+        _free.clear();
+        _allocated = 0;
+        _next = 0;
+    }
+
+    /**
+     * @brief
+     *  Invoke a function for each allocated element, in ascending order of the indices.
+     * @param function
+     *  the function, invoked with the index and the element
+     */
+    template <typename Function>
+    void forEachAllocated(Function&& function) {
+        for (size_t i = 0; i < _chunks.size(); ++i) {
+            Chunk *chunk = _chunks[i].get();
+            if (nullptr == chunk || chunk->allocated.none()) {
+                continue;
+            }
+            for (size_t j = 0; j < ChunkSize; ++j) {
+                if (chunk->allocated.test(j)) {
+                    function(static_cast<uint32_t>(i * ChunkSize + j), chunk->elements[j]);
+                }
+            }
+        }
+    }
+
+    /// Get the maximum number of elements.
+    uint32_t getCapacity() const {
+        return _capacity;
+    }
+
+    /// Get the number of allocated elements.
+    uint32_t getAllocatedCount() const {
+        return _allocated;
+    }
+
+    /// Get the number of elements which can still be allocated.
+    uint32_t getFreeCount() const {
+        return _capacity - _allocated;
+    }
+
+    /// Get the number of allocated chunks.
+    size_t getChunkCount() const {
+        return std::count_if(_chunks.begin(), _chunks.end(),
+                             [](const std::unique_ptr<Chunk>& chunk) { return nullptr != chunk; });
+    }
+
+private:
+    struct Chunk {
+        std::array<Type, ChunkSize> elements;
+        std::bitset<ChunkSize> allocated;
+    };
+
+    Chunk& getChunk(uint32_t index) {
+        const size_t chunk = index / ChunkSize;
+        if (chunk >= _chunks.size()) {
+            _chunks.resize(chunk + 1);
+        }
+        if (nullptr == _chunks[chunk]) {
+            _chunks[chunk] = std::make_unique<Chunk>();
+        }
+        return *_chunks[chunk];
+    }
+
+    uint32_t _capacity;
+    uint32_t _allocated;
+    /// The smallest index which was never allocated.
+    uint32_t _next;
+    std::vector<std::unique_ptr<Chunk>> _chunks;
+    /// The released indices.
+    std::vector<uint32_t> _free;
+};
+
+} // namespace Core
+} // namespace Ego
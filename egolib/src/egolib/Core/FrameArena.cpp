@@ -0,0 +1,114 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Core/FrameArena.cpp
+/// @brief  A linear allocator for allocations which live no longer than a frame.
+
+#include "egolib/Core/FrameArena.hpp"
+
+namespace Ego {
+namespace Core {
+
+namespace {
+/// The heap allocations of the calling thread. Trivial, so accessing it never allocates.
+thread_local uint64_t g_heapAllocations = 0;
+}
+
+uint64_t getHeapAllocationCount() {
+    return g_heapAllocations;
+}
+
+FrameArena::FrameArena(size_t capacity) :
+    _buffer(new char[capacity]),
+    _capacity(capacity),
+    _offset(0),
+    _overflowMutex(),
+    _overflowBlocks(),
+    _heapAllocationsAtBegin(getHeapAllocationCount()),
+    _statistics{capacity, 0, 0, 0}
+{}
+
+void *FrameArena::align(char *address, size_t alignment) {
+    const uintptr_t value = reinterpret_cast<uintptr_t>(address);
+    return reinterpret_cast<void *>((value + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1));
+}
+
+void *FrameArena::allocate(size_t size, size_t alignment) {
+    // Reserve enough bytes to align the allocation within them, so no compare-and-swap loop is needed.
+    const size_t reserved = size + alignment - 1;
+    const size_t offset = _offset.fetch_add(reserved, std::memory_order_relaxed);
+    if (offset + reserved <= _capacity) {
+        return align(_buffer.get() + offset, alignment);
+    }
+    // The buffer is exhausted, fall back to the heap until the next frame.
+    std::lock_guard<std::mutex> lock(_overflowMutex);
+    _overflowBlocks.emplace_back(new char[reserved]);
+    return align(_overflowBlocks.back().get(), alignment);
+}
+
+void FrameArena::beginFrame() {
+    const size_t used = _offset.load(std::memory_order_relaxed);
+    if (used > _capacity) {
+        // Grow with some headroom, so frames slightly busier than the last one fit as well.
+        _capacity = used + used / 2;
+        _buffer.reset(new char[_capacity]);
+    }
+    _overflowBlocks.clear();
+    _offset.store(0, std::memory_order_relaxed);
+    _heapAllocationsAtBegin = getHeapAllocationCount();
+}
+
+void FrameArena::endFrame() {
+    _statistics.capacity = _capacity;
+    _statistics.used = _offset.load(std::memory_order_relaxed);
+    _statistics.overflows = _overflowBlocks.size();
+    _statistics.heapAllocations = getHeapAllocationCount() - _heapAllocationsAtBegin;
+}
+
+FrameArena& FrameArena::update() {
+    static FrameArena arena;
+    return arena;
+}
+
+FrameArena& FrameArena::render() {
+    static FrameArena arena;
+    return arena;
+}
+
+} // namespace Core
+} // namespace Ego
+
+#if EGO_COUNT_HEAP_ALLOCATIONS
+void *operator new(std::size_t size) {
+    Ego::Core::g_heapAllocations++;
+    void *pointer = std::malloc(size ? size : 1);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+#endif
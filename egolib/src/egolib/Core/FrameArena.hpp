@@ -0,0 +1,179 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Core/FrameArena.hpp
+/// @brief  A linear allocator for allocations which live no longer than a frame.
+/// @details
+/// Short-lived containers of an update or a rendered frame are allocated from a FrameArena
+/// @code
+/// auto objects = Ego::Core::makeFrameVector<std::shared_ptr<Object>>(Ego::Core::FrameArena::update());
+/// @endcode
+/// All allocations of an arena are freed at once when its next frame begins. Once the arena
+/// is large enough for the busiest frame, frames allocate nothing from the heap.
+/// Compiling with <tt>EGO_COUNT_HEAP_ALLOCATIONS=1</tt> counts the number of heap allocations
+/// by replacing the global operator new. Only the debug builds define it, by default the
+/// standard operator new is kept.
+
+#pragma once
+
+#include "egolib/typedef.h"
+
+#if !defined(EGO_COUNT_HEAP_ALLOCATIONS)
+    #define EGO_COUNT_HEAP_ALLOCATIONS 0
+#endif
+
+namespace Ego {
+namespace Core {
+
+/**
+ * @brief
+ *  Get the number of heap allocations (calls of operator new) made by the calling thread so far.
+ * @return
+ *  the number of heap allocations, always 0 if EGO_COUNT_HEAP_ALLOCATIONS is 0
+ */
+uint64_t getHeapAllocationCount();
+
+/**
+ * @brief
+ *  A linear (bump) allocator. Allocating is thread-safe and lock-free as long as the buffer
+ *  does not overflow, beginning and ending a frame is not.
+ */
+class FrameArena : public Id::NonCopyable {
+public:
+    /// The initial size of the buffer, in bytes.
+    static const size_t DEFAULT_CAPACITY = 256 * 1024;
+
+    struct Statistics {
+        /// The size of the buffer, in bytes.
+        size_t capacity;
+        /// The bytes requested in the last frame, including the overflow.
+        size_t used;
+        /// The allocations of the last frame which did not fit into the buffer.
+        size_t overflows;
+        /// The heap allocations of the thread which ended the last frame, during the last frame.
+        uint64_t heapAllocations;
+    };
+
+    /// Begins a frame of an arena upon its creation and ends it upon its destruction.
+    struct FrameScope : public Id::NonCopyable {
+        explicit FrameScope(FrameArena& arena) : _arena(arena) {
+            _arena.beginFrame();
+        }
+        ~FrameScope() {
+            _arena.endFrame();
+        }
+    private:
+        FrameArena& _arena;
+    };
+
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief
+     *  Allocate memory which stays valid until the next frame begins.
+     * @remark
+     *  If the buffer is exhausted, the memory is allocated from the heap.
+     */
+    void *allocate(size_t size, size_t alignment);
+
+    /**
+     * @brief
+     *  Free all allocations. If the last frame overflowed, the buffer grows to hold it.
+     */
+    void beginFrame();
+
+    /**
+     * @brief
+     *  Publish the statistics of the frame.
+     */
+    void endFrame();
+
+    const Statistics& getStatistics() const {
+        return _statistics;
+    }
+
+    /// The arena of the game updates.
+    static FrameArena& update();
+
+    /// The arena of the rendered frames, for the main thread and the threads helping it render.
+    static FrameArena& render();
+
+private:
+    static void *align(char *address, size_t alignment);
+
+    std::unique_ptr<char[]> _buffer;
+    size_t _capacity;
+    /// The bytes requested since the frame began. May exceed the capacity.
+    std::atomic<size_t> _offset;
+    std::mutex _overflowMutex;
+    std::vector<std::unique_ptr<char[]>> _overflowBlocks;
+    uint64_t _heapAllocationsAtBegin;
+    Statistics _statistics;
+};
+
+/**
+ * @brief
+ *  An STL allocator allocating from a FrameArena. Deallocating does nothing.
+ */
+template <typename Type>
+class FrameAllocator {
+public:
+    using value_type = Type;
+
+    explicit FrameAllocator(FrameArena& arena) noexcept : _arena(&arena) {}
+
+    template <typename OtherType>
+    FrameAllocator(const FrameAllocator<OtherType>& other) noexcept : _arena(other.getArena()) {}
+
+    Type *allocate(size_t count) {
+        return static_cast<Type *>(_arena->allocate(count * sizeof(Type), alignof(Type)));
+    }
+
+    void deallocate(Type *, size_t) noexcept {}
+
+    FrameArena *getArena() const noexcept {
+        return _arena;
+    }
+
+private:
+    FrameArena *_arena;
+};
+
+template <typename Type, typename OtherType>
+bool operator==(const FrameAllocator<Type>& x, const FrameAllocator<OtherType>& y) noexcept {
+    return x.getArena() == y.getArena();
+}
+
+template <typename Type, typename OtherType>
+bool operator!=(const FrameAllocator<Type>& x, const FrameAllocator<OtherType>& y) noexcept {
+    return x.getArena() != y.getArena();
+}
+
+/// A vector allocated from a FrameArena.
+template <typename Type>
+using FrameVector = std::vector<Type, FrameAllocator<Type>>;
+
+/// Create an empty vector allocating from a FrameArena.
+template <typename Type>
+FrameVector<Type> makeFrameVector(FrameArena& arena) {
+    return FrameVector<Type>(FrameAllocator<Type>(arena));
+}
+
+} // namespace Core
+} // namespace Ego
@@ -0,0 +1,159 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Core/GridIndex.cpp
+/// @brief  A uniform grid of points identified by index, for rectangle and radius queries.
+
+#include "egolib/Core/GridIndex.hpp"
+
+namespace Ego {
+namespace Core {
+
+GridIndex::GridIndex(float cellSize) :
+    _cellSize(cellSize), _cellsX(1), _cellsY(1), _size(0),
+    _cells(1), _locations()
+{}
+
+size_t GridIndex::getCellX(float x) const {
+    const float cell = x / _cellSize;
+    // Also maps NaN to the first cell.
+    if (!(cell >= 0.0f)) {
+        return 0;
+    }
+    return cell < _cellsX ? static_cast<size_t>(cell) : _cellsX - 1;
+}
+
+size_t GridIndex::getCellY(float y) const {
+    const float cell = y / _cellSize;
+    if (!(cell >= 0.0f)) {
+        return 0;
+    }
+    return cell < _cellsY ? static_cast<size_t>(cell) : _cellsY - 1;
+}
+
+void GridIndex::link(uint32_t id, Location& location) {
+    std::vector<uint32_t>& cell = _cells[getCellY(location.y) * _cellsX + getCellX(location.x)];
+    location.cell = static_cast<uint32_t>(&cell - _cells.data());
+    location.slot = static_cast<uint32_t>(cell.size());
+    cell.push_back(id);
+}
+
+void GridIndex::unlink(const Location& location) {
+    // Move the last point of the cell into the slot of the point.
+    std::vector<uint32_t>& cell = _cells[location.cell];
+    const uint32_t last = cell.back();
+    cell[location.slot] = last;
+    _locations[last].slot = location.slot;
+    cell.pop_back();
+}
+
+void GridIndex::resize(size_t cellsX, size_t cellsY) {
+    _cellsX = std::max<size_t>(1, cellsX);
+    _cellsY = std::max<size_t>(1, cellsY);
+    _cells.clear();
+    _cells.resize(_cellsX * _cellsY);
+    for (uint32_t id = 0; id < _locations.size(); ++id) {
+        if (NONE != _locations[id].cell) {
+            link(id, _locations[id]);
+        }
+    }
+}
+
+void GridIndex::set(uint32_t id, float x, float y) {
+    if (id >= _locations.size()) {
+        _locations.resize(id + 1, Location{NONE, 0, 0.0f, 0.0f});
+    }
+    Location& location = _locations[id];
+    if (NONE == location.cell) {
+        _size++;
+    } else if (location.cell == getCellY(y) * _cellsX + getCellX(x)) {
+        // The point stays in its cell.
+        location.x = x;
+        location.y = y;
+        return;
+    } else {
+        unlink(location);
+    }
+    location.x = x;
+    location.y = y;
+    link(id, location);
+}
+
+bool GridIndex::remove(uint32_t id) {
+    if (!contains(id)) {
+        return false;
+    }
+    unlink(_locations[id]);
+    _locations[id].cell = NONE;
+    _size--;
+    return true;
+}
+
+bool GridIndex::contains(uint32_t id) const {
+    return id < _locations.size() && NONE != _locations[id].cell;
+}
+
+void GridIndex::clear() {
+    for (auto& cell : _cells) {
+        cell.clear();
+    }
+    _locations.clear();
+    _size = 0;
+}
+
+template <typename Predicate>
+void GridIndex::find(float minX, float minY, float maxX, float maxY, Predicate&& predicate, std::vector<uint32_t>& result) const {
+    const size_t first = result.size();
+    const size_t minCellX = getCellX(minX), maxCellX = getCellX(maxX);
+    const size_t minCellY = getCellY(minY), maxCellY = getCellY(maxY);
+    for (size_t cellY = minCellY; cellY <= maxCellY; ++cellY) {
+        for (size_t cellX = minCellX; cellX <= maxCellX; ++cellX) {
+            for (uint32_t id : _cells[cellY * _cellsX + cellX]) {
+                if (predicate(_locations[id])) {
+                    result.push_back(id);
+                }
+            }
+        }
+    }
+    std::sort(result.begin() + first, result.end());
+}
+
+void GridIndex::findInRect(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const {
+    if (!(minX <= maxX && minY <= maxY)) {
+        return;
+    }
+    find(minX, minY, maxX, maxY, [=](const Location& location) {
+        return location.x >= minX && location.x <= maxX &&
+               location.y >= minY && location.y <= maxY;
+    }, result);
+}
+
+void GridIndex::findInRadius(float x, float y, float radius, std::vector<uint32_t>& result) const {
+    if (!(radius >= 0.0f)) {
+        return;
+    }
+    const float radius2 = radius * radius;
+    find(x - radius, y - radius, x + radius, y + radius, [=](const Location& location) {
+        const float dx = location.x - x, dy = location.y - y;
+        return dx * dx + dy * dy <= radius2;
+    }, result);
+}
+
+} // namespace Core
+} // namespace Ego
@@ -0,0 +1,145 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Core/GridIndex.hpp
+/// @brief  A uniform grid of points identified by index, for rectangle and radius queries.
+
+#pragma once
+
+#include "egolib/typedef.h"
+
+namespace Ego {
+namespace Core {
+
+/**
+ * @brief
+ *  Points bucketed by the grid cell they are in. Points outside of the grid are put into the
+ *  nearest cell along the border, so the results of the queries do not depend on the size of the grid,
+ *  only their cost does. Inserting, moving and removing a point takes constant time.
+ */
+class GridIndex : public Id::NonCopyable {
+public:
+    /**
+     * @brief
+     *  Construct an empty index of a grid of one cell.
+     * @param cellSize
+     *  the side length of a cell
+     */
+    explicit GridIndex(float cellSize);
+
+    /**
+     * @brief
+     *  Change the number of cells. The points are kept.
+     * @param cellsX, cellsY
+     *  the number of cells along the x- and y-axes, at least 1
+     */
+    void resize(size_t cellsX, size_t cellsY);
+
+    /**
+     * @brief
+     *  Insert a point or move it if it is already in this index.
+     * @param id
+     *  the index of the point
+     * @param x, y
+     *  the position of the point
+     */
+    void set(uint32_t id, float x, float y);
+
+    /**
+     * @brief
+     *  Remove a point.
+     * @param id
+     *  the index of the point
+     * @return
+     *  @a true if the point was in this index, @a false otherwise
+     */
+    bool remove(uint32_t id);
+
+    /**
+     * @brief
+     *  Get if a point is in this index.
+     */
+    bool contains(uint32_t id) const;
+
+    /**
+     * @brief
+     *  Remove all points.
+     */
+    void clear();
+
+    /**
+     * @brief
+     *  Get the number of points in this index.
+     */
+    size_t size() const {
+        return _size;
+    }
+
+    /**
+     * @brief
+     *  Find the points within a rectangle.
+     * @param minX, minY, maxX, maxY
+     *  the rectangle, including its border
+     * @param result
+     *  the indices of the points are appended to this, in ascending order
+     */
+    void findInRect(float minX, float minY, float maxX, float maxY, std::vector<uint32_t>& result) const;
+
+    /**
+     * @brief
+     *  Find the points within a circle.
+     * @param x, y
+     *  the center of the circle
+     * @param radius
+     *  the radius of the circle, a point at this distance is within the circle
+     * @param result
+     *  the indices of the points are appended to this, in ascending order
+     */
+    void findInRadius(float x, float y, float radius, std::vector<uint32_t>& result) const;
+
+private:
+    static const uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    struct Location {
+        /// The cell of the point, @a NONE if the point is not in this index.
+        uint32_t cell;
+        /// The index of the point in the list of points of its cell.
+        uint32_t slot;
+        float x, y;
+    };
+
+    size_t getCellX(float x) const;
+    size_t getCellY(float y) const;
+    void link(uint32_t id, Location& location);
+    void unlink(const Location& location);
+
+    template <typename Predicate>
+    void find(float minX, float minY, float maxX, float maxY, Predicate&& predicate, std::vector<uint32_t>& result) const;
+
+    float _cellSize;
+    size_t _cellsX, _cellsY;
+    size_t _size;
+    /// The points of each cell, row by row.
+    std::vector<std::vector<uint32_t>> _cells;
+    /// The location of each point, by index.
+    std::vector<Location> _locations;
+};
+
+} // namespace Core
+} // namespace Ego
@@ -106,7 +106,8 @@ public:
     * @param result
     *   Vector of all elements that fit within the search area
     **/
-    void find(const AxisAlignedBox2f &searchArea, std::vector<std::shared_ptr<T>> &result) const
+    template <typename Allocator>
+    void find(const AxisAlignedBox2f &searchArea, std::vector<std::shared_ptr<T>, Allocator> &result) const
     {
         Ego::Math::Intersects<AxisAlignedBox2f, AxisAlignedBox2f> intersects;
         //Search grid is not part of our bounds
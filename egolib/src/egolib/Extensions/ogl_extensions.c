@@ -508,6 +508,16 @@ void Utilities::upload_2d(const PixelFormatDescriptor& pfd, GLsizei w, GLsizei h
     GL_DEBUG(glTexImage2D)(GL_TEXTURE_2D, 0, internalFormat_gl, w, h, 0, format_gl, type_gl, data);
 }
 
+void Utilities::upload_2d_rectangle(const PixelFormatDescriptor& pfd, GLint x, GLint y, GLsizei w, GLsizei h, const void *data)
+{
+    GLenum internalFormat_gl, format_gl, type_gl;
+    toOpenGL(pfd, internalFormat_gl, format_gl, type_gl);
+    PushClientAttrib pca(GL_CLIENT_PIXEL_STORE_BIT);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    GL_DEBUG(glTexSubImage2D)(GL_TEXTURE_2D, 0, x, y, w, h, format_gl, type_gl, data);
+}
+
 void Utilities::upload_2d_mipmap(const PixelFormatDescriptor& pfd, GLsizei w, GLsizei h, const void *data)
 {
     GLenum internalFormat_gl, format_gl, type_gl;
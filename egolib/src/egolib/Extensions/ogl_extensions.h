@@ -178,6 +178,14 @@ public:
      * @param data a pointer to the pixels
      */
     static void upload_2d_mipmap(const PixelFormatDescriptor& pfd, GLsizei w, GLsizei h, const void *data);
+    /**
+     * @brief Upload a rectangle of a 2D texture.
+     * @param pdf the pixel descriptor describing the format of a pixels
+     * @param x, y the position of the pixel rectangle in the texture
+     * @param w, h the width and height of the pixel rectangle
+     * @param data a pointer to the pixels
+     */
+    static void upload_2d_rectangle(const PixelFormatDescriptor& pfd, GLint x, GLint y, GLsizei w, GLsizei h, const void *data);
 
     /**
      * @brief
@@ -36,37 +36,84 @@
 //--------------------------------------------------------------------------------------------
 namespace Ego {
 
-struct Font::RenderedTextCache : Id::NonCopyable {
-    std::shared_ptr<Font::LaidTextRenderer> cache;
-    uint32_t lastUseInTicks;
+struct Font::TextCacheKey {
     std::string text;
     int width;
     int height;
     int spacing;
+    bool interpretNewlines;
 
-    bool isEquivalent(const std::string &t, int w, int h, int s) {
-        return w == width && h == height && s == spacing && t == text;
+    bool operator==(const TextCacheKey &other) const {
+        return width == other.width && height == other.height && spacing == other.spacing &&
+               interpretNewlines == other.interpretNewlines && text == other.text;
     }
 
-    static bool isLessThan(const std::shared_ptr<RenderedTextCache> &a, const std::shared_ptr<RenderedTextCache> &b) {
-        return a->lastUseInTicks < b->lastUseInTicks;
-    }
+    struct Hash {
+        size_t operator()(const TextCacheKey &key) const {
+            size_t hash = std::hash<std::string>()(key.text);
+            hash ^= std::hash<int>()(key.width) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<int>()(key.height) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<int>()(key.spacing) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<bool>()(key.interpretNewlines) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
 };
 
-struct Font::SizedTextCache : Id::NonCopyable {
-    uint32_t lastUseInTicks;
-    std::string text;
-    int width;
-    int height;
-    int spacing;
+/// The entries are kept in a list ordered from most to least recently used,
+/// the hash map maps the keys to their list nodes.
+template <typename ValueType>
+class Font::TextCache : Id::NonCopyable {
+public:
+    TextCache(size_t capacity, Statistics &statistics) :
+        _capacity(capacity), _statistics(statistics), _entries(), _index() {
+        _index.reserve(capacity);
+    }
 
-    bool isEquivalent(const std::string &t, int s) {
-        return s == spacing && t == text;
+    /// @brief Find the value of a key and mark it as most recently used.
+    /// @return A pointer to the value or @c nullptr if the key is not in the cache
+    ValueType *find(const TextCacheKey &key) {
+        auto it = _index.find(key);
+        if (it == _index.end()) {
+            _statistics.cacheMisses++;
+            return nullptr;
+        }
+        _statistics.cacheHits++;
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return &(it->second->second);
     }
 
-    static bool isLessThan(const std::shared_ptr<SizedTextCache> &a, const std::shared_ptr<SizedTextCache> &b) {
-        return a->lastUseInTicks < b->lastUseInTicks;
+    /// @brief Add a value, evicting the least recently used entry if the cache is full.
+    /// @pre The key is not in the cache.
+    void insert(const TextCacheKey &key, const ValueType &value) {
+        if (_capacity == 0) return;
+        if (_entries.size() >= _capacity) {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+            _statistics.cacheEvictions++;
+        }
+        _entries.emplace_front(key, value);
+        _index.emplace(key, _entries.begin());
     }
+
+private:
+    using Entry = std::pair<TextCacheKey, ValueType>;
+
+    size_t _capacity;
+    Statistics &_statistics;
+    std::list<Entry> _entries;
+    std::unordered_map<TextCacheKey, typename std::list<Entry>::iterator, TextCacheKey::Hash> _index;
+};
+
+struct Font::TextSize {
+    int width;
+    int height;
+};
+
+struct Font::Glyph {
+    std::shared_ptr<SDL_Surface> surface; ///< The rasterized glyph or @c nullptr if the font does not provide it.
+    int minx;
+    int advance;
 };
 
 struct Font::FontAtlas {
@@ -77,9 +124,9 @@ struct Font::FontAtlas {
 struct Font::LaidOutText {
     std::vector<uint16_t> codepoints;
     std::vector<SDL_Rect> positions;
-    const FontAtlas &atlas;
+    std::shared_ptr<const FontAtlas> atlas;
 
-    LaidOutText(const FontAtlas &a) :
+    LaidOutText(const std::shared_ptr<const FontAtlas> &a) :
         atlas(a) {}
 };
 
@@ -118,21 +165,38 @@ void Font::LaidTextRenderer::render(int x, int y, const Ego::Math::Colour4f &col
     renderer.render(*(_vertexBuffer.get()), Ego::PrimitiveType::Quadriliterals, 0, _vertexBuffer->getNumberOfVertices());
 }
 
+Font::Statistics &Font::Statistics::operator+=(const Statistics &other) {
+    cacheHits += other.cacheHits;
+    cacheMisses += other.cacheMisses;
+    cacheEvictions += other.cacheEvictions;
+    glyphsRasterized += other.glyphsRasterized;
+    rasterizationMicroseconds += other.rasterizationMicroseconds;
+    return *this;
+}
+
 Font::Font(const std::string &fileName, int pointSize) :
     _ttfFont(),
+    _statistics(),
+    _lastFrameStatistics(),
     _renderedCache(),
-    _sizedCache() {
+    _sizedCache(),
+    _glyphs(),
+    _kerning(),
+    _atlas() {
     _ttfFont = TTF_OpenFontRW(vfs_openRWopsRead(fileName), 1, pointSize);
 
     if (_ttfFont == nullptr) {
         throw Id::EnvironmentErrorException(__FILE__, __LINE__, "SDL_ttf", TTF_GetError());
     }
 
+    _renderedCache = std::make_unique<TextCache<std::shared_ptr<LaidTextRenderer>>>(MAX_CACHE_SIZE, _statistics);
+    _sizedCache = std::make_unique<TextCache<TextSize>>(MAX_CACHE_SIZE, _statistics);
+
     // Create an texture atlas for ASCII characters
     std::vector<uint16_t> ascii;
     for (int i = 0x20; i < 0x7F; i++)
         ascii.push_back(i);
-    _atlases.push_back(createFontAtlas(ascii));
+    addGlyphs(ascii);
 }
 
 Font::~Font() {
@@ -140,56 +204,11 @@ Font::~Font() {
 }
 
 void Font::getTextSize(const std::string &text, int *width, int *height) {
-    bool updateCache = true;
-    std::shared_ptr<SizedTextCache> cache = findInSizedCache(text, 0, &updateCache);
-
-    if (updateCache) {
-        int ourWidth = 0;
-        int ourHeight = 0;
-
-        LayoutOptions options;
-        options.textWidth = &ourWidth;
-        options.textHeight = &ourHeight;
-        options.interpretNewlines = false;
-
-        layout(text, options);
-
-        cache->text = text;
-        cache->width = ourWidth;
-        cache->height = ourHeight;
-        cache->spacing = 0;
-    }
-
-    if (width) *width = cache->width;
-    if (height) *height = cache->height;
-
-    cache->lastUseInTicks = Ego::Core::System::get().getSystemService().getTicks();
+    findInSizedCache(text, 0, false, width, height);
 }
 
 void Font::getTextBoxSize(const std::string &text, int spacing, int *width, int *height) {
-    bool updateCache = true;
-    auto cache = findInSizedCache(text, spacing, &updateCache);
-
-    if (updateCache) {
-        int ourWidth = 0;
-        int ourHeight = 0;
-
-        LayoutOptions options;
-        options.textWidth = &ourWidth;
-        options.textHeight = &ourHeight;
-
-        layout(text, options);
-
-        cache->text = text;
-        cache->width = ourWidth;
-        cache->height = ourHeight;
-        cache->spacing = spacing;
-    }
-
-    if (width) *width = cache->width;
-    if (height) *height = cache->height;
-
-    cache->lastUseInTicks = Ego::Core::System::get().getSystemService().getTicks();
+    findInSizedCache(text, spacing, true, width, height);
 }
 
 void Font::drawTextToTexture(Ego::Texture *tex, const std::string &text, const Ego::Math::Colour3f &colour) {
@@ -203,6 +222,12 @@ void Font::drawTextToTexture(Ego::Texture *tex, const std::string &text, const E
     tex->setAddressModeT(Ego::TextureAddressMode::Clamp);
 }
 
+std::shared_ptr<SDL_Surface> Font::drawTextToSurface(const std::string &text, const Ego::Math::Colour3f &colour) {
+    LayoutOptions options;
+
+    return layoutToTexture(text, options, colour);
+}
+
 void Font::drawTextBoxToTexture(Ego::Texture *tex, const std::string &text, int width, int height, int spacing,
                                 const Ego::Math::Colour3f &colour) {
     LayoutOptions options;
@@ -221,39 +246,13 @@ void Font::drawTextBoxToTexture(Ego::Texture *tex, const std::string &text, int
 void Font::drawText(const std::string &text, int x, int y, const Ego::Math::Colour4f &colour) {
     if (text.empty()) return;
 
-    bool updateCache = true;
-    auto cache = findInRenderedCache(text, 0, 0, 0, &updateCache);
-
-    if (updateCache) {
-        cache->cache = layoutText(text, nullptr, nullptr);
-        cache->text = text;
-        cache->width = 0;
-        cache->height = 0;
-        cache->spacing = 0;
-    }
-
-    cache->cache->render(x, y, colour);
-
-    cache->lastUseInTicks = Ego::Core::System::get().getSystemService().getTicks();
+    findInRenderedCache(text, 0, 0, 0, false)->render(x, y, colour);
 }
 
 void Font::drawTextBox(const std::string &text, int x, int y, int width, int height, int spacing, const Ego::Math::Colour4f &colour) {
     if (text.empty()) return;
 
-    bool updateCache = true;
-    auto cache = findInRenderedCache(text, width, height, spacing, &updateCache);
-
-    if (updateCache) {
-        cache->cache = layoutTextBox(text, width, height, spacing, nullptr, nullptr);
-        cache->text = text;
-        cache->width = width;
-        cache->height = height;
-        cache->spacing = spacing;
-    }
-
-    cache->cache->render(x, y, colour);
-
-    cache->lastUseInTicks = Ego::Core::System::get().getSystemService().getTicks();
+    findInRenderedCache(text, width, height, spacing, true)->render(x, y, colour);
 }
 
 std::shared_ptr<Font::LaidTextRenderer> Font::layoutText(const std::string &text, int *textWidth, int *textHeight) {
@@ -285,8 +284,17 @@ int Font::getFontHeight() const {
     return TTF_FontHeight(_ttfFont);
 }
 
+const Font::Statistics &Font::getStatistics() const {
+    return _lastFrameStatistics;
+}
+
+void Font::endFrame() {
+    _lastFrameStatistics = _statistics;
+    _statistics = Statistics();
+}
+
 void Font::layoutLine(const std::vector<uint16_t> &codepoints, size_t pos, int maxWidth, bool useNewlines,
-                      const FontAtlas &atlas, size_t *endPos, std::vector<uint16_t> &usedChars,
+                      size_t *endPos, std::vector<uint16_t> &usedChars,
                       std::vector<SDL_Rect> &positions, int *lineWidth, int *lineHeight) {
     bool useWidth = maxWidth > 0;
     uint16_t lastCodepoint = 0;
@@ -299,13 +307,17 @@ void Font::layoutLine(const std::vector<uint16_t> &codepoints, size_t pos, int m
     int maxLineHeight = 0;
     for (currentPos = pos; currentPos < codepoints.size(); currentPos++) {
         uint16_t codepoint = codepoints[currentPos];
-        if (codepoint != '\n' && !TTF_GlyphIsProvided(_ttfFont, codepoint))
-            continue;
-        SDL_Rect rect = {0, 0, 0, 0};
+        const Glyph *glyph = nullptr;
         if (codepoint != '\n') {
-            auto glyph = atlas.glyphs.find(codepoint);
-            SDL_assert(glyph != atlas.glyphs.end());
-            rect = glyph->second;
+            glyph = getGlyph(codepoint);
+            if (!glyph)
+                continue;
+        }
+        SDL_Rect rect = {0, 0, 0, 0};
+        if (glyph) {
+            auto atlasGlyph = _atlas->glyphs.find(codepoint);
+            SDL_assert(atlasGlyph != _atlas->glyphs.end());
+            rect = atlasGlyph->second;
         }
         if (codepoint == ' ') {
             lastWordStartPosInChars = currentPos + 1;
@@ -326,9 +338,8 @@ void Font::layoutLine(const std::vector<uint16_t> &codepoints, size_t pos, int m
                 maxLineHeight = 0;
                 for (size_t i = 0; i < usedChars.size(); i++) {
                     uint16_t ch = usedChars[i];
-                    auto glyph = atlas.glyphs.find(ch);
                     SDL_Rect pos = positions[i];
-                    SDL_Rect r = glyph->second;
+                    SDL_Rect r = _atlas->glyphs.at(ch);
                     if (maxLineHeight < r.h)
                         maxLineHeight = r.h;
                     if (maxLineWidth < pos.x + r.w)
@@ -347,16 +358,18 @@ void Font::layoutLine(const std::vector<uint16_t> &codepoints, size_t pos, int m
         if (maxLineHeight < rect.h)
             maxLineHeight = rect.h;
 
-        int minx, advance;
-        TTF_GlyphMetrics(_ttfFont, codepoint, &minx, nullptr, nullptr, nullptr, &advance);
-        x += getFontKerning(lastCodepoint, codepoint);
+        uint32_t kerningPair = (static_cast<uint32_t>(lastCodepoint) << 16) | codepoint;
+        auto kerning = _kerning.find(kerningPair);
+        if (kerning == _kerning.end())
+            kerning = _kerning.emplace(kerningPair, getFontKerning(lastCodepoint, codepoint)).first;
+        x += kerning->second;
         SDL_assert(x >= 0);
         SDL_Rect dst = {x, 0, rect.w, rect.h};
-        if (minx < 0)
-            dst.x += minx;
+        if (glyph->minx < 0)
+            dst.x += glyph->minx;
         positions.push_back(dst);
         usedChars.push_back(codepoint);
-        x += advance;
+        x += glyph->advance;
         lastCodepoint = codepoint;
     }
     *endPos = currentPos;
@@ -371,25 +384,9 @@ Font::LaidOutText Font::layout(const std::string &text, const LayoutOptions &opt
         spacing = getLineSpacing();
 
     std::vector<uint16_t> codepoints = splitUTF8StringToCodepoints(text);
+    addGlyphs(codepoints);
 
-    const FontAtlas *currentAtlas = nullptr;
-    for (const FontAtlas &atlas : _atlases) {
-        bool containsAllChars = std::all_of(codepoints.begin(), codepoints.end(), [&atlas](uint16_t pos) {
-            return pos == ' ' || pos == '\n' || atlas.glyphs.find(pos) != atlas.glyphs.end();
-        });
-
-        if (containsAllChars) {
-            currentAtlas = &atlas;
-            break;
-        }
-    }
-
-    if (currentAtlas == nullptr) {
-        _atlases.push_back(createFontAtlas(codepoints));
-        currentAtlas = &(_atlases.at(_atlases.size() - 1));
-    }
-
-    LaidOutText laidText(*currentAtlas);
+    LaidOutText laidText(_atlas);
 
     int maxLineWidth = 0;
     int y = 0;
@@ -402,7 +399,7 @@ Font::LaidOutText Font::layout(const std::string &text, const LayoutOptions &opt
         int lineHeight;
         size_t newPos = pos;
 
-        layoutLine(codepoints, pos, options.maxWidth, options.interpretNewlines, laidText.atlas, &newPos,
+        layoutLine(codepoints, pos, options.maxWidth, options.interpretNewlines, &newPos,
                    lineUsedChars, linePos, &lineWidth, &lineHeight);
 
         if (newPos == pos)
@@ -451,13 +448,13 @@ std::shared_ptr<Font::LaidTextRenderer> Font::layoutToBuffer(const std::string &
     std::shared_ptr<VertexBuffer> buffer = std::make_shared<VertexBuffer>(4 * laidText.codepoints.size(), vertexDesc);
 
     TextVertex *vertices = reinterpret_cast<TextVertex *>(buffer->lock());
-    float texWidth = laidText.atlas.texture->getWidth();
-    float texHeight = laidText.atlas.texture->getHeight();
+    float texWidth = laidText.atlas->texture->getWidth();
+    float texHeight = laidText.atlas->texture->getHeight();
 
     for (size_t i = 0; i < laidText.codepoints.size(); i++) {
         uint16_t chr = laidText.codepoints[i];
         SDL_Rect charPos = laidText.positions[i];
-        SDL_Rect glyphPos = laidText.atlas.glyphs.at(chr);
+        SDL_Rect glyphPos = laidText.atlas->glyphs.at(chr);
 
         float xMin = charPos.x;
         float xMax = charPos.x + charPos.w;
@@ -494,7 +491,7 @@ std::shared_ptr<Font::LaidTextRenderer> Font::layoutToBuffer(const std::string &
         vertices[i * 4 + 3].v = vMax;
     }
     buffer->unlock();
-    return std::shared_ptr<LaidTextRenderer>(new LaidTextRenderer(laidText.atlas.texture, buffer));
+    return std::shared_ptr<LaidTextRenderer>(new LaidTextRenderer(laidText.atlas->texture, buffer));
 }
 
 std::shared_ptr<SDL_Surface> Font::layoutToTexture(const std::string &text, const LayoutOptions &options,
@@ -523,14 +520,14 @@ std::shared_ptr<SDL_Surface> Font::layoutToTexture(const std::string &text, cons
     SDL_FillRect(surf, nullptr, SDL_MapRGBA(surf->format, colourR, colourG, colourB, 0));
     SDL_SetSurfaceBlendMode(surf, SDL_BLENDMODE_NONE);
 
-    SDL_Surface *atlasSurf = laidText.atlas.texture->_source.get();
+    SDL_Surface *atlasSurf = laidText.atlas->texture->_source.get();
     SDL_GetSurfaceColorMod(atlasSurf, &oldR, &oldG, &oldB);
     SDL_SetSurfaceColorMod(atlasSurf, colourR, colourG, colourB);
 
     for (size_t i = 0; i < laidText.codepoints.size(); i++) {
         uint16_t chr = laidText.codepoints[i];
         SDL_Rect charPos = laidText.positions[i];
-        SDL_Rect glyphPos = laidText.atlas.glyphs.at(chr);
+        SDL_Rect glyphPos = laidText.atlas->glyphs.at(chr);
         SDL_BlitSurface(atlasSurf, &glyphPos, surf, &charPos);
     }
 
@@ -539,23 +536,51 @@ std::shared_ptr<SDL_Surface> Font::layoutToTexture(const std::string &text, cons
     return std::shared_ptr<SDL_Surface>(surf, SDL_FreeSurface);
 }
 
-Font::FontAtlas Font::createFontAtlas(const std::vector<std::string> &chars) const {
-    std::vector<uint16_t> codepoints;
-    for (const std::string & chr : chars)
-        codepoints.push_back(convertUTF8ToCodepoint(chr));
-    return createFontAtlas(codepoints);
+void Font::addGlyphs(const std::vector<uint16_t> &codepoints) {
+    SDL_Color white = {255, 255, 255, 255};
+    bool added = false;
+
+    for (uint16_t cp : codepoints) {
+        if (cp == '\n' || _glyphs.find(cp) != _glyphs.end())
+            continue;
+
+        Glyph glyph = {nullptr, 0, 0};
+        if (TTF_GlyphIsProvided(_ttfFont, cp)) {
+            auto start = std::chrono::high_resolution_clock::now();
+            SDL_Surface *surf = TTF_RenderGlyph_Blended(_ttfFont, cp, white);
+            TTF_GlyphMetrics(_ttfFont, cp, &glyph.minx, nullptr, nullptr, nullptr, &glyph.advance);
+            auto end = std::chrono::high_resolution_clock::now();
+            _statistics.glyphsRasterized++;
+            _statistics.rasterizationMicroseconds +=
+                std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+            if (surf)
+                glyph.surface = std::shared_ptr<SDL_Surface>(surf, SDL_FreeSurface);
+        }
+        _glyphs.emplace(cp, glyph);
+        added = added || glyph.surface != nullptr;
+    }
+
+    if (added || !_atlas)
+        _atlas = createFontAtlas();
 }
 
-Font::FontAtlas Font::createFontAtlas(const std::vector<uint16_t> &codepoints) const {
-    SDL_Color white = {255, 255, 255, 255};
+const Font::Glyph *Font::getGlyph(uint16_t codepoint) const {
+    auto it = _glyphs.find(codepoint);
+    if (it == _glyphs.end() || !it->second.surface)
+        return nullptr;
+    return &(it->second);
+}
+
+std::shared_ptr<Font::FontAtlas> Font::createFontAtlas() const {
+    std::vector<uint16_t> codepoints;
     std::vector<SDL_Surface *> images;
     std::vector<SDL_Rect> pos;
 
-    for (uint16_t cp : codepoints) {
-        SDL_Surface *surf = nullptr;
-        if (TTF_GlyphIsProvided(_ttfFont, cp))
-            surf = TTF_RenderGlyph_Blended(_ttfFont, cp, white);
-        images.push_back(surf);
+    for (const auto &glyph : _glyphs) {
+        if (!glyph.second.surface)
+            continue;
+        codepoints.push_back(glyph.first);
+        images.push_back(glyph.second.surface.get());
     }
 
     int currentMaxSize = 128;
@@ -577,11 +602,6 @@ Font::FontAtlas Font::createFontAtlas(const std::vector<uint16_t> &codepoints) c
         bool fits = true;
 
         for (SDL_Surface *surf : images) {
-            if (surf == nullptr) {
-                pos.push_back({0, 0, 0, 0});
-                continue;
-            }
-
             if (currentMaxSize < surf->w || currentMaxSize < surf->h) {
                 fits = false;
                 break;
@@ -622,93 +642,57 @@ Font::FontAtlas Font::createFontAtlas(const std::vector<uint16_t> &codepoints) c
         SDL_assert(atlas);
     }
 
-    FontAtlas retval;
-    for (int i = 0; i < images.size(); i++) {
-        if (images[i] == nullptr)
-            continue;
-        retval.glyphs.insert(std::make_pair(codepoints[i], pos[i]));
-        SDL_FreeSurface(images[i]);
+    auto retval = std::make_shared<FontAtlas>();
+    for (size_t i = 0; i < images.size(); i++) {
+        retval->glyphs.insert(std::make_pair(codepoints[i], pos[i]));
     }
 
     std::shared_ptr<SDL_Surface> atlasPtr(atlas, SDL_FreeSurface);
-    retval.texture = std::make_shared<Ego::OpenGL::Texture>();
-    retval.texture->load("font atlas", atlasPtr);
-    retval.texture->setAddressModeS(Ego::TextureAddressMode::Clamp);
-    retval.texture->setAddressModeT(Ego::TextureAddressMode::Clamp);
+    retval->texture = std::make_shared<Ego::OpenGL::Texture>();
+    retval->texture->load("font atlas", atlasPtr);
+    retval->texture->setAddressModeS(Ego::TextureAddressMode::Clamp);
+    retval->texture->setAddressModeT(Ego::TextureAddressMode::Clamp);
     return retval;
 }
 
-std::shared_ptr<Font::RenderedTextCache> Font::findInRenderedCache(const std::string &text, int width, int height,
-                                                                   int spacing, bool *update) {
-    if (MAX_CACHE_SIZE == 0) {
-        *update = true;
-        return std::make_shared<RenderedTextCache>();
-    }
-
-    if (MAX_CACHE_SIZE == 1) {
-        *update = true;
-        if (_renderedCache.empty())
-            _renderedCache.emplace_back(std::make_shared<RenderedTextCache>());
-        return _renderedCache[0];
-    }
-
-    std::shared_ptr<Font::RenderedTextCache> cache;
-    bool updateCache = true;
-
-    auto cacheIterator = std::find_if(_renderedCache.begin(), _renderedCache.end(),
-                                      [&](const std::shared_ptr<Font::RenderedTextCache> &ptr) {
-        return ptr->isEquivalent(text, width, height, spacing);
-    });
+std::shared_ptr<Font::LaidTextRenderer> Font::findInRenderedCache(const std::string &text, int width, int height,
+                                                                  int spacing, bool interpretNewlines) {
+    TextCacheKey key = {text, width, height, spacing, interpretNewlines};
+    auto cached = _renderedCache->find(key);
+    if (cached) return *cached;
 
-    if (cacheIterator != _renderedCache.end()) {
-        cache = *cacheIterator;
-        updateCache = false;
-    } else if (_renderedCache.size() < MAX_CACHE_SIZE) {
-        cache = std::make_shared<RenderedTextCache>();
-        _renderedCache.push_back(cache);
-    } else {
-        std::sort(_renderedCache.begin(), _renderedCache.end(), RenderedTextCache::isLessThan);
-        cache = _renderedCache.at(0);
-    }
+    LayoutOptions options;
+    options.maxWidth = width;
+    options.maxHeight = height;
+    options.spacing = spacing;
+    options.interpretNewlines = interpretNewlines;
 
-    if (update) *update = updateCache;
-    return cache;
+    auto laidText = layoutToBuffer(text, options);
+    _renderedCache->insert(key, laidText);
+    return laidText;
 }
 
-std::shared_ptr<Font::SizedTextCache> Font::findInSizedCache(const std::string &text, int spacing, bool *update) {
-    if (MAX_CACHE_SIZE == 0) {
-        *update = true;
-        return std::make_shared<SizedTextCache>();
-    }
-
-    if (MAX_CACHE_SIZE == 1) {
-        *update = true;
-        if (_sizedCache.empty())
-            _sizedCache.emplace_back(std::make_shared<SizedTextCache>());
-        return _sizedCache[0];
-    }
+void Font::findInSizedCache(const std::string &text, int spacing, bool interpretNewlines, int *width, int *height) {
+    TextCacheKey key = {text, 0, 0, spacing, interpretNewlines};
+    auto cached = _sizedCache->find(key);
+    if (!cached) {
+        TextSize size = {0, 0};
 
-    std::shared_ptr<Font::SizedTextCache> cache;
-    bool updateCache = true;
+        LayoutOptions options;
+        options.textWidth = &size.width;
+        options.textHeight = &size.height;
+        options.interpretNewlines = interpretNewlines;
 
-    auto cacheIterator = std::find_if(_sizedCache.begin(), _sizedCache.end(),
-                                      [&](const std::shared_ptr<Font::SizedTextCache> &ptr) {
-        return ptr->isEquivalent(text, spacing);
-    });
+        layout(text, options);
 
-    if (cacheIterator != _sizedCache.end()) {
-        cache = *cacheIterator;
-        updateCache = false;
-    } else if (_sizedCache.size() < MAX_CACHE_SIZE) {
-        cache = std::make_shared<SizedTextCache>();
-        _sizedCache.push_back(cache);
-    } else {
-        std::sort(_sizedCache.begin(), _sizedCache.end(), SizedTextCache::isLessThan);
-        cache = _sizedCache.at(0);
+        _sizedCache->insert(key, size);
+        if (width) *width = size.width;
+        if (height) *height = size.height;
+        return;
     }
 
-    if (update) *update = updateCache;
-    return cache;
+    if (width) *width = cached->width;
+    if (height) *height = cached->height;
 }
 
 uint16_t Font::convertUTF8ToCodepoint(const std::string &string, size_t *pos) {
@@ -65,10 +65,23 @@ public:
         std::shared_ptr<VertexBuffer> _vertexBuffer;
     };
 
+    /**
+     * @brief Counters of the text caches and of glyph rasterization.
+     */
+    struct Statistics {
+        size_t cacheHits = 0;                  ///< Number of lookups served from the text caches.
+        size_t cacheMisses = 0;                ///< Number of lookups that had to lay out the text.
+        size_t cacheEvictions = 0;             ///< Number of least recently used entries dropped.
+        size_t glyphsRasterized = 0;           ///< Number of glyphs rendered by SDL_ttf.
+        uint64_t rasterizationMicroseconds = 0; ///< Time spent in SDL_ttf rendering glyphs.
+
+        Statistics &operator+=(const Statistics &other);
+    };
+
 private:
     /// This is the maximum size for the two caches as used by
     /// drawText and getTextSize, set this to 0 for no caching
-    constexpr static size_t MAX_CACHE_SIZE = 20;
+    constexpr static size_t MAX_CACHE_SIZE = 128;
 
 protected:
     Font(const std::string &fileName, int pointSize);
@@ -117,6 +130,19 @@ public:
     void drawTextToTexture(Ego::Texture *tex, const std::string &text,
                            const Ego::Math::Colour3f &color = Ego::Math::Colour3f::white());
 
+    /**
+     * @brief
+     *  Draw text that only has one line to a surface.
+     * @param text
+     *  the text to draw
+     * @param colour
+     *  the colour of the text (default white)
+     * @return
+     *  the surface, its size is the size of the text
+     */
+    std::shared_ptr<SDL_Surface> drawTextToSurface(const std::string &text,
+                                                   const Ego::Math::Colour3f &color = Ego::Math::Colour3f::white());
+
     /**
      * @brief
      *  Draw text that potentially has multiple lines to a texture.
@@ -219,11 +245,30 @@ public:
     **/
     int getFontHeight() const;
 
+    /**
+     * @brief
+     *  Get the statistics of the last completed frame.
+     * @see endFrame
+     */
+    const Statistics &getStatistics() const;
+
+    /**
+     * @brief
+     *  Finish the statistics of the current frame and start a new frame.
+     */
+    void endFrame();
+
 private:
-    /// Struct for cached text that has been rendered
-    struct RenderedTextCache;
-    /// Struct for cached text that has been sized
-    struct SizedTextCache;
+    /// Key of the text caches
+    struct TextCacheKey;
+    /// A least recently used cache of text indexed by a hash of TextCacheKey
+    template <typename ValueType>
+    class TextCache;
+    /// Value of the sized text cache
+    struct TextSize;
+
+    /// A glyph rasterized by SDL_ttf and its metrics
+    struct Glyph;
 
     struct FontAtlas;
 
@@ -234,28 +279,28 @@ private:
 
     /**
      * @brief
-     *  Find given values in the rendered text cache
+     *  Find laid out text in the rendered text cache, laying it out and caching it if it is not found.
      * @param text,width,height,spacing
      *  The values to look for in the cache
-     * @param update[out]
-     *  Is set to @c true when the returned cached struct needs to be updated with the given values, @c false otherwise
+     * @param interpretNewlines
+     *  If @c false, newlines (<tt>'\\n'</tt>) do not create a new line.
      * @return
-     *  A cached struct that may need to be updated per @a update
+     *  The laid out text
      */
-    std::shared_ptr<RenderedTextCache> findInRenderedCache(const std::string &text, int width, int height,
-                                                           int spacing, bool *update);
+    std::shared_ptr<LaidTextRenderer> findInRenderedCache(const std::string &text, int width, int height,
+                                                          int spacing, bool interpretNewlines);
 
     /**
      * @brief
-     *  Find given values in the sized text cache
+     *  Find the size of text in the sized text cache, measuring it and caching it if it is not found.
      * @param text,spacing
      *  The values to look for in the cache
-     * @param update[out]
-     *  Is @c true when the returned cached struct needs to be updated with the given values, @c false otherwise
-     * @return
-     *  A cached struct that may need to be updated per @a update
+     * @param interpretNewlines
+     *  If @c false, newlines (<tt>'\\n'</tt>) do not create a new line.
+     * @param[out] width,height
+     *  The size of the text (may be nullptr)
      */
-    std::shared_ptr<SizedTextCache> findInSizedCache(const std::string &text, int spacing, bool *update);
+    void findInSizedCache(const std::string &text, int spacing, bool interpretNewlines, int *width, int *height);
 
     /**
      * @brief
@@ -295,8 +340,6 @@ private:
      *  The maximum width of the line, or 0 for no limit
      * @param useNewlines
      *  If @c false, newlines (<tt>'\\n'</tt>) do not create a new line.
-     * @param atlas
-     *  The font atlas to use.
      * @param[out] endPos
      *  The character after the last character in this line
      * @param[out] usedCodepoints
@@ -309,25 +352,37 @@ private:
      *  Height of the line created
      */
     void layoutLine(const std::vector<uint16_t> &codepoints, size_t pos, int maxWidth, bool useNewlines,
-                    const FontAtlas &atlas, size_t *endPos, std::vector<uint16_t> &usedCodepoints,
+                    size_t *endPos, std::vector<uint16_t> &usedCodepoints,
                     std::vector<SDL_Rect> &positions, int *lineWidth, int *lineHeight);
 
     /**
      * @brief
-     *  Creates a texture altas from the given codepoints.
-     * @param chars
-     *  The list of characters to add to the atlas
+     *  Ensures the given codepoints are rasterized and present in the font atlas.
+     * @param codepoints
+     *  The list of codepoints
+     * @remark
+     *  Each glyph is rasterized only once for the lifetime of the font. If any new glyph
+     *  had to be rasterized, the font atlas is rebuilt from the rasterized glyphs.
+     */
+    void addGlyphs(const std::vector<uint16_t> &codepoints);
+
+    /**
+     * @brief
+     *  Creates a texture altas from all rasterized glyphs.
      * @return
      *  The created texture atlas
      */
-    FontAtlas createFontAtlas(const std::vector<uint16_t> &codepoints) const;
+    std::shared_ptr<FontAtlas> createFontAtlas() const;
 
     /**
      * @brief
-     *  Creates a texture atlas from the given UTF-8 characters.
-     * @see createFontAtlas(const std::vector<uint16_t> &)
+     *  Gets the glyph of the given codepoint.
+     * @return
+     *  The glyph or @c nullptr if the font does not provide a glyph for the codepoint
+     * @pre
+     *  The codepoint was added by addGlyphs
      */
-    FontAtlas createFontAtlas(const std::vector<std::string> &chars) const;
+    const Glyph *getGlyph(uint16_t codepoint) const;
 
     /**
      * @brief
@@ -379,9 +434,14 @@ private:
 
     TTF_Font *_ttfFont;
 
-    std::vector<std::shared_ptr<RenderedTextCache>> _renderedCache;
-    std::vector<std::shared_ptr<SizedTextCache>> _sizedCache;
-    std::vector<FontAtlas> _atlases;
+    Statistics _statistics;
+    Statistics _lastFrameStatistics;
+
+    std::unique_ptr<TextCache<std::shared_ptr<LaidTextRenderer>>> _renderedCache;
+    std::unique_ptr<TextCache<TextSize>> _sizedCache;
+    std::unordered_map<uint16_t, Glyph> _glyphs;
+    std::unordered_map<uint32_t, int> _kerning;
+    std::shared_ptr<FontAtlas> _atlas;
 };
 
 } // namespace Ego
@@ -28,7 +28,8 @@
 
 namespace Ego {
 
-FontManager::FontManager() {
+FontManager::FontManager() :
+    _fonts() {
     Log::get().info("[font manager]: SDL_ttf %i.%i.%i\n", SDL_TTF_MAJOR_VERSION, SDL_TTF_MINOR_VERSION, SDL_TTF_PATCHLEVEL);
     if (TTF_Init() < 0) {
         Log::Entry e(Log::Level::Warning, __FILE__, __LINE__);
@@ -45,11 +46,33 @@ FontManager::~FontManager() {
 
 std::shared_ptr<Font> FontManager::loadFont(const std::string &fileName, int pointSize) {
     auto *font = new Font(fileName, pointSize);
+    std::shared_ptr<Font> retval;
     try {
-        return std::shared_ptr<Font>(font);
+        retval = std::shared_ptr<Font>(font);
     } catch (...) {
         delete font;
         std::rethrow_exception(std::current_exception());
     }
+    _fonts.push_back(retval);
+    return retval;
+}
+
+void FontManager::endFrame() {
+    _fonts.erase(std::remove_if(_fonts.begin(), _fonts.end(), [](const std::weak_ptr<Font> &font) {
+        return font.expired();
+    }), _fonts.end());
+    for (const auto &weakFont : _fonts) {
+        auto font = weakFont.lock();
+        if (font) font->endFrame();
+    }
+}
+
+Font::Statistics FontManager::getStatistics() const {
+    Font::Statistics retval;
+    for (const auto &weakFont : _fonts) {
+        auto font = weakFont.lock();
+        if (font) retval += font->getStatistics();
+    }
+    return retval;
 }
 } // namespace Ego
\ No newline at end of file
@@ -34,12 +34,28 @@ class FontManager : public Core::Singleton<FontManager> {
 public:
     std::shared_ptr<Font> loadFont(const std::string &fileName, int pointSize);
 
+    /**
+     * @brief
+     *  Finish the statistics of the current frame of all loaded fonts.
+     * @see Font::endFrame
+     */
+    void endFrame();
+
+    /**
+     * @brief
+     *  Get the statistics of the last completed frame summed over all loaded fonts.
+     */
+    Font::Statistics getStatistics() const;
+
 protected:
     friend Core::Singleton<FontManager>::CreateFunctorType;
     friend Core::Singleton<FontManager>::DestroyFunctorType;
 
     FontManager();
     ~FontManager();
+
+private:
+    std::vector<std::weak_ptr<Font>> _fonts;
 };
 
 } // namespace Ego
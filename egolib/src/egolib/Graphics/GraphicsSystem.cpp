@@ -86,6 +86,24 @@ void GraphicsSystem::initialize() {
     initialized = true;
 }
 
+void GraphicsSystem::initializeHeadless() {
+    if (initialized) {
+        return;
+    }
+    // Download the window parameters from the Egoboo configuration.
+    SDLX_video_parameters_t::download(sdl_vparam, egoboo_config_t::get());
+    sdl_vparam.windowProperties = WindowProperties();
+    sdl_vparam.windowProperties.opengl = false;
+
+    Log::get().info("Opening SDL window without OpenGL...\n");
+    window = new GraphicsWindow(sdl_vparam.windowProperties);
+    window->setSize(sdl_vparam.resolution);
+    gfx_width = (float)gfx_height / (float)sdl_vparam.resolution.height() * (float)sdl_vparam.resolution.width();
+    Log::get().message("Success!\n");
+
+    initialized = true;
+}
+
 void GraphicsSystem::uninitialize() {
     if (!initialized) {
         return;
@@ -25,6 +25,12 @@ public:
      * @remark This method is a no-op if the graphics system is initialized.
      */
     static void initialize();
+    /**
+     * @brief Initialize the graphics system with a window without an OpenGL context.
+     * @remark With the "dummy" video driver of SDL this requires neither a display nor a GPU.
+     * @remark This method is a no-op if the graphics system is initialized.
+     */
+    static void initializeHeadless();
     /**
      * @brief Uninitialize the graphics system.
      * @remark This method is a no-op if the graphics system is uninitialized.
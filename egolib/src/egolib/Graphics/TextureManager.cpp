@@ -92,23 +92,76 @@ End:
 
 //--------------------------------------------------------------------------------------------
 
+namespace {
+
+/**
+ * @brief
+ *  A texture which is never uploaded.
+ *  It is used when there is no renderer e.g. in headless runs where only the size of an image is of interest.
+ */
+struct NullTexture : public Ego::Texture {
+    NullTexture() :
+        Ego::Texture("<null texture>", Ego::TextureType::_2D,
+                     Ego::TextureAddressMode::Repeat, Ego::TextureAddressMode::Repeat,
+                     0, 0, 0, 0, nullptr, false)
+    {}
+
+    bool load(const String& name, const SharedPtr<SDL_Surface>& surface) override {
+        release();
+        _name = name;
+        _width = _sourceWidth = surface->w;
+        _height = _sourceHeight = surface->h;
+        _hasAlpha = nullptr != surface->format && 0 != surface->format->Amask;
+        return true;
+    }
+
+    bool load(const SharedPtr<SDL_Surface>& surface) override {
+        return load("<source>", surface);
+    }
+
+    void release() override {
+        _name = "<null texture>";
+        _width = _sourceWidth = 0;
+        _height = _sourceHeight = 0;
+        _hasAlpha = false;
+    }
+
+    bool isDefault() const override {
+        return 0 == _width;
+    }
+};
+
+} // namespace
+
 namespace Ego {
 TextureManager::TextureManager() :
+    _headless(!Renderer::isInitialized()),
     _deferredLoadingMutex(),
     _requestedLoadDeferredTextures(),
     _notifyDeferredLoadingComplete() {
-    Ego::OpenGL::initializeErrorTextures();
+    if (!_headless) {
+        Ego::OpenGL::initializeErrorTextures();
+    }
 }
 
 TextureManager::~TextureManager() {
     _textureCache.clear();
     _unload.clear();
-    Ego::OpenGL::uninitializeErrorTextures();
+    if (!_headless) {
+        Ego::OpenGL::uninitializeErrorTextures();
+    }
+}
+
+std::shared_ptr<Texture> TextureManager::createTexture() const {
+    if (_headless) {
+        return std::make_shared<NullTexture>();
+    }
+    return std::make_shared<OpenGL::Texture>();
 }
 
 void TextureManager::release_all() {
-    if (SDL_GL_GetCurrentContext() != nullptr) {
-        // We are the main OpenGL context thread so we can destroy textures.
+    if (_headless || SDL_GL_GetCurrentContext() != nullptr) {
+        // We are the main OpenGL context thread (or there is no OpenGL at all) so we can destroy textures.
         _textureCache.clear();
         _unload.clear();
     } else {
@@ -132,7 +185,7 @@ void TextureManager::updateDeferredLoading() {
     {
         std::lock_guard<std::mutex> lock(_deferredLoadingMutex);
         for (const std::string &filePath : _requestedLoadDeferredTextures) {
-            std::shared_ptr<Ego::Texture> loadTexture = std::make_shared<Ego::OpenGL::Texture>();
+            std::shared_ptr<Ego::Texture> loadTexture = createTexture();
             ego_texture_load_vfs(loadTexture, filePath.c_str());
             _textureCache[filePath] = loadTexture;
             //Log::get().debug("Deferred texture load: %s\n", filePath.c_str());
@@ -149,9 +202,9 @@ const std::shared_ptr<Texture>& TextureManager::getTexture(const std::string &fi
     const auto &result = _textureCache.find(filePath);
     if (result == _textureCache.end()) {
 
-        if (SDL_GL_GetCurrentContext() != nullptr) {
-            //We are the main OpenGL context thread so we can load textures
-            std::shared_ptr<Texture> loadTexture = std::make_shared<OpenGL::Texture>();
+        if (_headless || SDL_GL_GetCurrentContext() != nullptr) {
+            //We are the main OpenGL context thread (or there is no OpenGL at all) so we can load textures
+            std::shared_ptr<Texture> loadTexture = createTexture();
             ego_texture_load_vfs(loadTexture, filePath.c_str());
             _textureCache[filePath] = loadTexture;
         } else {
@@ -81,6 +81,15 @@ public:
     void updateDeferredLoading();
 
 private:
+    /**
+     * @brief
+     *  Create an empty texture.
+     *  If there is no renderer, the texture is never uploaded.
+     */
+    std::shared_ptr<Texture> createTexture() const;
+
+    /// @brief @a true if this texture manager was created without a renderer.
+    bool _headless;
     std::forward_list<std::shared_ptr<Texture>> _unload;
     std::unordered_map<std::string, std::shared_ptr<Texture>> _textureCache;
 
@@ -0,0 +1,233 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file  egolib/Log/AsyncTarget.cpp
+/// @brief Log target writing on a background thread
+
+#include "egolib/Log/AsyncTarget.hpp"
+#include <csignal>
+#if defined(ID_WINDOWS)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Log {
+
+const size_t AsyncTarget::CAPACITY;
+
+namespace {
+/// The target which writes its pending records if the program crashes.
+std::atomic<AsyncTarget *> g_crashTarget(nullptr);
+const int g_crashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+const size_t g_numberOfCrashSignals = sizeof(g_crashSignals) / sizeof(g_crashSignals[0]);
+/// The handlers of the crash signals before the crash target installed its handler.
+void (*g_previousHandlers[g_numberOfCrashSignals])(int) = {};
+
+/// Write a string to the standard error stream. Async-signal-safe.
+void writeToStandardError(const char *text) {
+    const size_t length = strlen(text);
+#if defined(ID_WINDOWS)
+    _write(2, text, static_cast<unsigned int>(length));
+#else
+    ssize_t result = ::write(STDERR_FILENO, text, length);
+    (void)result;
+#endif
+}
+
+const char *getPrefix(Level level) {
+    switch (level) {
+    case Level::Error:
+        return "FATAL ERROR: ";
+    case Level::Warning:
+        return "WARNING: ";
+    case Level::Info:
+        return "INFO: ";
+    case Level::Debug:
+        return "DEBUG: ";
+    default:
+        return "";
+    }
+}
+}
+
+AsyncTarget::AsyncTarget(const std::string& filename, Level level, OverflowPolicy overflowPolicy)
+    : DefaultTarget(filename, level), _overflowPolicy(overflowPolicy), _records(new Record[CAPACITY]),
+      _enqueuePosition(0), _dequeuePosition(0), _dropped(0), _droppedReported(0), _drainMutex(),
+      _stop(false), _sleeping(false), _wakeMutex(), _wake(), _writer() {
+    for (size_t i = 0; i < CAPACITY; ++i) {
+        _records[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    _writer = std::thread([this]() { run(); });
+    AsyncTarget *expected = nullptr;
+    if (g_crashTarget.compare_exchange_strong(expected, this)) {
+        for (size_t i = 0; i < g_numberOfCrashSignals; ++i) {
+            g_previousHandlers[i] = std::signal(g_crashSignals[i], &AsyncTarget::onSignal);
+            if (SIG_ERR == g_previousHandlers[i]) {
+                g_previousHandlers[i] = SIG_DFL;
+            }
+        }
+    }
+}
+
+AsyncTarget::~AsyncTarget() {
+    AsyncTarget *expected = this;
+    if (g_crashTarget.compare_exchange_strong(expected, nullptr)) {
+        for (size_t i = 0; i < g_numberOfCrashSignals; ++i) {
+            std::signal(g_crashSignals[i], g_previousHandlers[i]);
+        }
+    }
+    _stop.store(true);
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _wake.notify_one();
+    }
+    _writer.join();
+    flushFile();
+}
+
+void AsyncTarget::writev(Level level, const char *format, va_list args) {
+    // Claim a record.
+    uint64_t position = _enqueuePosition.load(std::memory_order_relaxed);
+    Record *record;
+    while (true) {
+        record = &_records[position % CAPACITY];
+        const uint64_t sequence = record->sequence.load(std::memory_order_acquire);
+        const int64_t difference = static_cast<int64_t>(sequence - position);
+        if (0 == difference) {
+            if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // The ring buffer is full.
+            if (OverflowPolicy::Drop == _overflowPolicy && Level::Error != level) {
+                _dropped++;
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_wakeMutex);
+                _wake.notify_one();
+            }
+            std::this_thread::yield();
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Format into the record and publish it.
+    record->level = level;
+    vsnprintf(record->text, MAX_LOG_MESSAGE - 1, format, args);
+    record->text[MAX_LOG_MESSAGE - 1] = '\0';
+    record->sequence.store(position + 1);
+
+    if (Level::Error == level) {
+        // Errors usually precede the termination of the program.
+        flush();
+    } else if (_sleeping.load()) {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _wake.notify_one();
+    }
+}
+
+bool AsyncTarget::hasPending() {
+    std::lock_guard<std::mutex> lock(_drainMutex);
+    const Record& record = _records[_dequeuePosition % CAPACITY];
+    return record.sequence.load() == _dequeuePosition + 1;
+}
+
+void AsyncTarget::drain() {
+    while (true) {
+        Record& record = _records[_dequeuePosition % CAPACITY];
+        if (record.sequence.load(std::memory_order_acquire) != _dequeuePosition + 1) {
+            break;
+        }
+        write(record.level, record.text);
+        // Free the record for the producer one round ahead.
+        record.sequence.store(_dequeuePosition + CAPACITY, std::memory_order_release);
+        _dequeuePosition++;
+    }
+    const size_t dropped = _dropped.load(std::memory_order_relaxed);
+    if (dropped != _droppedReported) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%" PRIuZ " log messages dropped\n", dropped - _droppedReported);
+        write(Level::Warning, buffer);
+        _droppedReported = dropped;
+    }
+}
+
+void AsyncTarget::run() {
+    while (true) {
+        // Records published before the stop request are written by the last drain.
+        const bool stop = _stop.load();
+        {
+            std::lock_guard<std::mutex> lock(_drainMutex);
+            drain();
+        }
+        if (stop) {
+            break;
+        }
+        std::unique_lock<std::mutex> lock(_wakeMutex);
+        _sleeping.store(true);
+        if (!hasPending() && !_stop.load()) {
+            // Producers only notify a sleeping writer, the timeout bounds the delay of a missed notification.
+            _wake.wait_for(lock, std::chrono::milliseconds(50));
+        }
+        _sleeping.store(false);
+    }
+}
+
+void AsyncTarget::flush() {
+    std::lock_guard<std::mutex> lock(_drainMutex);
+    drain();
+    flushFile();
+}
+
+size_t AsyncTarget::getNumberOfDroppedMessages() const {
+    return _dropped.load(std::memory_order_relaxed);
+}
+
+void AsyncTarget::onSignal(int signal) {
+    AsyncTarget *target = g_crashTarget.exchange(nullptr);
+    // Only async-signal-safe calls are made: the records are already formatted and are written to the
+    // standard error stream with write(2). The log file can not be written, as vfs_puts() allocates and locks.
+    // If the crashing thread holds the lock, the records are lost.
+    if (target && target->_drainMutex.try_lock()) {
+        while (true) {
+            Record& record = target->_records[target->_dequeuePosition % CAPACITY];
+            if (record.sequence.load(std::memory_order_acquire) != target->_dequeuePosition + 1) {
+                break;
+            }
+            writeToStandardError(getPrefix(record.level));
+            writeToStandardError(record.text);
+            target->_dequeuePosition++;
+        }
+        target->_drainMutex.unlock();
+    }
+    // Chain to the handler installed before the crash target, the default handler if there was none.
+    for (size_t i = 0; i < g_numberOfCrashSignals; ++i) {
+        if (g_crashSignals[i] == signal) {
+            std::signal(signal, g_previousHandlers[i]);
+            break;
+        }
+    }
+    std::raise(signal);
+}
+
+} // namespace Log
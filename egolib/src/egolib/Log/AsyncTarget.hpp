@@ -0,0 +1,120 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file  egolib/Log/AsyncTarget.hpp
+/// @brief Log target writing on a background thread
+
+#pragma once
+
+#include "egolib/Log/DefaultTarget.hpp"
+
+namespace Log {
+
+/**
+ * @brief
+ *  A log target which writes to the log file and the console on a background thread.
+ * @details
+ *  Log messages are formatted on the calling thread into a bounded ring buffer of records. The
+ *  ring buffer accepts records from any number of threads without locks, a single writer thread
+ *  drains it in order. Error messages are written before the call returns.
+ *
+ *  All pending records are written when the target is destroyed and when flush() is called. If the
+ *  program crashes (SIGSEGV, SIGABRT, SIGFPE and SIGILL), they are written, as far as possible, to the
+ *  standard error stream, and the signal is passed on to the handler installed before.
+ */
+struct AsyncTarget : DefaultTarget {
+public:
+    /**
+     * @brief
+     *  What to do with a log message if the ring buffer is full.
+     */
+    enum class OverflowPolicy {
+        /// Discard the message. The number of discarded messages is logged later on.
+        Drop,
+        /// Wait until the writer thread made room for the message.
+        Block,
+    };
+
+    /// The number of records of the ring buffer.
+    static const size_t CAPACITY = 512;
+
+private:
+    struct Record {
+        /// Equals the enqueue position of the record if it is free, and the position plus one if it is published.
+        std::atomic<uint64_t> sequence;
+        Level level;
+        char text[MAX_LOG_MESSAGE];
+    };
+
+    OverflowPolicy _overflowPolicy;
+    std::unique_ptr<Record[]> _records;
+    /// The position of the next record to claim by a producer.
+    std::atomic<uint64_t> _enqueuePosition;
+    /// The position of the next record to write. Guarded by _drainMutex.
+    uint64_t _dequeuePosition;
+    std::atomic<size_t> _dropped;
+    size_t _droppedReported;
+    std::mutex _drainMutex;
+
+    std::atomic<bool> _stop;
+    std::atomic<bool> _sleeping;
+    std::mutex _wakeMutex;
+    std::condition_variable _wake;
+    std::thread _writer;
+
+    /// Get if a record is published and not written yet.
+    bool hasPending();
+    /// Write all published records. The caller must hold _drainMutex.
+    void drain();
+    void run();
+    static void onSignal(int signal);
+
+public:
+    /**
+     * @brief
+     *  Construct this log target.
+     * @param filename
+     *  the log file name
+     * @param level
+     *  the log level
+     * @param overflowPolicy
+     *  what to do with log messages if the ring buffer is full
+     * @throw std::runtime_error
+     *  if the log file can not be opened
+     */
+    AsyncTarget(const std::string& filename, Level level = Level::Warning, OverflowPolicy overflowPolicy = OverflowPolicy::Block);
+    /**
+     * @brief
+     *  Destruct this log target. Pending records are written before.
+     */
+    virtual ~AsyncTarget();
+    void writev(Level level, const char *format, va_list args) override;
+    /**
+     * @brief
+     *  Write all pending records and flush the log file on the calling thread.
+     */
+    void flush();
+    /**
+     * @brief
+     *  Get the number of log messages discarded because the ring buffer was full.
+     */
+    size_t getNumberOfDroppedMessages() const;
+};
+
+} // namespace Log
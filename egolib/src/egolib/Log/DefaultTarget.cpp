@@ -27,7 +27,7 @@
 
 namespace Log {
 
-static constexpr size_t MAX_LOG_MESSAGE = 1024; ///< Max length of log messages.
+const size_t DefaultTarget::MAX_LOG_MESSAGE;
 
 DefaultTarget::DefaultTarget(const std::string& filename, Level level)
 	: Target(level) {
@@ -47,6 +47,13 @@ DefaultTarget::~DefaultTarget() {
 void DefaultTarget::writev(Level level, const char *format, va_list args) {
 	char logBuffer[MAX_LOG_MESSAGE] = EMPTY_CSTR;
 
+	// Build log message
+	vsnprintf(logBuffer, MAX_LOG_MESSAGE - 1, format, args);
+
+	write(level, logBuffer);
+}
+
+void DefaultTarget::write(Level level, const char *text) {
 	// Add prefix
 	const char *prefix;
 	switch (level) {
@@ -77,22 +84,26 @@ void DefaultTarget::writev(Level level, const char *format, va_list args) {
 		break;
 	}
 
-	// Build log message
-	vsnprintf(logBuffer, MAX_LOG_MESSAGE - 1, format, args);
-
 	if (nullptr != _file)
 	{
 		// Log to file
 		vfs_puts(prefix, _file);
-		vfs_puts(logBuffer, _file);
+		vfs_puts(text, _file);
 	}
 
 	// Log to console
 	fputs(prefix, stdout);
-	fputs(logBuffer, stdout);
+	fputs(text, stdout);
 
 	// Restore default color
 	setConsoleColor(ConsoleColor::Default);
 }
 
+void DefaultTarget::flushFile() {
+	if (nullptr != _file) {
+		vfs_flush(_file);
+	}
+	fflush(stdout);
+}
+
 } // namespace Log
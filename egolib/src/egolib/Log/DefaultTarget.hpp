@@ -34,7 +34,25 @@ private:
 	*  The log file.
 	*/
 	vfs_FILE *_file;
+protected:
+	/**
+	* @brief
+	*  Write a formatted log message to the log file and the console.
+	* @param level
+	*  the log level
+	* @param text
+	*  the message
+	*/
+	void write(Level level, const char *text);
+	/**
+	* @brief
+	*  Flush the log file.
+	*/
+	void flushFile();
 public:
+	/// Max length of log messages.
+	static const size_t MAX_LOG_MESSAGE = 1024;
+
 	DefaultTarget(const std::string& filename, Level level = Level::Warning);
 	virtual ~DefaultTarget();
 	void writev(Level level, const char *format, va_list args) override;
@@ -60,6 +60,19 @@ public:
      *  the log level
      */
     Level getLevel() const;
+    /**
+     * @brief
+     *  Get if log messages on the specified log level are written.
+     * @param level
+     *  the log level
+     * @return
+     *  @a true if log messages on the specified log level are written, @a false otherwise
+     * @remark
+     *  Check this before building expensive log messages (e.g. log entries) which might be discarded.
+     */
+    bool isEnabled(Level level) const {
+        return _level >= level;
+    }
     /**
      * @brief
      *  Write a log message on the specified log level.
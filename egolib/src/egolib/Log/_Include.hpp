@@ -27,6 +27,11 @@
 #include "egolib/Log/Target.hpp"
 #include "egolib/Log/Level.hpp"
 
+#if !defined(EGOLIB_LOG_LEVEL)
+	/// The most verbose log level compiled in, as a number (see Log::Level). Default is Log::Level::Debug.
+	#define EGOLIB_LOG_LEVEL 4
+#endif
+
 namespace Log {
 
 	/**
@@ -61,4 +66,32 @@ namespace Log {
 	 */
 	Target& get();
 
+	/**
+	 * @brief
+	 *  Get if log messages on the specified log level are written by the default target.
+	 * @param level
+	 *  the log level
+	 * @return
+	 *  @a true if log messages on the specified log level are written, @a false otherwise
+	 * @remark
+	 *  Log levels more verbose than EGOLIB_LOG_LEVEL are rejected at compile-time.
+	 * @throw std::logic_error
+	 *  if the logging system is not initialized
+	 */
+	inline bool isEnabled(Level level) {
+		return static_cast<int>(level) <= EGOLIB_LOG_LEVEL && get().isEnabled(level);
+	}
+
 } // namespace Log
+
+/**
+ * @brief
+ *  Write a printf-style log message to the default target on the specified log level.
+ *  The arguments are not evaluated if the log level is disabled.
+ */
+#define EGO_LOG(level, ...) \
+	do { \
+		if (Log::isEnabled(level)) { \
+			Log::get().log(level, __VA_ARGS__); \
+		} \
+	} while (0)
@@ -25,6 +25,7 @@
 
 #include "egolib/typedef.h"
 #include "egolib/Math/TemplateUtilities.hpp"
+#include "egolib/Math/Simd.hpp"
 
 /// @brief Egoboo uses a row-major matrix layout.
 #define Ego_Math_Matrix_Layout_RowMajor (1)
@@ -144,7 +145,7 @@ struct Matrix<_ElementType, _NumberOfRows, _NumberOfColumns,
 
     union {
         /**@{*/
-        _ElementType _v[numberOfElements()];
+        alignas(Internal::SimdAlignment<_ElementType, numberOfElements()>::value) _ElementType _v[numberOfElements()];
         /**
          * @brief
          *  The union of a two-dimensional array and a one-dimensional array.
@@ -533,6 +534,24 @@ public:
     template <size_t _OtherNumberOfColumns>
     Matrix<ElementType, _NumberOfRows, _OtherNumberOfColumns>
     mul(const Matrix<ElementType, _NumberOfColumns, _OtherNumberOfColumns>& other) const {
+        // The product of 4x4 matrices has a SIMD kernel.
+        using IsAccelerated = std::integral_constant<bool, Internal::Simd<ElementType, 4>::isAccelerated &&
+                                                           4 == _NumberOfRows && 4 == _NumberOfColumns && 4 == _OtherNumberOfColumns>;
+        return mul(other, IsAccelerated{});
+    }
+
+private:
+    template <size_t _OtherNumberOfColumns>
+    Matrix<ElementType, _NumberOfRows, _OtherNumberOfColumns>
+    mul(const Matrix<ElementType, _NumberOfColumns, _OtherNumberOfColumns>& other, std::true_type) const {
+        Matrix<ElementType, _NumberOfRows, _OtherNumberOfColumns> result;
+        Internal::Simd<ElementType, 4>::multiplyMatrix(_v, other._v, result._v);
+        return result;
+    }
+
+    template <size_t _OtherNumberOfColumns>
+    Matrix<ElementType, _NumberOfRows, _OtherNumberOfColumns>
+    mul(const Matrix<ElementType, _NumberOfColumns, _OtherNumberOfColumns>& other, std::false_type) const {
         Matrix<ElementType, _NumberOfRows, _OtherNumberOfColumns> result;
         for (size_t i = 0; i < _NumberOfRows; ++i) {
             for (size_t j = 0; j < _OtherNumberOfColumns; ++j) {
@@ -544,6 +563,8 @@ public:
         return result;
     }
 
+public:
+
     /**
      * Overloaded multiplication operator.
      */
@@ -23,29 +23,36 @@
 
 #include "egolib/Math/Random.hpp"
 
-// Static data initializer
-std::random_device rd;
-std::mt19937 Random::generator = std::mt19937(time(nullptr));
+namespace {
+/// The seed from which the default streams of the threads are derived.
+std::atomic<uint64_t> g_seed(static_cast<uint64_t>(time(nullptr)));
+/// The number of default streams created so far.
+std::atomic<uint64_t> g_defaultStreams(0);
+}
+
+RandomStream& Random::getDefaultStream()
+{
+    static thread_local RandomStream stream = RandomStream(g_seed.load()).derive(g_defaultStreams++);
+    return stream;
+}
 
 void Random::setSeed(const long seed)
 {
-    generator.seed(seed);
+    g_seed.store(static_cast<uint64_t>(seed));
+    getDefaultStream() = RandomStream(static_cast<uint64_t>(seed));
 }
 
 float Random::nextFloat()
 {
-    static std::uniform_real_distribution<float> rand(0.0f, std::nextafter(1.0f, std::numeric_limits<float>::max()));
-    return rand(generator);
+    return getDefaultStream().nextFloat();
 }
 
 int Random::getPercent()
 {
-	static std::uniform_int_distribution<int> rand(1, 100);
-    return rand(generator);
+    return getDefaultStream().getPercent();
 }
 
 bool Random::nextBool()
 {
-    std::bernoulli_distribution rand(0.5);
-    return rand(generator);
+    return getDefaultStream().nextBool();
 }
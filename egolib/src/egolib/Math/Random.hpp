@@ -25,8 +25,16 @@
 
 #include "egolib/platform.h"
 #include "egolib/Math/Interval.hpp"
+#include "egolib/Math/RandomStream.hpp"
 #include "egolib/typedef.h"
 
+/**
+ * @brief
+ *  Random numbers drawn from the default random stream of the calling thread.
+ * @remark
+ *  Code whose results must not depend on the order in which it is run e.g. the updates of objects and
+ *  particles should draw from the random streams of the entities instead.
+ */
 class Random
 {
 public:
@@ -45,10 +53,7 @@ public:
      */
     static float next(const Ego::Math::Interval<float>& interval)
     {
-        float min = interval.getLowerbound();
-        float max = std::nextafter(interval.getUpperbound(), std::numeric_limits<float>::max());
-        std::uniform_real_distribution<float> distribution(min, max);
-        return distribution(generator);
+        return getDefaultStream().next(interval);
     }
     
     /**
@@ -88,16 +93,7 @@ public:
                       std::is_same<T, unsigned long>::value || std::is_same<T, unsigned long long>::value,
                       "T must be one of short, int, long, long long, unsigned short, "
                       "unsigned int, unsigned long, or unsigned long long");
-        if (low > high)
-        {
-            throw std::invalid_argument("low > high");
-        }
-        if (low == high)
-        {
-            return low;
-        }
-        std::uniform_int_distribution<T> rand(low, high);
-        return rand(generator);
+        return getDefaultStream().next<T>(low, high);
     }
 
 	/**
@@ -121,9 +117,18 @@ public:
      *  Sets the random seed used for randomization.
      * @param seed
      *  the seed
+     * @remark
+     *  The default stream of the calling thread is reset to the stream of the seed. The default streams of
+     *  other threads are derived from the seed at the time of their first use.
      */
     static void setSeed(const long seed);
 
+    /**
+     * @brief
+     *  Get the default random stream of the calling thread.
+     */
+    static RandomStream& getDefaultStream();
+
     /**
      * @brief
      *  Returns a reference to a random element in a vector.
@@ -150,12 +155,4 @@ public:
         return container[ Random::next<size_t>(container.size()-1) ];
     }
 
-private:
-
-    /**
-     * @brief
-     *  Mersenne Twister randomizer.
-     */
-    static std::mt19937 generator;
-
 };
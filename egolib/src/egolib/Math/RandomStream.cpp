@@ -0,0 +1,114 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Math/RandomStream.cpp
+/// @brief  Counter-based, splittable streams of random numbers
+
+#include "egolib/Math/RandomStream.hpp"
+
+RandomStream::RandomStream(uint64_t key) :
+    _key(key), _position(0), _block(), _blockIndex(std::numeric_limits<uint64_t>::max())
+{}
+
+std::array<uint32_t, 4> RandomStream::philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key)
+{
+    static const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    static const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+    for (int round = 0; round < 10; ++round)
+    {
+        if (round > 0)
+        {
+            key[0] += W0;
+            key[1] += W1;
+        }
+        const uint64_t product0 = static_cast<uint64_t>(M0) * counter[0];
+        const uint64_t product1 = static_cast<uint64_t>(M1) * counter[2];
+        counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(product1),
+                   static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(product0)};
+    }
+    return counter;
+}
+
+RandomStream RandomStream::derive(uint64_t id) const
+{
+    // Drawn numbers use counters with zero upper words, so these counters are never drawn.
+    const auto block = philox({static_cast<uint32_t>(id), static_cast<uint32_t>(id >> 32), 0xFFFFFFFF, 0xFFFFFFFF},
+                              {static_cast<uint32_t>(_key), static_cast<uint32_t>(_key >> 32)});
+    return RandomStream(static_cast<uint64_t>(block[0]) | (static_cast<uint64_t>(block[1]) << 32));
+}
+
+RandomStream::result_type RandomStream::operator()()
+{
+    const uint64_t blockIndex = _position / 4;
+    if (blockIndex != _blockIndex)
+    {
+        _block = philox({static_cast<uint32_t>(blockIndex), static_cast<uint32_t>(blockIndex >> 32), 0, 0},
+                        {static_cast<uint32_t>(_key), static_cast<uint32_t>(_key >> 32)});
+        _blockIndex = blockIndex;
+    }
+    return _block[_position++ % 4];
+}
+
+uint64_t RandomStream::nextUpTo(uint64_t range)
+{
+    if (0 == range)
+    {
+        return 0;
+    }
+    if (range <= std::numeric_limits<uint32_t>::max())
+    {
+        // Reject the numbers of the incomplete last interval.
+        const uint32_t bound = static_cast<uint32_t>(range) + 1;
+        const uint32_t threshold = bound ? (0u - bound) % bound : 0;
+        while (true)
+        {
+            const uint32_t number = (*this)();
+            if (number >= threshold)
+            {
+                return bound ? number % bound : number;
+            }
+        }
+    }
+    const uint64_t bound = range + 1;
+    const uint64_t threshold = bound ? (0ull - bound) % bound : 0;
+    while (true)
+    {
+        const uint64_t number = static_cast<uint64_t>((*this)()) | (static_cast<uint64_t>((*this)()) << 32);
+        if (number >= threshold)
+        {
+            return bound ? number % bound : number;
+        }
+    }
+}
+
+float RandomStream::nextFloat()
+{
+    // 24 bits, as many as a float has.
+    return static_cast<float>((*this)() >> 8) * (1.0f / static_cast<float>(0xFFFFFF));
+}
+
+bool RandomStream::nextBool()
+{
+    return 0 != ((*this)() >> 31);
+}
+
+int RandomStream::getPercent()
+{
+    return next<int>(1, 100);
+}
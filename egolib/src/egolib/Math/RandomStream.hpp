@@ -0,0 +1,149 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Math/RandomStream.hpp
+/// @brief  Counter-based, splittable streams of random numbers
+
+#pragma once
+
+#include "egolib/platform.h"
+#include "egolib/Math/Interval.hpp"
+#include "egolib/typedef.h"
+
+/**
+ * @brief
+ *  A stream of random numbers identified by a 64 bit key.
+ * @details
+ *  The <tt>i</tt>-th number of a stream is computed from the key and @a i alone by the Philox4x32-10
+ *  block function, so streams are cheap to create and independent of each other. A stream derives
+ *  further streams by an identifier e.g. a module stream derives one stream per object, which yields
+ *  the same numbers no matter in which order or on which thread the objects draw them.
+ *  The mapping of numbers to ranges is implemented here rather than by the standard distributions,
+ *  so the results are the same on all platforms.
+ */
+class RandomStream
+{
+public:
+    using result_type = uint32_t;
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    /**
+     * @brief
+     *  Construct the stream of a key, positioned at its first number.
+     */
+    explicit RandomStream(uint64_t key = 0);
+
+    /**
+     * @brief
+     *  Derive a stream. The same stream and identifier always derive the same stream, regardless of
+     *  the numbers drawn from this stream.
+     */
+    RandomStream derive(uint64_t id) const;
+
+    /**
+     * @brief
+     *  Draw the next 32 random bits.
+     */
+    result_type operator()();
+
+    uint64_t getKey() const { return _key; }
+
+    /**
+     * @brief
+     *  Get the number of 32 bit numbers drawn from this stream.
+     */
+    uint64_t getPosition() const { return _position; }
+    void setPosition(uint64_t position) { _position = position; }
+
+    /**
+     * @brief
+     *  Generate a random floating point number in the interval <tt>[0,1]</tt>.
+     */
+    float nextFloat();
+
+    /**
+     * @brief
+     *  Generate a random floating point number in the interval <tt>[interval.getLowerbound(),interval.getUpperbound()]</tt>.
+     */
+    float next(const Ego::Math::Interval<float>& interval)
+    {
+        return interval.getLowerbound() + nextFloat() * (interval.getUpperbound() - interval.getLowerbound());
+    }
+
+    /**
+     * @brief
+     *  Generate an integer number in the interval <tt>[0,high]</tt>.
+     * @pre
+     *  <tt>high >= 0</tt>
+     */
+    template<typename T>
+    T next(const T high)
+    {
+        return next<T>(0, high);
+    }
+
+    /**
+     * @brief
+     *  Generate an integer number in the interval <tt>[low,high]</tt>.
+     * @throw std::invalid_argument
+     *  if <tt>low > high</tt>
+     */
+    template<typename T>
+    T next(const T low, const T high)
+    {
+        static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "T must be an integer type");
+        if (low > high)
+        {
+            throw std::invalid_argument("low > high");
+        }
+        // The difference in two's complement arithmetic, 2^64 - 1 at most.
+        const uint64_t range = static_cast<uint64_t>(high) - static_cast<uint64_t>(low);
+        return static_cast<T>(static_cast<uint64_t>(low) + nextUpTo(range));
+    }
+
+    /**
+     * @brief
+     *  Randomly returns @a true or @a false.
+     */
+    bool nextBool();
+
+    /**
+     * @brief
+     *  Generates a random integer number in the interval <tt>[1,100]</tt>.
+     */
+    int getPercent();
+
+    /**
+     * @brief
+     *  The Philox4x32-10 block function.
+     */
+    static std::array<uint32_t, 4> philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key);
+
+private:
+    /// Generate an integer number in the interval <tt>[0,range]</tt> without bias.
+    uint64_t nextUpTo(uint64_t range);
+
+    uint64_t _key;
+    uint64_t _position;
+    /// The numbers of the block @a _blockIndex.
+    std::array<uint32_t, 4> _block;
+    uint64_t _blockIndex;
+};
@@ -0,0 +1,245 @@
+//********************************************************************************************
+//*
+//*  This file is part of Egoboo.
+//*
+//*  Egoboo is free software: you can redistribute it and/or modify it
+//*  under the terms of the GNU General Public License as published by
+//*  the Free Software Foundation, either version 3 of the License, or
+//*  (at your option) any later version.
+//*
+//*  Egoboo is distributed in the hope that it will be useful, but
+//*  WITHOUT ANY WARRANTY; without even the implied warranty of
+//*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*  General Public License for more details.
+//*
+//*  You should have received a copy of the GNU General Public License
+//*  along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Math/Simd.hpp
+/// @brief  SIMD kernels for the single-precision 3, 4 and 4x4 cases of the vector and matrix templates.
+/// @details
+/// The kernels are used by the vector and matrix templates if @a EGO_MATH_SIMD is @a 1. It defaults to
+/// @a 1 if the target supports SSE2. If @a EGO_MATH_SIMD_AVX is @a 1 (default if the target supports AVX)
+/// matrix products and batched transforms process two rows/vectors at a time.
+/// The kernels perform the same operations in the same order as the generic templates, so their
+/// results are identical. @a EGO_MATH_SIMD_FMA (default @a 0) uses fused multiply-adds in transforms
+/// and matrix products instead, which round differently.
+
+#pragma once
+
+#include "egolib/platform.h"
+
+#if !defined(EGO_MATH_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define EGO_MATH_SIMD (1)
+    #else
+        #define EGO_MATH_SIMD (0)
+    #endif
+#endif
+
+#if !defined(EGO_MATH_SIMD_AVX)
+    #if EGO_MATH_SIMD && defined(__AVX__)
+        #define EGO_MATH_SIMD_AVX (1)
+    #else
+        #define EGO_MATH_SIMD_AVX (0)
+    #endif
+#endif
+
+#if !defined(EGO_MATH_SIMD_FMA)
+    #define EGO_MATH_SIMD_FMA (0)
+#endif
+
+#if EGO_MATH_SIMD
+    #include <emmintrin.h>
+#endif
+#if EGO_MATH_SIMD_AVX || EGO_MATH_SIMD_FMA
+    #include <immintrin.h>
+#endif
+
+namespace Ego {
+namespace Math {
+namespace Internal {
+
+/**
+ * @brief
+ *  The alignment of the storage of @a _Size elements of type @a _ElementType.
+ *  Storage of a multiple of four floats is aligned to 16 bytes if SIMD is enabled.
+ */
+template <typename _ElementType, size_t _Size>
+struct SimdAlignment
+    : public std::integral_constant<size_t,
+                                    (EGO_MATH_SIMD && std::is_same<_ElementType, float>::value && 0 == _Size % 4)
+                                    ? 16 : alignof(_ElementType)>
+{};
+
+/**
+ * @brief
+ *  The SIMD kernels for @a _Size elements of type @a _ElementType.
+ *  The kernels load and store unaligned, as heap storage is not guaranteed to be aligned.
+ * @remark
+ *  Only the specializations for which @a isAccelerated is @a true provide kernels.
+ */
+template <typename _ElementType, size_t _Size, typename _Enabled = void>
+struct Simd {
+    static constexpr bool isAccelerated = false;
+};
+
+#if EGO_MATH_SIMD
+
+template <size_t _Size>
+struct Simd<float, _Size, std::enable_if_t<3 == _Size || 4 == _Size>> {
+    static constexpr bool isAccelerated = true;
+
+    static __m128 load(const float *x) {
+        return load(x, std::integral_constant<size_t, _Size>{});
+    }
+
+    static void store(float *x, __m128 v) {
+        store(x, v, std::integral_constant<size_t, _Size>{});
+    }
+
+    /// <tt>x := x + y</tt>
+    static void add(float *x, const float *y) {
+        store(x, _mm_add_ps(load(x), load(y)));
+    }
+
+    /// <tt>x := x - y</tt>
+    static void subtract(float *x, const float *y) {
+        store(x, _mm_sub_ps(load(x), load(y)));
+    }
+
+    /// <tt>x := x * s</tt>
+    static void multiply(float *x, float s) {
+        store(x, _mm_mul_ps(load(x), _mm_set1_ps(s)));
+    }
+
+    /// The dot product, summed from the first to the last element.
+    static float dot(const float *x, const float *y) {
+        const __m128 p = _mm_mul_ps(load(x), load(y));
+        __m128 t = _mm_add_ss(_mm_setzero_ps(), p);
+        t = _mm_add_ss(t, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)));
+        t = _mm_add_ss(t, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)));
+        if (4 == _Size) {
+            t = _mm_add_ss(t, _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)));
+        }
+        return _mm_cvtss_f32(t);
+    }
+
+    /// <tt>z := x \times y</tt> (three elements only)
+    static void cross(const float *x, const float *y, float *z) {
+        static_assert(3 == _Size, "the cross product is defined for three elements only");
+        const __m128 a = load(x), b = load(y);
+        const __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 a_zxy = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+        const __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 b_zxy = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+        store(z, _mm_sub_ps(_mm_mul_ps(a_yzx, b_zxy), _mm_mul_ps(a_zxy, b_yzx)));
+    }
+
+    /// <tt>z := a * b</tt> of two row-major 4x4 matrices (four elements only)
+    static void multiplyMatrix(const float *a, const float *b, float *z) {
+        static_assert(4 == _Size, "matrix products are defined for 4x4 matrices only");
+    #if EGO_MATH_SIMD_AVX
+        // Rows i and i + 1 at a time, row k of b in both halves.
+        const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 0));
+        const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 4));
+        const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 8));
+        const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 12));
+        for (size_t i = 0; i < 4; i += 2) {
+            const float *r0 = a + 4 * i, *r1 = r0 + 4;
+            __m256 t = _mm256_setzero_ps();
+            t = madd(_mm256_setr_m128(_mm_set1_ps(r0[0]), _mm_set1_ps(r1[0])), b0, t);
+            t = madd(_mm256_setr_m128(_mm_set1_ps(r0[1]), _mm_set1_ps(r1[1])), b1, t);
+            t = madd(_mm256_setr_m128(_mm_set1_ps(r0[2]), _mm_set1_ps(r1[2])), b2, t);
+            t = madd(_mm256_setr_m128(_mm_set1_ps(r0[3]), _mm_set1_ps(r1[3])), b3, t);
+            _mm256_storeu_ps(z + 4 * i, t);
+        }
+    #else
+        const __m128 b0 = _mm_loadu_ps(b + 0), b1 = _mm_loadu_ps(b + 4), b2 = _mm_loadu_ps(b + 8), b3 = _mm_loadu_ps(b + 12);
+        for (size_t i = 0; i < 4; ++i) {
+            const float *r = a + 4 * i;
+            __m128 t = _mm_setzero_ps();
+            t = madd(_mm_set1_ps(r[0]), b0, t);
+            t = madd(_mm_set1_ps(r[1]), b1, t);
+            t = madd(_mm_set1_ps(r[2]), b2, t);
+            t = madd(_mm_set1_ps(r[3]), b3, t);
+            _mm_storeu_ps(z + 4 * i, t);
+        }
+    #endif
+    }
+
+    /// <tt>y := m * x</tt> for @a count vectors of a row-major 4x4 matrix (four elements only)
+    static void transform(const float *m, const float *x, float *y, size_t count) {
+        static_assert(4 == _Size, "transforms are defined for 4x4 matrices only");
+        // The columns of the matrix.
+        __m128 c0 = _mm_loadu_ps(m + 0), c1 = _mm_loadu_ps(m + 4), c2 = _mm_loadu_ps(m + 8), c3 = _mm_loadu_ps(m + 12);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+        size_t i = 0;
+    #if EGO_MATH_SIMD_AVX
+        const __m256 d0 = _mm256_setr_m128(c0, c0), d1 = _mm256_setr_m128(c1, c1),
+                     d2 = _mm256_setr_m128(c2, c2), d3 = _mm256_setr_m128(c3, c3);
+        for (; i + 2 <= count; i += 2) {
+            const float *v = x + 4 * i, *w = v + 4;
+            __m256 t = _mm256_mul_ps(d0, _mm256_setr_m128(_mm_set1_ps(v[0]), _mm_set1_ps(w[0])));
+            t = madd(d1, _mm256_setr_m128(_mm_set1_ps(v[1]), _mm_set1_ps(w[1])), t);
+            t = madd(d2, _mm256_setr_m128(_mm_set1_ps(v[2]), _mm_set1_ps(w[2])), t);
+            t = madd(d3, _mm256_setr_m128(_mm_set1_ps(v[3]), _mm_set1_ps(w[3])), t);
+            _mm256_storeu_ps(y + 4 * i, t);
+        }
+    #endif
+        for (; i < count; ++i) {
+            const float *v = x + 4 * i;
+            __m128 t = _mm_mul_ps(c0, _mm_set1_ps(v[0]));
+            t = madd(c1, _mm_set1_ps(v[1]), t);
+            t = madd(c2, _mm_set1_ps(v[2]), t);
+            t = madd(c3, _mm_set1_ps(v[3]), t);
+            _mm_storeu_ps(y + 4 * i, t);
+        }
+    }
+
+private:
+    static __m128 load(const float *x, std::integral_constant<size_t, 4>) {
+        return _mm_loadu_ps(x);
+    }
+
+    static __m128 load(const float *x, std::integral_constant<size_t, 3>) {
+        // Do not read past the third element.
+        return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(x))), _mm_load_ss(x + 2));
+    }
+
+    static void store(float *x, __m128 v, std::integral_constant<size_t, 4>) {
+        _mm_storeu_ps(x, v);
+    }
+
+    static void store(float *x, __m128 v, std::integral_constant<size_t, 3>) {
+        _mm_store_sd(reinterpret_cast<double *>(x), _mm_castps_pd(v));
+        _mm_store_ss(x + 2, _mm_movehl_ps(v, v));
+    }
+
+    /// <tt>a * b + c</tt>
+    static __m128 madd(__m128 a, __m128 b, __m128 c) {
+    #if EGO_MATH_SIMD_FMA
+        return _mm_fmadd_ps(a, b, c);
+    #else
+        return _mm_add_ps(c, _mm_mul_ps(a, b));
+    #endif
+    }
+
+#if EGO_MATH_SIMD_AVX
+    static __m256 madd(__m256 a, __m256 b, __m256 c) {
+    #if EGO_MATH_SIMD_FMA
+        return _mm256_fmadd_ps(a, b, c);
+    #else
+        return _mm256_add_ps(c, _mm256_mul_ps(a, b));
+    #endif
+    }
+#endif
+};
+
+#endif
+
+} // namespace Internal
+} // namespace Math
+} // namespace Ego
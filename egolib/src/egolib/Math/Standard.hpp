@@ -422,10 +422,14 @@ struct Utilities {
      *  where \f$r_i\f$ is the $i$-th row of the matrix.
      */
     static void transform(const Matrix4f4f& m, const Vector4f& source, Vector4f& target) {
+    #if EGO_MATH_SIMD
+        Ego::Math::Internal::Simd<float, 4>::transform(m._v, source.data(), target.data(), 1);
+    #else
         target[kX] = m(0, 0) * source[kX] + m(0, 1) * source[kY] + m(0, 2) * source[kZ] + m(0, 3) * source[kW];
         target[kY] = m(1, 0) * source[kX] + m(1, 1) * source[kY] + m(1, 2) * source[kZ] + m(1, 3) * source[kW];
         target[kZ] = m(2, 0) * source[kX] + m(2, 1) * source[kY] + m(2, 2) * source[kZ] + m(2, 3) * source[kW];
         target[kW] = m(3, 0) * source[kX] + m(3, 1) * source[kY] + m(3, 2) * source[kZ] + m(3, 3) * source[kW];
+    #endif
     }
 
     /**
@@ -441,6 +445,14 @@ struct Utilities {
      *  Matrix4f4f::transform(const fmat_4x4_t& const Vector4f&, Vector4f&)
      */
     static void transform(const Matrix4f4f& m, const Vector4f sources[], Vector4f targets[], const size_t size) {
+    #if EGO_MATH_SIMD
+        static_assert(sizeof(Vector4f) == 4 * sizeof(float), "Vector4f must be tightly packed");
+        if (0 == size) {
+            return;
+        }
+        // The columns of the matrix are loaded once for all vectors.
+        Ego::Math::Internal::Simd<float, 4>::transform(m._v, sources[0].data(), targets[0].data(), size);
+    #else
         const Vector4f *source = sources;
         Vector4f *target = targets;
         for (size_t index = 0; index < size; ++index) {
@@ -448,6 +460,7 @@ struct Utilities {
             source++;
             target++;
         }
+    #endif
     }
 
     // Calculate matrix based on positions of grip points
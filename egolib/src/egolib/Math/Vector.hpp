@@ -61,6 +61,12 @@ public:
 
     using IndexSequence = std::make_index_sequence<MyType::dimensionality()>;
 
+private:
+    /// @brief The SIMD kernels of this vector type.
+    using SimdType = Internal::Simd<ScalarType, _Dimensionality>;
+    /// @brief @a std::true_type if this vector type has SIMD kernels, @a std::false_type otherwise.
+    using IsAccelerated = std::integral_constant<bool, SimdType::isAccelerated>;
+
 public:
 	/**
 	 * @brief Construct this vector with the specified element values.
@@ -199,7 +205,7 @@ public:
      *  the dot product <tt>(*this) * other</tt> of this vector and the other vector
      */
     ScalarType dot(const MyType& other) const {
-        return TupleUtilities::foldTT(DotProductFunctor(), ScalarFieldType::additiveNeutral(), *this, other);
+        return dot(other, IsAccelerated{});
     }
 
     /**
@@ -210,7 +216,7 @@ public:
      *  the squared length of this vector
      */
     ScalarType length_2() const {
-        return TupleUtilities::foldT(EuclideanLengthSquaredFunctor(), ScalarFieldType::additiveNeutral(), *this);
+        return length_2(IsAccelerated{});
     }
 
     /**
@@ -438,22 +444,19 @@ public:
     // CRTP
     void add(const MyType& other)
     {
-        static const typename ScalarFieldType::SumFunctor functor{};
-        (*this) = TupleUtilities::mapTT<MyType>(functor, *this, other, IndexSequence{});
+        add(other, IsAccelerated{});
     }
 
     // CRTP
     void subtract(const MyType& other)
     {
-        static const typename ScalarFieldType::DifferenceFunctor functor{};
-        (*this) = TupleUtilities::mapTT<MyType>(functor, *this, other, IndexSequence{});
+        subtract(other, IsAccelerated{});
     }
 
     // CRTP
     void multiply(const ScalarType& other)
     {
-        static const typename ScalarFieldType::ProductFunctor functor{};
-        (*this) = TupleUtilities::mapTe<MyType>(functor, *this, other, IndexSequence{});
+        multiply(other, IsAccelerated{});
     }
 
     // CRTP
@@ -621,6 +624,56 @@ public:
     template<size_t _Dummy = MyType::dimensionality()>
 	std::enable_if_t<_Dummy == 3 && MyType::dimensionality() == 3, MyType>
     cross(const MyType& other) const {
+        return cross(other, IsAccelerated{});
+    }
+
+private:
+    // The scalar (std::false_type) and the SIMD (std::true_type) implementations.
+
+    ScalarType dot(const MyType& other, std::false_type) const {
+        return TupleUtilities::foldTT(DotProductFunctor(), ScalarFieldType::additiveNeutral(), *this, other);
+    }
+
+    ScalarType dot(const MyType& other, std::true_type) const {
+        return SimdType::dot(this->data(), other.data());
+    }
+
+    ScalarType length_2(std::false_type) const {
+        return TupleUtilities::foldT(EuclideanLengthSquaredFunctor(), ScalarFieldType::additiveNeutral(), *this);
+    }
+
+    ScalarType length_2(std::true_type) const {
+        return SimdType::dot(this->data(), this->data());
+    }
+
+    void add(const MyType& other, std::false_type) {
+        static const typename ScalarFieldType::SumFunctor functor{};
+        (*this) = TupleUtilities::mapTT<MyType>(functor, *this, other, IndexSequence{});
+    }
+
+    void add(const MyType& other, std::true_type) {
+        SimdType::add(this->data(), other.data());
+    }
+
+    void subtract(const MyType& other, std::false_type) {
+        static const typename ScalarFieldType::DifferenceFunctor functor{};
+        (*this) = TupleUtilities::mapTT<MyType>(functor, *this, other, IndexSequence{});
+    }
+
+    void subtract(const MyType& other, std::true_type) {
+        SimdType::subtract(this->data(), other.data());
+    }
+
+    void multiply(const ScalarType& other, std::false_type) {
+        static const typename ScalarFieldType::ProductFunctor functor{};
+        (*this) = TupleUtilities::mapTe<MyType>(functor, *this, other, IndexSequence{});
+    }
+
+    void multiply(const ScalarType& other, std::true_type) {
+        SimdType::multiply(this->data(), other);
+    }
+
+    MyType cross(const MyType& other, std::false_type) const {
         return
             MyType
             (
@@ -629,6 +682,12 @@ public:
                 this->at(0) * other.at(1) - this->at(1) * other.at(0)
             );
     }
+
+    MyType cross(const MyType& other, std::true_type) const {
+        MyType result;
+        SimdType::cross(this->data(), other.data(), result.data());
+        return result;
+    }
 };
 
 } // namespace Math
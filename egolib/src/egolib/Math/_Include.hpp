@@ -27,6 +27,7 @@
 
 //
 #include "egolib/Math/Math.hpp"
+#include "egolib/Math/RandomStream.hpp"
 #include "egolib/Math/Random.hpp"
 #include "egolib/Math/Standard.hpp"
 #include "egolib/Math/Transform.hpp"
@@ -27,6 +27,7 @@
 
 #include "egolib/Math/Dimensionality.hpp"
 #include "egolib/Math/TemplateUtilities.hpp"
+#include "egolib/Math/Simd.hpp"
 
 
 
@@ -65,7 +66,7 @@ private:
 	 * @brief
 	 *  The elements of this tuple.
 	 */
-	std::array<ElementType, _Dimensionality> _elements;
+	alignas(Internal::SimdAlignment<ElementType, _Dimensionality>::value) std::array<ElementType, _Dimensionality> _elements;
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 // Generator construction.
@@ -162,6 +163,20 @@ public:
 		return _elements[index];
 	}
 
+	/**
+	 * @{
+	 * @brief Get a pointer to the elements of this tuple.
+	 * @return a pointer to the elements of this tuple
+	 */
+	ElementType *data() {
+		return _elements.data();
+	}
+
+	const ElementType *data() const {
+		return _elements.data();
+	}
+	/** @} */
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 // Minimal/Maximal elements.
 
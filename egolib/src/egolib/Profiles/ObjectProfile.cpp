@@ -312,9 +312,9 @@ void ObjectProfile::loadAllMessages(const std::string &filePath)
     /// @author ZF
     /// @details This function loads all messages for an object
 
-    std::unique_ptr<ReadContext> ctxt = nullptr;
+    std::unique_ptr<Ego::Script::Tokenizer> ctxt = nullptr;
     try {
-        ctxt = std::make_unique<ReadContext>(filePath);
+        ctxt = std::make_unique<Ego::Script::Tokenizer>(filePath);
     } catch (...) {
         return;
     }
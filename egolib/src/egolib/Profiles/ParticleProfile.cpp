@@ -458,3 +458,14 @@ float ParticleProfile::getGravityPull() const
 {
     return _gravityPull;
 }
+
+bool ParticleProfile::isCosmetic() const
+{
+    if (force || spawnenchant || homing || needtarget || allowpush) return false;
+    if (0.0f != damage.getLowerbound() || 0.0f != damage.getUpperbound()) return false;
+    if (0 != lifeDrain || 0 != manaDrain || 0 != dazeTime || 0 != grogTime) return false;
+    if (0 != bump_money || 0.0f != _gravityPull) return false;
+
+    // The particles spawned by this particle might not be cosmetic
+    return 0 == contspawn._amount && 0 == endspawn._amount && 0 == bumpspawn._amount;
+}
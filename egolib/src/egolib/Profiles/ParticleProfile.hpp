@@ -163,6 +163,15 @@ public:
     *   if it has a gravity push
     **/
     float getGravityPull() const;
+
+    /**
+    * @brief
+    *   Can particles of this profile be left out without changing the game?
+    * @return
+    *   true if particles of this profile are purely visual: they are not forced, do not damage,
+    *   drain, daze, grog, enchant, push, pull, home, give money or spawn other particles
+    **/
+    bool isCosmetic() const;
     
 public:
 
@@ -107,7 +107,7 @@ int ProfileSystem::getProfileSlotNumber(const std::string &folderPath, int slot_
     }
 
     // Open the file
-    ReadContext ctxt(dataFilePath);
+    Ego::Script::Tokenizer ctxt(dataFilePath);
 
     // load the slot's slot no matter what
     int slot = vfs_get_next_int(ctxt);
@@ -231,6 +231,9 @@ struct CErrorTexture
 static std::unique_ptr<CErrorTexture> _errorTexture1D = nullptr;
 static std::unique_ptr<CErrorTexture> _errorTexture2D = nullptr;
 
+/// The number of OpenGL textures created by Ego::OpenGL::Texture::load.
+static std::atomic<size_t> _numberOfTexturesCreated(0);
+
 namespace Ego {
 namespace OpenGL {
 
@@ -347,6 +350,7 @@ void Texture::load(const String& name, const SharedPtr<SDL_Surface>& surface, Te
     if (Utilities::isError()) {
         throw Id::RuntimeErrorException(__FILE__, __LINE__, "glGenTextures failed");
     }
+    _numberOfTexturesCreated++;
     // (2) Bind the new OpenGL texture ID.
     GLenum target_gl;
     switch (type) {
@@ -480,5 +484,47 @@ bool Texture::isDefault() const {
         || getTextureID() == _errorTexture2D->getTextureID();
 }
 
+void Texture::reload(int x, int y, int w, int h) {
+    if (isDefault() || !_source || TextureType::_2D != _type) {
+        throw Id::RuntimeErrorException(__FILE__, __LINE__, "texture is not a 2D texture with a source");
+    }
+    if (TextureFilter::None != getMipMapFilter()) {
+        throw Id::RuntimeErrorException(__FILE__, __LINE__, "texture has mipmaps");
+    }
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > _source->w || y + h > _source->h) {
+        throw Id::InvalidArgumentException(__FILE__, __LINE__, "rectangle out of bounds");
+    }
+
+    // Copy the rectangle into tightly packed pixels of the pixel format of this texture.
+    const auto& pixelFormatDescriptor = _hasAlpha ? PixelFormatDescriptor::get<PixelFormat::R8G8B8A8>()
+                                                  : PixelFormatDescriptor::get<PixelFormat::R8G8B8>();
+    const int bpp = pixelFormatDescriptor.getColourDepth().getDepth();
+    std::vector<uint8_t> pixels(w * h * bpp / 8);
+    SDL_Surface *rectangle = SDL_CreateRGBSurfaceFrom(pixels.data(), w, h, bpp, w * bpp / 8,
+                                                      pixelFormatDescriptor.getRedMask(), pixelFormatDescriptor.getGreenMask(),
+                                                      pixelFormatDescriptor.getBlueMask(), pixelFormatDescriptor.getAlphaMask());
+    if (!rectangle) {
+        throw Id::RuntimeErrorException(__FILE__, __LINE__, "unable to create surface");
+    }
+    SDL_BlendMode blendMode;
+    SDL_GetSurfaceBlendMode(_source.get(), &blendMode);
+    SDL_SetSurfaceBlendMode(_source.get(), SDL_BLENDMODE_NONE);
+    SDL_Rect source = {x, y, w, h};
+    SDL_BlitSurface(_source.get(), &source, rectangle, nullptr);
+    SDL_SetSurfaceBlendMode(_source.get(), blendMode);
+    SDL_FreeSurface(rectangle);
+
+    Utilities::clearError();
+    glBindTexture(GL_TEXTURE_2D, _id);
+    Utilities::upload_2d_rectangle(pixelFormatDescriptor, x, y, w, h, pixels.data());
+    if (Utilities::isError()) {
+        throw Id::RuntimeErrorException(__FILE__, __LINE__, "unable to upload rectangle");
+    }
+}
+
+size_t Texture::getNumberOfTexturesCreated() {
+    return _numberOfTexturesCreated;
+}
+
 } // namespace OpenGL
 } // namespace Ego
@@ -360,6 +360,23 @@ public:
     /** @override Ego::Texture::isDefault */
     bool isDefault() const override;
 
+    /**
+     * @brief
+     *  Upload a rectangle of the source of this texture again, after it was modified.
+     *  The OpenGL texture is updated in place rather than re-created.
+     * @param x, y, w, h
+     *  the rectangle
+     * @throw Id::RuntimeErrorException
+     *  if this texture is not a 2D texture with a source or if it has mipmaps
+     */
+    void reload(int x, int y, int w, int h);
+
+    /**
+     * @brief
+     *  Get the number of OpenGL textures created by all textures so far.
+     */
+    static size_t getNumberOfTexturesCreated();
+
 public:
 
     /**
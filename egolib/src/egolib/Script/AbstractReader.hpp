@@ -47,6 +47,17 @@ protected:
             );
     }
 
+    /// @brief Construct this reader from the contents of a file which were already read.
+    /// @param fileName the filename used in error messages
+    /// @param bytes, numberOfBytes the contents of the file
+    /// @param initialBufferCapacity the initial capacity of the lexeme accumulation buffer
+    AbstractReader(const std::string& fileName, const char *bytes, size_t numberOfBytes, size_t initialBufferCapacity) :
+        _fileName(fileName), _inputBuffer(8), _inputIndex(-1),
+        _buffer(initialBufferCapacity),
+        _lineNumber(1) {
+        _inputBuffer.append(bytes, numberOfBytes);
+    }
+
     /// @brief Set the input.
     /// @param fileName the filename
     /// @post The reader is in its initial state w.r.t. the specified input if no exception is raised.
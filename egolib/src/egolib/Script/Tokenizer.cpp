@@ -0,0 +1,350 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file egolib/Script/Tokenizer.cpp
+/// @brief A tokenizer for data files which works in place on the contents of the file.
+
+#include "egolib/Script/Tokenizer.hpp"
+#include "egolib/vfs.h"
+
+namespace Ego {
+namespace Script {
+
+Tokenizer::Tokenizer(const std::string& fileName) :
+    _fileName(fileName), _input(), _index(0), _lineNumber(1), _lineStart(0) {
+    vfs_readEntireFile
+        (
+            fileName,
+            [this](size_t numberOfBytes, const char *bytes) {
+                _input.insert(_input.end(), bytes, bytes + numberOfBytes);
+            }
+        );
+}
+
+Tokenizer::Tokenizer(const std::string& fileName, const char *bytes, size_t numberOfBytes) :
+    _fileName(fileName), _input(bytes, bytes + numberOfBytes), _index(0), _lineNumber(1), _lineStart(0) {
+}
+
+void Tokenizer::error(const char *file, int line, const std::string& message) const {
+    throw LexicalErrorException(file, line, Location(_fileName, _lineNumber), message);
+}
+
+void Tokenizer::conversionError(Lexeme lexeme, size_t lineNumber, const char *typeName) const {
+    throw LexicalErrorException(__FILE__, __LINE__, Location(_fileName, lineNumber),
+                                "unable to convert literal `" + lexeme.toString() + "` into a value of EgoScript " +
+                                typeName + " type");
+}
+
+void Tokenizer::skipNewLine() {
+    if (isNewLine()) {
+        Traits::ExtendedType old = current();
+        next();
+        if (isNewLine() && old != current()) {
+            next();
+        }
+        _lineNumber++;
+        _lineStart = _index;
+    }
+}
+
+void Tokenizer::skipWhiteSpaces() {
+    while (isWhiteSpace()) {
+        next();
+    }
+}
+
+bool Tokenizer::skipToDelimiter(char delimiter, bool optional) {
+    while (true) {
+        if (isEndOfInput()) {
+            if (optional) {
+                return false;
+            }
+            throw MissingDelimiterError(__FILE__, __LINE__, Location(_fileName, _lineNumber), delimiter);
+        }
+        bool isDelimiter = is(delimiter);
+        if (isNewLine()) {
+            skipNewLine();
+        } else {
+            next();
+        }
+        if (isDelimiter) {
+            return true;
+        }
+    }
+}
+
+bool Tokenizer::skipToColon(bool optional) {
+    return skipToDelimiter(':', optional);
+}
+
+Lexeme Tokenizer::readToEndOfLine() {
+    skipWhiteSpaces();
+    const size_t begin = _index;
+    while (!isEndOfInput() && !isNewLine()) {
+        next();
+    }
+    Lexeme lexeme(_input.data() + begin, _index - begin);
+    skipNewLine();
+    return lexeme;
+}
+
+char Tokenizer::readPrintable() {
+    skipWhiteSpaces();
+    if (isEndOfInput()) {
+        error(__FILE__, __LINE__, "premature end of input while scanning printable character");
+    }
+    if (!isAlpha() && !isDigit() && !is('!') && !is('?') && !is('=')) {
+        error(__FILE__, __LINE__, "unexpected character while scanning a printable characters");
+    }
+    char tmp = static_cast<char>(current());
+    next();
+    return tmp;
+}
+
+Lexeme Tokenizer::readName() {
+    skipWhiteSpaces();
+    if (!isAlpha() && !is('_')) {
+        error(__FILE__, __LINE__, "invalid name");
+    }
+    const size_t begin = _index;
+    do {
+        next();
+    } while (isAlpha() || isDigit() || is('_') || is('\''));
+    return Lexeme(_input.data() + begin, _index - begin);
+}
+
+bool Tokenizer::readBool() {
+    const Lexeme name = readName();
+    auto equalsIgnoreCase = [&name](const char *other) {
+        const size_t length = std::strlen(other);
+        if (name.size() != length) {
+            return false;
+        }
+        for (size_t i = 0; i < length; ++i) {
+            if (std::tolower(static_cast<unsigned char>(name[i])) != other[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (equalsIgnoreCase("true") || equalsIgnoreCase("t")) {
+        return true;
+    } else if (equalsIgnoreCase("false") || equalsIgnoreCase("f")) {
+        return false;
+    }
+    error(__FILE__, __LINE__, "unexpected character while scanning boolean literal");
+}
+
+IDSZ2 Tokenizer::readIDSZ() {
+    char c[4];
+    skipWhiteSpaces();
+    // `'['`
+    if (!is('[')) {
+        error(__FILE__, __LINE__, isEndOfInput() ? "premature end of input while scanning IDSZ"
+                                                 : "unexpected character while scanning IDSZ");
+    }
+    next();
+    // `(<alphabetic>|<digit>|'_')^4`
+    for (size_t i = 0; i < 4; ++i) {
+        if (!isAlpha() && !isDigit() && !is('_')) {
+            error(__FILE__, __LINE__, isEndOfInput() ? "premature end of input while scanning IDSZ"
+                                                     : "unexpected character while scanning IDSZ");
+        }
+        c[i] = static_cast<char>(current());
+        next();
+    }
+    // `']'`
+    if (!is(']')) {
+        error(__FILE__, __LINE__, isEndOfInput() ? "premature end of input while scanning IDSZ"
+                                                 : "unexpected character while scanning IDSZ");
+    }
+    next();
+    return IDSZ2(c[0], c[1], c[2], c[3]);
+}
+
+Lexeme Tokenizer::parseStringLiteral() {
+    const size_t begin = _index;
+    while (!isNewLine() && !isWhiteSpace() && !isEndOfInput()) {
+        next();
+    }
+    return Lexeme(_input.data() + begin, _index - begin);
+}
+
+Lexeme Tokenizer::parseIntegral(bool allowMinus, const char *what) {
+    const size_t begin = _index;
+    if (is('+') || (allowMinus && is('-'))) {
+        next();
+    }
+    for (int part = 0; part < 2; ++part) {
+        if (!isDigit()) {
+            error(__FILE__, __LINE__, std::string(isEndOfInput() ? "premature end of input" : "unexpected character") +
+                                      " while scanning " + what + " literal");
+        }
+        do {
+            next();
+        } while (isDigit());
+        // The exponent.
+        if (0 != part || (!is('e') && !is('E'))) {
+            break;
+        }
+        next();
+        if (is('+')) {
+            next();
+        }
+    }
+    return Lexeme(_input.data() + begin, _index - begin);
+}
+
+Lexeme Tokenizer::parseIntegerLiteral() {
+    return parseIntegral(true, "integer");
+}
+
+Lexeme Tokenizer::parseNaturalLiteral() {
+    return parseIntegral(false, "natural");
+}
+
+Lexeme Tokenizer::parseRealLiteral() {
+    const size_t begin = _index;
+    if (is('+') || is('-')) {
+        next();
+    }
+    if (is('.')) {
+        next();
+        if (!isDigit()) {
+            error(__FILE__, __LINE__, isEndOfInput() ? "premature end of input while scanning real literal"
+                                                     : "unexpected character while scanning real literal");
+        }
+        do {
+            next();
+        } while (isDigit());
+    } else if (isDigit()) {
+        do {
+            next();
+        } while (isDigit());
+        if (is('.')) {
+            next();
+            while (isDigit()) {
+                next();
+            }
+        }
+    }
+    if (is('e') || is('E')) {
+        next();
+        if (is('+') || is('-')) {
+            next();
+        }
+        if (!isDigit()) {
+            error(__FILE__, __LINE__, isEndOfInput() ? "premature end of input while scanning real literal exponent"
+                                                     : "unexpected character while scanning real literal exponent");
+        }
+        do {
+            next();
+        } while (isDigit());
+    }
+    return Lexeme(_input.data() + begin, _index - begin);
+}
+
+void Tokenizer::readStringLiteral(std::string& target) {
+    skipWhiteSpaces();
+    const Lexeme lexeme = parseStringLiteral();
+    target.assign(lexeme.begin(), lexeme.end());
+    for (char& c : target) {
+        if ('~' == c) {
+            c = '\t';
+        } else if ('_' == c) {
+            c = ' ';
+        }
+    }
+}
+
+int Tokenizer::readIntegerLiteral() {
+    skipWhiteSpaces();
+    const size_t lineNumber = _lineNumber;
+    const Lexeme lexeme = parseIntegerLiteral();
+    size_t i = 0;
+    bool negative = false;
+    if ('+' == lexeme[0] || '-' == lexeme[0]) {
+        negative = '-' == lexeme[0];
+        i++;
+    }
+    // Like the decoder of ReadContext, integer literals with an exponent are not accepted.
+    long long value = 0;
+    for (; i < lexeme.size(); ++i) {
+        if (!Traits::isDigit(lexeme[i])) {
+            conversionError(lexeme, lineNumber, "integer");
+        }
+        value = value * 10 + (lexeme[i] - '0');
+        if (value > static_cast<long long>(std::numeric_limits<int>::max()) + 1) {
+            conversionError(lexeme, lineNumber, "integer");
+        }
+    }
+    value = negative ? -value : value;
+    if (value > std::numeric_limits<int>::max() || value < std::numeric_limits<int>::min()) {
+        conversionError(lexeme, lineNumber, "integer");
+    }
+    return static_cast<int>(value);
+}
+
+unsigned int Tokenizer::readNaturalLiteral() {
+    skipWhiteSpaces();
+    const size_t lineNumber = _lineNumber;
+    const Lexeme lexeme = parseNaturalLiteral();
+    size_t i = ('+' == lexeme[0]) ? 1 : 0;
+    unsigned long long value = 0;
+    for (; i < lexeme.size(); ++i) {
+        if (!Traits::isDigit(lexeme[i])) {
+            conversionError(lexeme, lineNumber, "natural");
+        }
+        value = value * 10 + (lexeme[i] - '0');
+        if (value > std::numeric_limits<unsigned int>::max()) {
+            conversionError(lexeme, lineNumber, "natural");
+        }
+    }
+    return static_cast<unsigned int>(value);
+}
+
+float Tokenizer::readRealLiteral() {
+    skipWhiteSpaces();
+    const size_t lineNumber = _lineNumber;
+    const Lexeme lexeme = parseRealLiteral();
+    if (lexeme.empty()) {
+        conversionError(lexeme, lineNumber, "real");
+    }
+    // strtof requires a zero-terminated string, lexemes of real literals are short.
+    char buffer[64];
+    std::string longLexeme;
+    const char *source = buffer;
+    if (lexeme.size() < sizeof(buffer)) {
+        std::memcpy(buffer, lexeme.begin(), lexeme.size());
+        buffer[lexeme.size()] = '\0';
+    } else {
+        longLexeme = lexeme.toString();
+        source = longLexeme.c_str();
+    }
+    char *end = nullptr;
+    errno = 0;
+    const float value = std::strtof(source, &end);
+    if (ERANGE == errno || static_cast<size_t>(end - source) != lexeme.size()) {
+        conversionError(lexeme, lineNumber, "real");
+    }
+    return value;
+}
+
+} // namespace Script
+} // namespace Ego
@@ -0,0 +1,211 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file egolib/Script/Tokenizer.hpp
+/// @brief A tokenizer for data files which works in place on the contents of the file.
+/// @details
+/// The tokenizer accepts the same grammar as ReadContext and raises the same lexical errors.
+/// Lexemes are returned as views into the file contents and numeric literals are converted
+/// without constructing intermediate strings, so scanning a file allocates only the file buffer.
+/// Loaders can switch from ReadContext to the tokenizer one at a time, the utility functions
+/// in egolib/fileutil.h are overloaded for both.
+
+#pragma once
+
+#include "egolib/Script/Traits.hpp"
+#include "egolib/Script/Errors.hpp"
+#include "egolib/IDSZ.hpp"
+
+namespace Ego {
+namespace Script {
+
+/// @brief A view of a lexeme in the input of a tokenizer.
+/// @remark A lexeme is valid as long as the tokenizer it was obtained from.
+class Lexeme {
+public:
+    Lexeme() : _begin(nullptr), _size(0) {}
+
+    Lexeme(const char *begin, size_t size) : _begin(begin), _size(size) {}
+
+    const char *begin() const { return _begin; }
+    const char *end() const { return _begin + _size; }
+    size_t size() const { return _size; }
+    bool empty() const { return 0 == _size; }
+    char operator[](size_t index) const { return _begin[index]; }
+
+    /// @brief Get if this lexeme is equal to a zero-terminated string.
+    bool operator==(const char *other) const {
+        return 0 == std::strncmp(_begin, other, _size) && '\0' == other[_size];
+    }
+
+    bool operator!=(const char *other) const {
+        return !(*this == other);
+    }
+
+    std::string toString() const {
+        return std::string(_begin, _size);
+    }
+
+private:
+    const char *_begin;
+    size_t _size;
+};
+
+/// @brief A tokenizer over the entire contents of a file.
+class Tokenizer : public Id::NonCopyable {
+public:
+    using Traits = Ego::Script::Traits<char>;
+
+    /// @brief Construct this tokenizer from the contents of a file.
+    /// @param fileName the filename
+    /// @throw RuntimeErrorException if the file can not be read
+    Tokenizer(const std::string& fileName);
+
+    /// @brief Construct this tokenizer from the contents of a file which were already read.
+    /// @param fileName the filename used in error messages
+    /// @param bytes, numberOfBytes the contents of the file
+    Tokenizer(const std::string& fileName, const char *bytes, size_t numberOfBytes);
+
+    /// @brief Get the file name.
+    const std::string& getFileName() const {
+        return _fileName;
+    }
+
+    /// @brief Get the line number.
+    size_t getLineNumber() const {
+        return _lineNumber;
+    }
+
+    /// @brief Get the column number, the first column is 1.
+    size_t getColumnNumber() const {
+        return _index - _lineStart + 1;
+    }
+
+    /// @brief Get the current extended character.
+    Traits::ExtendedType current() const {
+        if (_index == _input.size()) {
+            return Traits::endOfInput();
+        }
+        return _input[_index];
+    }
+
+    /// @brief Advance to the next extended character.
+    void next() {
+        if (_index < _input.size()) {
+            _index++;
+        }
+    }
+
+    bool is(const Traits::ExtendedType& echr) const {
+        return echr == current();
+    }
+
+    bool isEndOfInput() const {
+        return _index == _input.size();
+    }
+
+    bool isWhiteSpace() const {
+        return Traits::isWhiteSpace(current());
+    }
+
+    bool isNewLine() const {
+        return Traits::isNewLine(current());
+    }
+
+    bool isAlpha() const {
+        return Traits::isAlphabetic(current());
+    }
+
+    bool isDigit() const {
+        return Traits::isDigit(current());
+    }
+
+public:
+    /// @brief Skip zero or one newline sequences.
+    /// @remark Proper line counting is performed.
+    void skipNewLine();
+
+    /// @brief Skip input until a non-whitespace extended character is the current character.
+    void skipWhiteSpaces();
+
+    /// @see ReadContext::skipToDelimiter
+    bool skipToDelimiter(char delimiter, bool optional);
+
+    /// @see ReadContext::skipToColon
+    bool skipToColon(bool optional);
+
+    /// @see ReadContext::readToEndOfLine
+    Lexeme readToEndOfLine();
+
+    /// @see ReadContext::readPrintable
+    char readPrintable();
+
+    /// @see ReadContext::readName
+    Lexeme readName();
+
+    /// @see ReadContext::readBool
+    bool readBool();
+
+    /// @see ReadContext::readIDSZ
+    IDSZ2 readIDSZ();
+
+    /// @brief Scan a string literal.
+    /// @return the lexeme, without the substitution of @a '~' and @a '_'
+    /// @see ReadContext::parseStringLiteral
+    Lexeme parseStringLiteral();
+
+    /// @see ReadContext::parseIntegerLiteral
+    Lexeme parseIntegerLiteral();
+
+    /// @see ReadContext::parseNaturalLiteral
+    Lexeme parseNaturalLiteral();
+
+    /// @see ReadContext::parseRealLiteral
+    Lexeme parseRealLiteral();
+
+    /// @brief Read a string literal.
+    /// @param [out] target assigned the string literal with @a '~' replaced by tabulators and @a '_' by spaces
+    void readStringLiteral(std::string& target);
+
+    /// @see ReadContext::readIntegerLiteral
+    int readIntegerLiteral();
+
+    /// @see ReadContext::readNaturalLiteral
+    unsigned int readNaturalLiteral();
+
+    /// @see ReadContext::readRealLiteral
+    float readRealLiteral();
+
+private:
+    [[noreturn]] void error(const char *file, int line, const std::string& message) const;
+    [[noreturn]] void conversionError(Lexeme lexeme, size_t lineNumber, const char *typeName) const;
+
+    /// @brief Scan @a digit+ (@a 'e'|@a 'E' @a '+'? @a digit+)? after an optional sign.
+    Lexeme parseIntegral(bool allowMinus, const char *what);
+
+    std::string _fileName;
+    std::vector<char> _input;
+    size_t _index;
+    size_t _lineNumber;
+    /// The index of the first character of the current line.
+    size_t _lineStart;
+};
+
+} // namespace Script
+} // namespace Ego
@@ -95,6 +95,7 @@ Runtime::Runtime() :
     #undef Define
     },
     _statistics(std::make_unique<RuntimeStatistics>()),
+    // Entered for every script run, hence not a profiler zone.
     _clock(std::make_unique<Ego::Time::Clock<Ego::Time::ClockPolicy::NonRecursive>>("runtime clock", 1))
 {
     /* Intentionally empty. */
@@ -155,6 +156,8 @@ void scr_run_chr_script(Object *pchr)
         return;
     }
 
+    aiState.runlast_time = update_wld;
+
     // Grab the "changed" value from the last time the script was run.
     if (aiState.changed)
     {
@@ -856,6 +859,7 @@ ai_state_t::ai_state_t()
     poof_time = -1;
     changed = false;
     terminate = false;
+    runlast_time = 0;
 
     // who are we related to?
     owner = ObjectRef::Invalid;
@@ -903,6 +907,7 @@ void ai_state_t::reset(ai_state_t& self)
     self.poof_time = -1;
     self.changed = false;
     self.terminate = false;
+    self.runlast_time = 0;
 
     // who are we related to?
     self.setSelf(ObjectRef::Invalid);
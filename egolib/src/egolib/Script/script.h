@@ -442,6 +442,7 @@ public:
     Sint32         poof_time;
     bool           changed;
     bool           terminate;
+    Uint32         runlast_time;  ///< The last update in which the script ran
 
     // who are we related to?
     ObjectRef      owner;         ///< The character's owner
@@ -0,0 +1,190 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Time/Profiler.cpp
+/// @brief  A low-overhead profiler of nested, named zones.
+
+#include "egolib/Time/Profiler.hpp"
+
+namespace Ego {
+namespace Time {
+
+/// A ring of recorded zones with a single writer (the owning thread) and any number of readers.
+struct Profiler::ThreadBuffer {
+    ThreadBuffer(uint32_t index) : index(index), written(0), events() {}
+
+    uint32_t index;
+    /// The number of zones written so far. Zone @a i is at <tt>events[i % RING_CAPACITY]</tt>.
+    std::atomic<uint64_t> written;
+    std::array<ProfileEvent, RING_CAPACITY> events;
+};
+
+struct Profiler::ThreadState {
+    ThreadState() : buffer(nullptr), depth(0), names(), begins() {}
+
+    ThreadBuffer *buffer;
+    uint32_t depth;
+    std::array<const char *, MAX_DEPTH> names;
+    std::array<uint64_t, MAX_DEPTH> begins;
+};
+
+namespace {
+/// Zones which began before this point in time were discarded by Profiler::clear.
+std::atomic<uint64_t> g_clearedAt(0);
+}
+
+Profiler::Profiler() :
+    _epoch(std::chrono::steady_clock::now()),
+    _buffersMutex(),
+    _buffers()
+{}
+
+Profiler& Profiler::get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+uint64_t Profiler::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _epoch).count();
+}
+
+Profiler::ThreadState& Profiler::getThreadState() {
+    static thread_local ThreadState state;
+    if (!state.buffer) {
+        // The buffers are owned by the profiler, so the zones of a thread can be read after it ended.
+        std::lock_guard<std::mutex> lock(_buffersMutex);
+        _buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(_buffers.size())));
+        state.buffer = _buffers.back().get();
+    }
+    return state;
+}
+
+void Profiler::enter(const char *name) {
+    ThreadState& state = getThreadState();
+    if (state.depth < MAX_DEPTH) {
+        state.names[state.depth] = name;
+        state.begins[state.depth] = now();
+    }
+    state.depth++;
+}
+
+void Profiler::leave() {
+    ThreadState& state = getThreadState();
+    if (0 == state.depth) {
+        return;
+    }
+    state.depth--;
+    if (state.depth >= MAX_DEPTH) {
+        return;
+    }
+    ThreadBuffer& buffer = *state.buffer;
+    const uint64_t written = buffer.written.load(std::memory_order_relaxed);
+    ProfileEvent& event = buffer.events[written % RING_CAPACITY];
+    event.name = state.names[state.depth];
+    event.begin = state.begins[state.depth];
+    event.end = now();
+    event.depth = state.depth;
+    event.thread = buffer.index;
+    // Publish the event to the readers.
+    buffer.written.store(written + 1, std::memory_order_release);
+}
+
+std::vector<ProfileEvent> Profiler::snapshot() const {
+    const uint64_t clearedAt = g_clearedAt.load(std::memory_order_acquire);
+    std::vector<ProfileEvent> events;
+    std::lock_guard<std::mutex> lock(_buffersMutex);
+    for (const auto& buffer : _buffers) {
+        const uint64_t written = buffer->written.load(std::memory_order_acquire);
+        const uint64_t first = written > RING_CAPACITY ? written - RING_CAPACITY : 0;
+        const size_t offset = events.size();
+        for (uint64_t i = first; i < written; ++i) {
+            events.push_back(buffer->events[i % RING_CAPACITY]);
+        }
+        // Drop the events the writer might have overwritten while they were copied,
+        // including the slot of the event it might be writing right now.
+        const uint64_t writtenAfter = buffer->written.load(std::memory_order_acquire);
+        const uint64_t firstValid = writtenAfter >= RING_CAPACITY ? writtenAfter + 1 - RING_CAPACITY : 0;
+        if (firstValid > first) {
+            const size_t overwritten = static_cast<size_t>(std::min(firstValid - first, written - first));
+            events.erase(events.begin() + offset, events.begin() + offset + overwritten);
+        }
+    }
+    events.erase(std::remove_if(events.begin(), events.end(),
+                                [clearedAt](const ProfileEvent& event) { return event.begin < clearedAt; }),
+                 events.end());
+    return events;
+}
+
+std::vector<ProfileSummary> Profiler::summarize(double window) const {
+    const uint64_t to = now();
+    const uint64_t from = to - std::min<uint64_t>(to, static_cast<uint64_t>(window * 1e6));
+    std::unordered_map<std::string, ProfileSummary> summaries;
+    for (const ProfileEvent& event : snapshot()) {
+        if (event.end < from) {
+            continue;
+        }
+        const double duration = (event.end - event.begin) / 1e6;
+        auto it = summaries.find(event.name);
+        if (it == summaries.end()) {
+            summaries.emplace(event.name, ProfileSummary{event.name, event.depth, 1, duration, 0.0, duration});
+        } else {
+            ProfileSummary& summary = it->second;
+            summary.depth = std::min(summary.depth, event.depth);
+            summary.calls++;
+            summary.total += duration;
+            summary.maximum = std::max(summary.maximum, duration);
+        }
+    }
+    std::vector<ProfileSummary> result;
+    for (auto& pair : summaries) {
+        pair.second.average = pair.second.total / pair.second.calls;
+        result.push_back(pair.second);
+    }
+    std::sort(result.begin(), result.end(), [](const ProfileSummary& x, const ProfileSummary& y) {
+        return x.depth != y.depth ? x.depth < y.depth : x.total > y.total;
+    });
+    return result;
+}
+
+void Profiler::writeChromeTrace(std::ostream& os) const {
+    const std::vector<ProfileEvent> events = snapshot();
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const ProfileEvent& event : events) {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << "{\"name\":\"";
+        for (const char *c = event.name; *c; ++c) {
+            if ('"' == *c || '\\' == *c) os << '\\';
+            os << *c;
+        }
+        // Timestamps and durations are in microseconds.
+        os << "\",\"cat\":\"egoboo\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+           << ",\"ts\":" << std::fixed << std::setprecision(3) << event.begin / 1e3
+           << ",\"dur\":" << (event.end - event.begin) / 1e3 << "}";
+    }
+    os << "\n]}\n";
+}
+
+void Profiler::clear() {
+    g_clearedAt.store(now(), std::memory_order_release);
+}
+
+} // namespace Time
+} // namespace Ego
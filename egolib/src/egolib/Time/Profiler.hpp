@@ -0,0 +1,172 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file   egolib/Time/Profiler.hpp
+/// @brief  A low-overhead profiler of nested, named zones.
+/// @details
+/// A zone is a section of code measured with
+/// @code
+/// {
+///     EGO_PROFILE_ZONE("update.ai");
+///     let_all_characters_think();
+/// }
+/// @endcode
+/// Every thread records the zones it leaves into its own ring buffer, so recording takes no locks.
+/// The most recent zones of all threads can be summarized or exported as a Chrome trace
+/// (load the file in <tt>chrome://tracing</tt>).
+/// Compiling with <tt>EGO_PROFILER_ENABLED=0</tt> removes all zones.
+
+#pragma once
+
+#include "egolib/typedef.h"
+
+#if !defined(EGO_PROFILER_ENABLED)
+    #define EGO_PROFILER_ENABLED 1
+#endif
+
+namespace Ego {
+namespace Time {
+
+/**
+ * @brief
+ *  A zone recorded by the profiler.
+ */
+struct ProfileEvent {
+    /// The name of the zone. Must outlive the profiler e.g. a string literal.
+    const char *name;
+    /// The nanoseconds since the creation of the profiler at which the zone was entered.
+    uint64_t begin;
+    /// The nanoseconds since the creation of the profiler at which the zone was left.
+    uint64_t end;
+    /// The number of enclosing zones.
+    uint32_t depth;
+    /// The index of the thread which recorded the zone.
+    uint32_t thread;
+};
+
+/**
+ * @brief
+ *  The statistics of the recently recorded zones of a name.
+ */
+struct ProfileSummary {
+    std::string name;
+    /// The smallest depth at which the zone was recorded.
+    uint32_t depth;
+    /// The number of times the zone was recorded.
+    size_t calls;
+    /// The total, average and maximum time spent in the zone, in milliseconds.
+    double total, average, maximum;
+};
+
+/**
+ * @brief
+ *  The profiler singleton.
+ */
+class Profiler : public Id::NonCopyable {
+public:
+    /// The number of zones kept per thread.
+    static const size_t RING_CAPACITY = 16384;
+    /// The maximum nesting depth of zones. Deeper zones are not recorded.
+    static const size_t MAX_DEPTH = 64;
+
+    static Profiler& get();
+
+    /**
+     * @brief
+     *  Enter a zone on the calling thread.
+     * @param name
+     *  the name of the zone, must outlive the profiler
+     */
+    void enter(const char *name);
+
+    /**
+     * @brief
+     *  Leave the innermost zone on the calling thread and record it.
+     * @remark
+     *  Ignored if the calling thread is not in a zone.
+     */
+    void leave();
+
+    /**
+     * @brief
+     *  Get the statistics of the zones recorded within the last @a window milliseconds.
+     * @return
+     *  the statistics ordered by depth and by total time
+     */
+    std::vector<ProfileSummary> summarize(double window = 1000.0) const;
+
+    /**
+     * @brief
+     *  Write the recorded zones of all threads in the Chrome trace event format.
+     */
+    void writeChromeTrace(std::ostream& os) const;
+
+    /**
+     * @brief
+     *  Discard all recorded zones.
+     * @remark
+     *  Zones which are entered on other threads at the time of this call may still be recorded.
+     */
+    void clear();
+
+private:
+    struct ThreadBuffer;
+    struct ThreadState;
+
+    Profiler();
+
+    uint64_t now() const;
+    ThreadState& getThreadState();
+    std::vector<ProfileEvent> snapshot() const;
+
+    std::chrono::steady_clock::time_point _epoch;
+    mutable std::mutex _buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> _buffers;
+};
+
+/**
+ * @brief
+ *  Enters a profiler zone upon its creation and leaves it upon its destruction.
+ */
+struct ProfileZone : public Id::NonCopyable {
+    explicit ProfileZone(const char *name) {
+        Profiler::get().enter(name);
+    }
+    ~ProfileZone() {
+        Profiler::get().leave();
+    }
+};
+
+} // namespace Time
+} // namespace Ego
+
+#if EGO_PROFILER_ENABLED
+    #define EGO_PROFILE_CONCAT_IMPL(x, y) x##y
+    #define EGO_PROFILE_CONCAT(x, y) EGO_PROFILE_CONCAT_IMPL(x, y)
+    /// Profile the rest of the enclosing block as zone @a name (a string literal).
+    #define EGO_PROFILE_ZONE(name) ::Ego::Time::ProfileZone EGO_PROFILE_CONCAT(_egoProfileZone, __LINE__)(name)
+    /// Enter the zone @a name (a string literal), to be left by EGO_PROFILE_LEAVE.
+    #define EGO_PROFILE_ENTER(name) ::Ego::Time::Profiler::get().enter(name)
+    /// Leave the zone entered by EGO_PROFILE_ENTER.
+    #define EGO_PROFILE_LEAVE() ::Ego::Time::Profiler::get().leave()
+#else
+    #define EGO_PROFILE_ZONE(name)
+    #define EGO_PROFILE_ENTER(name)
+    #define EGO_PROFILE_LEAVE()
+#endif
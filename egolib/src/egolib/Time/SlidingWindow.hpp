@@ -236,7 +236,9 @@ public:
 		}
 		_dataPoints[_new] = dataPoint;
 		_new = (_new + 1) % _capacity;
-		_size = (_size + 1) % _capacity;
+		if (_size < _capacity) {
+			_size++;
+		}
 		onAdd(dataPoint);
     }
     
@@ -125,12 +125,18 @@ void getadd_flt( const float min, const float value, const float max, float* val
 // RANDOM FUNCTIONS
 //--------------------------------------------------------------------------------------------
 int generate_irand_pair( const IPair num )
+{
+    return generate_irand_pair( num, Random::getDefaultStream() );
+}
+
+//--------------------------------------------------------------------------------------------
+int generate_irand_pair( const IPair num, RandomStream& stream )
 {
     /// @author ZZ
     /// @details This function generates a random number
 
     int tmp;
-    int irand = Random::next(std::numeric_limits<uint16_t>::max());
+    int irand = stream.next(std::numeric_limits<uint16_t>::max());
 
     tmp = num.base;
     if ( num.rand > 1 )
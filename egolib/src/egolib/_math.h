@@ -89,6 +89,10 @@ public:
     Facing(const Facing& other) : angle(other.angle) {
         /* Intentionally left empty. */
     }
+    Facing& operator=(const Facing& other) {
+        angle = other.angle;
+        return *this;
+    }
     // Explicit cast. Canonicalizes angles. 
     explicit operator uint16_t() const {
         int32_t x = angle;
@@ -352,3 +356,6 @@ extern "C"
 }
 
 #endif
+
+/// Generate a random number of a pair from a random stream.
+int generate_irand_pair( const IPair num, RandomStream& stream );
@@ -32,6 +32,9 @@
 #include "egolib/Core/System.hpp"
 #include "egolib/Core/Singleton.hpp"
 #include "egolib/Core/QuadTree.hpp"
+#include "egolib/Core/FrameArena.hpp"
+#include "egolib/Core/ChunkedPool.hpp"
+#include "egolib/Core/GridIndex.hpp"
 
 //--------------------------------------------------------------------------------------------
 
@@ -93,6 +96,7 @@
 //--------------------------------------------------------------------------------------------
 
 #include "egolib/Time/LocalTime.hpp"
+#include "egolib/Time/Profiler.hpp"
 #include "egolib/Time/SlidingWindow.hpp"
 #include "egolib/Time/Stopwatch.hpp"
 
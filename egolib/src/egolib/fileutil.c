@@ -38,6 +38,11 @@ ReadContext::ReadContext(const std::string& fileName) :
 {
 }
 
+ReadContext::ReadContext(const std::string& fileName, const char *bytes, size_t numberOfBytes) :
+    AbstractReader(fileName, bytes, numberOfBytes, 5012)
+{
+}
+
 ReadContext::~ReadContext()
 {
 }
@@ -1371,3 +1376,87 @@ float vfs_get_damage_resist(ReadContext& ctxt)
 
     return resistance;
 }
+
+//--------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------
+
+signed int vfs_get_next_int(Ego::Script::Tokenizer& ctxt)
+{
+    ctxt.skipToColon(false);
+    return ctxt.readIntegerLiteral();
+}
+
+unsigned int vfs_get_next_nat(Ego::Script::Tokenizer& ctxt)
+{
+    ctxt.skipToColon(false);
+    return ctxt.readNaturalLiteral();
+}
+
+float vfs_get_next_float(Ego::Script::Tokenizer& ctxt)
+{
+    ctxt.skipToColon(false);
+    return ctxt.readRealLiteral();
+}
+
+bool vfs_get_next_bool(Ego::Script::Tokenizer& ctxt)
+{
+    ctxt.skipToColon(false);
+    return ctxt.readBool();
+}
+
+char vfs_get_next_printable(Ego::Script::Tokenizer& ctxt)
+{
+    ctxt.skipToColon(false);
+    return ctxt.readPrintable();
+}
+
+IDSZ2 vfs_get_next_idsz(Ego::Script::Tokenizer& ctxt)
+{
+    ctxt.skipToColon(false);
+    return ctxt.readIDSZ();
+}
+
+void vfs_get_next_name(Ego::Script::Tokenizer& ctxt, std::string& name)
+{
+    ctxt.skipToColon(false);
+    const Ego::Script::Lexeme lexeme = ctxt.readName();
+    name.assign(lexeme.begin(), lexeme.end());
+}
+
+void vfs_get_next_string_lit(Ego::Script::Tokenizer& ctxt, std::string& stringLiteral)
+{
+    ctxt.skipToColon(false);
+    vfs_read_string_lit(ctxt, stringLiteral);
+}
+
+void vfs_read_string_lit(Ego::Script::Tokenizer& ctxt, std::string& literal)
+{
+    ctxt.readStringLiteral(literal);
+    literal = str_decode(literal);
+}
+
+Ego::Math::Interval<float> vfs_get_range(Ego::Script::Tokenizer& ctxt)
+{
+    // Read minimum.
+    ctxt.skipWhiteSpaces();
+    float from = ctxt.readRealLiteral();
+    float to = from;
+    // Read hyphen and maximum if present.
+    ctxt.skipWhiteSpaces();
+    if (ctxt.is('-'))
+    {
+        ctxt.next();
+
+        // Read maximum.
+        ctxt.skipWhiteSpaces();
+        to = ctxt.readRealLiteral();
+    }
+
+    return Ego::Math::Interval<float>(std::min(from, to), std::max(from, to));
+}
+
+Ego::Math::Interval<float> vfs_get_next_range(Ego::Script::Tokenizer& ctxt)
+{
+    ctxt.skipToColon(false);
+    return vfs_get_range(ctxt);
+}
@@ -41,6 +41,7 @@
 #include "egolib/Script/EnumDescriptor.hpp"
 #include "egolib/Script/AbstractReader.hpp"
 #include "egolib/Script/Errors.hpp"
+#include "egolib/Script/Tokenizer.hpp"
 
 /**
  * @brief
@@ -61,6 +62,8 @@ public:
 
     ReadContext(const std::string& fileName);
 
+    ReadContext(const std::string& fileName, const char *bytes, size_t numberOfBytes);
+
     ~ReadContext();
 
     /**
@@ -375,6 +378,21 @@ Ego::Math::Interval<float> vfs_get_range(ReadContext& ctxt);
 
 DamageType vfs_get_next_damage_type(ReadContext& ctxt);
 
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+// The same functions for loaders which switched to Ego::Script::Tokenizer.
+
+signed int vfs_get_next_int(Ego::Script::Tokenizer& ctxt);
+unsigned int vfs_get_next_nat(Ego::Script::Tokenizer& ctxt);
+float vfs_get_next_float(Ego::Script::Tokenizer& ctxt);
+bool vfs_get_next_bool(Ego::Script::Tokenizer& ctxt);
+char vfs_get_next_printable(Ego::Script::Tokenizer& ctxt);
+IDSZ2 vfs_get_next_idsz(Ego::Script::Tokenizer& ctxt);
+void vfs_get_next_name(Ego::Script::Tokenizer& ctxt, std::string& name);
+void vfs_get_next_string_lit(Ego::Script::Tokenizer& ctxt, std::string& stringLiteral);
+void vfs_read_string_lit(Ego::Script::Tokenizer& ctxt, std::string& literal);
+Ego::Math::Interval<float> vfs_get_range(Ego::Script::Tokenizer& ctxt);
+Ego::Math::Interval<float> vfs_get_next_range(Ego::Script::Tokenizer& ctxt);
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 // Stuff to remove.
 
@@ -0,0 +1,107 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoTest/EgoTest.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Test {
+
+EgoTest_TestCase(ChunkedPool) {
+
+    EgoTest_Test(allocateAndRelease) {
+        Ego::Core::ChunkedPool<int, 4> pool(10);
+        EgoTest_Assert(0 == pool.getChunkCount());
+        std::vector<uint32_t> indices;
+        for (uint32_t i = 0; i < 10; ++i) {
+            indices.push_back(pool.allocate());
+            EgoTest_Assert(i == indices.back());
+        }
+        // Exhausted.
+        EgoTest_Assert(decltype(pool)::NONE == pool.allocate());
+        EgoTest_Assert(0 == pool.getFreeCount());
+        EgoTest_Assert(3 == pool.getChunkCount());
+
+        EgoTest_Assert(pool.release(5));
+        EgoTest_Assert(!pool.release(5));
+        EgoTest_Assert(pool.release(2));
+        EgoTest_Assert(!pool.isAllocated(2) && !pool.isAllocated(5) && pool.isAllocated(3));
+        EgoTest_Assert(2 == pool.getFreeCount());
+        // Released indices are reused last in, first out.
+        EgoTest_Assert(2 == pool.allocate());
+        EgoTest_Assert(5 == pool.allocate());
+    }
+
+    EgoTest_Test(elementsKeepTheirAddress) {
+        Ego::Core::ChunkedPool<int, 4> pool(100);
+        const uint32_t first = pool.allocate();
+        pool[first] = 42;
+        int *address = &pool[first];
+        for (int i = 0; i < 50; ++i) {
+            pool[pool.allocate()] = i;
+        }
+        EgoTest_Assert(address == &pool[first] && 42 == *address);
+    }
+
+    EgoTest_Test(chunksAreAllocatedOnDemand) {
+        Ego::Core::ChunkedPool<int, 4> pool(100);
+        const auto& constPool = pool;
+        // Reading an element of a missing chunk does not allocate the chunk.
+        EgoTest_Assert(0 == constPool[97]);
+        EgoTest_Assert(0 == pool.getChunkCount());
+        pool[97] = 1;
+        EgoTest_Assert(1 == pool.getChunkCount());
+        EgoTest_Assert(!pool.isAllocated(97));
+        EgoTest_Assert(0 == pool.allocate());
+        EgoTest_Assert(2 == pool.getChunkCount());
+        pool.clear();
+        EgoTest_Assert(0 == pool.getChunkCount() && 100 == pool.getFreeCount());
+        EgoTest_Assert(!pool.isAllocated(0));
+    }
+
+    EgoTest_Test(outOfBounds) {
+        Ego::Core::ChunkedPool<int, 4> pool(10);
+        bool thrown = false;
+        try {
+            pool[10] = 1;
+        } catch (const Id::OutOfBoundsException&) {
+            thrown = true;
+        }
+        EgoTest_Assert(thrown);
+        EgoTest_Assert(!pool.isAllocated(10));
+    }
+
+    EgoTest_Test(forEachAllocated) {
+        Ego::Core::ChunkedPool<int, 4> pool(100);
+        for (int i = 0; i < 10; ++i) {
+            pool[pool.allocate()] = i;
+        }
+        pool.release(0);
+        pool.release(7);
+        std::vector<uint32_t> visited;
+        pool.forEachAllocated([&visited](uint32_t index, int& element) {
+            EgoTest_Assert(index == static_cast<uint32_t>(element));
+            visited.push_back(index);
+        });
+        EgoTest_Assert((std::vector<uint32_t>{1, 2, 3, 4, 5, 6, 8, 9} == visited));
+    }
+};
+
+} // namespace Test
+} // namespace Ego
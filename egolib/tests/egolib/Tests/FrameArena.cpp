@@ -0,0 +1,89 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoTest/EgoTest.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Test {
+
+EgoTest_TestCase(FrameArena) {
+
+    EgoTest_Test(alignment) {
+        Ego::Core::FrameArena arena(256);
+        Ego::Core::FrameArena::FrameScope frame(arena);
+        arena.allocate(1, 1);
+        for (size_t alignment : {2, 4, 8, 16}) {
+            void *pointer = arena.allocate(3, alignment);
+            EgoTest_Assert(0 == reinterpret_cast<uintptr_t>(pointer) % alignment);
+        }
+    }
+
+    EgoTest_Test(growsAfterOverflow) {
+        Ego::Core::FrameArena arena(64);
+        for (int frame = 0; frame < 2; ++frame) {
+            Ego::Core::FrameArena::FrameScope scope(arena);
+            auto values = Ego::Core::makeFrameVector<int>(arena);
+            for (int i = 0; i < 100; ++i) {
+                values.push_back(i);
+            }
+            EgoTest_Assert(100 == values.size() && 99 == values.back());
+        }
+        // The first frame overflowed, the second one fit into the grown buffer.
+        EgoTest_Assert(0 == arena.getStatistics().overflows);
+        EgoTest_Assert(arena.getStatistics().capacity >= arena.getStatistics().used);
+    }
+
+    // Without EGO_COUNT_HEAP_ALLOCATIONS every frame reports 0 heap allocations, so these tests are skipped.
+#if EGO_COUNT_HEAP_ALLOCATIONS
+    EgoTest_Test(heapAllocationsAreReported) {
+        Ego::Core::FrameArena arena(1024);
+        {
+            Ego::Core::FrameArena::FrameScope scope(arena);
+            // Static, so the compiler cannot elide the allocation. Too long for the small string buffer.
+            static std::string text;
+            text.assign(256, 'a');
+        }
+        EgoTest_Assert(0 < arena.getStatistics().heapAllocations);
+    }
+
+    EgoTest_Test(noHeapAllocationsInSteadyState) {
+        Ego::Core::FrameArena arena(64);
+        for (int frame = 0; frame < 3; ++frame) {
+            Ego::Core::FrameArena::FrameScope scope(arena);
+            // 1 KiB, the first frame overflows the buffer, the later frames fit into the grown one.
+            auto values = Ego::Core::makeFrameVector<int>(arena);
+            values.assign(256, frame);
+            EgoTest_Assert(256 == values.size() && frame == values.back());
+        }
+        EgoTest_Assert(0 == arena.getStatistics().heapAllocations);
+    }
+
+    EgoTest_Test(heapAllocationCount) {
+        const uint64_t before = Ego::Core::getHeapAllocationCount();
+        // Static, so the compiler cannot elide the allocation.
+        static std::unique_ptr<int> value;
+        value.reset(new int(1));
+        EgoTest_Assert(before + 1 == Ego::Core::getHeapAllocationCount());
+    }
+#endif
+};
+
+} // namespace Test
+} // namespace Ego
@@ -0,0 +1,136 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoTest/EgoTest.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Test {
+
+EgoTest_TestCase(GridIndex) {
+
+    struct Point {
+        float x, y;
+        bool present;
+    };
+
+    /// Find the points within a rectangle by scanning all points.
+    static std::vector<uint32_t> scanRect(const std::vector<Point>& points, float minX, float minY, float maxX, float maxY) {
+        std::vector<uint32_t> result;
+        for (uint32_t i = 0; i < points.size(); ++i) {
+            const Point& point = points[i];
+            if (point.present && point.x >= minX && point.x <= maxX && point.y >= minY && point.y <= maxY) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    /// Find the points within a circle by scanning all points.
+    static std::vector<uint32_t> scanRadius(const std::vector<Point>& points, float x, float y, float radius) {
+        std::vector<uint32_t> result;
+        for (uint32_t i = 0; i < points.size(); ++i) {
+            const Point& point = points[i];
+            const float dx = point.x - x, dy = point.y - y;
+            if (point.present && dx * dx + dy * dy <= radius * radius) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    EgoTest_Test(rectangle) {
+        Ego::Core::GridIndex index(128.0f);
+        index.resize(4, 4);
+        index.set(0, 10.0f, 10.0f);
+        index.set(1, 128.0f, 128.0f);
+        index.set(2, 300.0f, 20.0f);
+        // Outside of the grid.
+        index.set(3, 1000.0f, -50.0f);
+        std::vector<uint32_t> result;
+        index.findInRect(0.0f, 0.0f, 128.0f, 128.0f, result);
+        EgoTest_Assert((std::vector<uint32_t>{0, 1} == result));
+        result.clear();
+        index.findInRect(200.0f, -100.0f, 2000.0f, 30.0f, result);
+        EgoTest_Assert((std::vector<uint32_t>{2, 3} == result));
+        result.clear();
+        // An empty rectangle.
+        index.findInRect(100.0f, 0.0f, 0.0f, 100.0f, result);
+        EgoTest_Assert(result.empty());
+    }
+
+    EgoTest_Test(moveAndRemove) {
+        Ego::Core::GridIndex index(128.0f);
+        index.resize(4, 4);
+        index.set(7, 10.0f, 10.0f);
+        index.set(8, 20.0f, 20.0f);
+        EgoTest_Assert(2 == index.size() && index.contains(7) && !index.contains(6));
+        index.set(7, 400.0f, 400.0f);
+        EgoTest_Assert(2 == index.size());
+        std::vector<uint32_t> result;
+        index.findInRect(0.0f, 0.0f, 100.0f, 100.0f, result);
+        EgoTest_Assert((std::vector<uint32_t>{8} == result));
+        EgoTest_Assert(index.remove(8));
+        EgoTest_Assert(!index.remove(8));
+        result.clear();
+        index.findInRect(0.0f, 0.0f, 1000.0f, 1000.0f, result);
+        EgoTest_Assert((std::vector<uint32_t>{7} == result));
+        index.clear();
+        EgoTest_Assert(0 == index.size() && !index.contains(7));
+    }
+
+    EgoTest_Test(sameResultsAsScan) {
+        Ego::Core::GridIndex index(128.0f);
+        index.resize(8, 8);
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> coordinate(-100.0f, 1200.0f);
+        std::vector<Point> points(500, Point{0.0f, 0.0f, false});
+        for (int step = 0; step < 2000; ++step) {
+            const uint32_t id = random() % points.size();
+            if (0 == random() % 4) {
+                index.remove(id);
+                points[id].present = false;
+            } else {
+                points[id] = Point{coordinate(random), coordinate(random), true};
+                index.set(id, points[id].x, points[id].y);
+            }
+            if (500 == step) {
+                // The results do not depend on the size of the grid.
+                index.resize(3, 5);
+            }
+            if (0 == step % 50) {
+                float minX = coordinate(random), maxX = coordinate(random);
+                float minY = coordinate(random), maxY = coordinate(random);
+                std::tie(minX, maxX) = std::minmax(minX, maxX);
+                std::tie(minY, maxY) = std::minmax(minY, maxY);
+                std::vector<uint32_t> result;
+                index.findInRect(minX, minY, maxX, maxY, result);
+                EgoTest_Assert(scanRect(points, minX, minY, maxX, maxY) == result);
+
+                const float x = coordinate(random), y = coordinate(random), radius = coordinate(random) / 4.0f;
+                result.clear();
+                index.findInRadius(x, y, std::max(0.0f, radius), result);
+                EgoTest_Assert(scanRadius(points, x, y, std::max(0.0f, radius)) == result);
+            }
+        }
+    }
+};
+
+} // namespace Test
+} // namespace Ego
@@ -291,6 +291,22 @@ public:
         return a.getMax() + unit() * pdelta(0.0f);
     }
 
+public:
+    // Get if the result of a SIMD kernel equals the result of the scalar implementation.
+    // The results are identical unless multiply-adds might be fused, by the kernels or by the compiler.
+    static bool simdEquals(float simd, float scalar) {
+    #if EGO_MATH_SIMD_FMA || defined(__FP_FAST_FMAF)
+        return simd == scalar || std::abs(simd - scalar) <= 1e-5f * std::max(1.0f, std::abs(scalar));
+    #else
+        return simd == scalar;
+    #endif
+    }
+
+    // Get a random float in the interval [-1,+1].
+    static float randomSigned() {
+        return 2.0f * Random::nextFloat() - 1.0f;
+    }
+
 };
 
 } // namespace Math
@@ -70,6 +70,55 @@ EgoTest_Test(muls) {
     EgoTest_Assert(b * (1.0f/s) == a);
 }
 
+// The SIMD kernels must compute the same as the scalar implementation, which is spelled out here.
+EgoTest_Test(productSimd) {
+    using Ego::Tests::Math::Utilities;
+    for (size_t n = 0; n < 100; ++n) {
+        Matrix4f4f a, b;
+        for (size_t i = 0; i < 16; ++i) {
+            a(i) = Utilities::randomSigned();
+            b(i) = Utilities::randomSigned();
+        }
+        const Matrix4f4f c = a * b;
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                float t = 0.0f;
+                for (size_t k = 0; k < 4; ++k) {
+                    t += a(i, k) * b(k, j);
+                }
+                EgoTest_Assert(Utilities::simdEquals(c(i, j), t));
+            }
+        }
+    }
+}
+
+EgoTest_Test(transformSimd) {
+    using Ego::Tests::Math::Utilities;
+    // An odd number of vectors, as the AVX kernel transforms two vectors at a time.
+    static const size_t NUMBER_OF_VECTORS = 7;
+    for (size_t n = 0; n < 100; ++n) {
+        Matrix4f4f m;
+        for (size_t i = 0; i < 16; ++i) {
+            m(i) = Utilities::randomSigned();
+        }
+        Vector4f sources[NUMBER_OF_VECTORS], targets[NUMBER_OF_VECTORS];
+        for (size_t k = 0; k < NUMBER_OF_VECTORS; ++k) {
+            sources[k] = Vector4f(Utilities::randomSigned(), Utilities::randomSigned(), Utilities::randomSigned(), 1.0f);
+        }
+        ::Utilities::transform(m, sources, targets, NUMBER_OF_VECTORS);
+        for (size_t k = 0; k < NUMBER_OF_VECTORS; ++k) {
+            const Vector4f& v = sources[k];
+            Vector4f single;
+            ::Utilities::transform(m, v, single);
+            for (size_t i = 0; i < 4; ++i) {
+                const float t = m(i, 0) * v[0] + m(i, 1) * v[1] + m(i, 2) * v[2] + m(i, 3) * v[3];
+                EgoTest_Assert(Utilities::simdEquals(targets[k][i], t));
+                EgoTest_Assert(targets[k][i] == single[i]);
+            }
+        }
+    }
+}
+
 };
 
 } // namespace Test
@@ -0,0 +1,79 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "egolib/Tests/Math/MathTestUtilities.hpp"
+
+namespace Ego {
+namespace Math {
+namespace Test {
+
+EgoTest_TestCase(RandomStream) {
+
+EgoTest_Test(philoxKnownAnswers) {
+    // The known answers of the Random123 distribution.
+    using Block = std::array<uint32_t, 4>;
+    EgoTest_Assert(::RandomStream::philox({0, 0, 0, 0}, {0, 0}) == Block({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EgoTest_Assert(::RandomStream::philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+                   Block({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EgoTest_Assert(::RandomStream::philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+                   Block({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+EgoTest_Test(deterministic) {
+    ::RandomStream x(42), y(42);
+    for (int i = 0; i < 100; ++i) {
+        EgoTest_Assert(x() == y());
+    }
+    x.setPosition(17);
+    ::RandomStream z(42);
+    for (int i = 0; i < 17; ++i) z();
+    EgoTest_Assert(x() == z());
+}
+
+EgoTest_Test(deriveIndependentOfDraws) {
+    ::RandomStream x(42);
+    const ::RandomStream a = x.derive(7);
+    for (int i = 0; i < 10; ++i) x();
+    const ::RandomStream b = x.derive(7);
+    EgoTest_Assert(a.getKey() == b.getKey());
+    EgoTest_Assert(x.derive(7).getKey() != x.derive(8).getKey());
+    EgoTest_Assert(x.derive(7).getKey() != ::RandomStream(43).derive(7).getKey());
+}
+
+EgoTest_Test(ranges) {
+    ::RandomStream x(1);
+    for (int i = 0; i < 1000; ++i) {
+        const float f = x.nextFloat();
+        EgoTest_Assert(0.0f <= f && f <= 1.0f);
+        const int n = x.next<int>(-3, 5);
+        EgoTest_Assert(-3 <= n && n <= 5);
+        const int p = x.getPercent();
+        EgoTest_Assert(1 <= p && p <= 100);
+        const float g = x.next(Interval<float>(2.0f, 3.0f));
+        EgoTest_Assert(2.0f <= g && g <= 3.0f);
+    }
+    EgoTest_Assert(7 == x.next<int>(7, 7));
+    EgoTest_Assert(std::numeric_limits<uint64_t>::max() >= x.next<uint64_t>(std::numeric_limits<uint64_t>::max()));
+}
+
+};
+
+} // namespace Test
+} // namespace Math
+} // namespace Ego
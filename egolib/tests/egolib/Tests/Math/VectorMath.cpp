@@ -96,6 +96,44 @@ EgoTest_Test(vectorLength) {
     EgoTest_Assert(z[0] == 0.0f && z[1] == 0.0f);
 }
 
+// The SIMD kernels must compute the same as the scalar implementation, which is spelled out here.
+EgoTest_Test(vector3fSimd) {
+    using Ego::Tests::Math::Utilities;
+    for (size_t i = 0; i < 1000; ++i) {
+        const Vector3f a(Utilities::randomSigned(), Utilities::randomSigned(), Utilities::randomSigned());
+        const Vector3f b(Utilities::randomSigned(), Utilities::randomSigned(), Utilities::randomSigned());
+        const float s = Utilities::randomSigned();
+        const Vector3f sum = a + b, difference = a - b, product = a * s, cross = a.cross(b);
+        for (size_t j = 0; j < 3; ++j) {
+            EgoTest_Assert(sum[j] == a[j] + b[j]);
+            EgoTest_Assert(difference[j] == a[j] - b[j]);
+            EgoTest_Assert(product[j] == a[j] * s);
+        }
+        EgoTest_Assert(Utilities::simdEquals(cross[0], a[1] * b[2] - a[2] * b[1]));
+        EgoTest_Assert(Utilities::simdEquals(cross[1], a[2] * b[0] - a[0] * b[2]));
+        EgoTest_Assert(Utilities::simdEquals(cross[2], a[0] * b[1] - a[1] * b[0]));
+        EgoTest_Assert(Utilities::simdEquals(a.dot(b), ((0.0f + a[0] * b[0]) + a[1] * b[1]) + a[2] * b[2]));
+        EgoTest_Assert(Utilities::simdEquals(a.length_2(), ((0.0f + a[0] * a[0]) + a[1] * a[1]) + a[2] * a[2]));
+    }
+}
+
+EgoTest_Test(vector4fSimd) {
+    using Ego::Tests::Math::Utilities;
+    EgoTest_Assert((0 == alignof(Vector4f) % Ego::Math::Internal::SimdAlignment<float, 4>::value));
+    for (size_t i = 0; i < 1000; ++i) {
+        const Vector4f a(Utilities::randomSigned(), Utilities::randomSigned(), Utilities::randomSigned(), Utilities::randomSigned());
+        const Vector4f b(Utilities::randomSigned(), Utilities::randomSigned(), Utilities::randomSigned(), Utilities::randomSigned());
+        const float s = Utilities::randomSigned();
+        const Vector4f sum = a + b, difference = a - b, product = a * s;
+        for (size_t j = 0; j < 4; ++j) {
+            EgoTest_Assert(sum[j] == a[j] + b[j]);
+            EgoTest_Assert(difference[j] == a[j] - b[j]);
+            EgoTest_Assert(product[j] == a[j] * s);
+        }
+        EgoTest_Assert(Utilities::simdEquals(a.dot(b), (((0.0f + a[0] * b[0]) + a[1] * b[1]) + a[2] * b[2]) + a[3] * b[3]));
+    }
+}
+
 };
 
 } // namespace Test
@@ -0,0 +1,132 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoTest/EgoTest.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Test {
+
+EgoTest_TestCase(Profiler) {
+
+    static const Ego::Time::ProfileSummary *find(const std::vector<Ego::Time::ProfileSummary>& summaries, const std::string& name) {
+        for (const auto& summary : summaries) {
+            if (summary.name == name) return &summary;
+        }
+        return nullptr;
+    }
+
+    EgoTest_SetUpTest() {
+        Ego::Time::Profiler::get().clear();
+    }
+
+    EgoTest_Test(nestedZones) {
+        {
+            Ego::Time::ProfileZone outer("test.outer");
+            for (int i = 0; i < 3; ++i) {
+                Ego::Time::ProfileZone inner("test.inner");
+            }
+        }
+        auto summaries = Ego::Time::Profiler::get().summarize();
+        auto outer = find(summaries, "test.outer");
+        auto inner = find(summaries, "test.inner");
+        EgoTest_Assert(nullptr != outer && nullptr != inner);
+        EgoTest_Assert(1 == outer->calls);
+        EgoTest_Assert(3 == inner->calls);
+        EgoTest_Assert(outer->depth + 1 == inner->depth);
+        EgoTest_Assert(outer->total >= inner->total);
+    }
+
+    EgoTest_Test(clear) {
+        { Ego::Time::ProfileZone zone("test.cleared"); }
+        Ego::Time::Profiler::get().clear();
+        EgoTest_Assert(nullptr == find(Ego::Time::Profiler::get().summarize(), "test.cleared"));
+        // Leaving more zones than were entered is ignored.
+        Ego::Time::Profiler::get().leave();
+    }
+
+    EgoTest_Test(threads) {
+        std::thread thread([] {
+            for (int i = 0; i < 10; ++i) {
+                Ego::Time::ProfileZone zone("test.thread");
+            }
+        });
+        thread.join();
+        auto summary = find(Ego::Time::Profiler::get().summarize(), "test.thread");
+        EgoTest_Assert(nullptr != summary && 10 == summary->calls);
+    }
+
+    EgoTest_Test(ringWrap) {
+        const size_t capacity = Ego::Time::Profiler::RING_CAPACITY;
+        for (size_t i = 0; i < capacity + 100; ++i) {
+            Ego::Time::ProfileZone zone("test.wrapped");
+        }
+        // The oldest slot of a full ring is the one the writer fills next, so it is never reported.
+        auto summary = find(Ego::Time::Profiler::get().summarize(), "test.wrapped");
+        EgoTest_Assert(nullptr != summary && capacity - 1 == summary->calls);
+
+        // A ring which wraps while it is read yields no more events than it can hold.
+        std::atomic<bool> running(true);
+        std::thread thread([&running] {
+            while (running.load()) {
+                Ego::Time::ProfileZone zone("test.wrapping");
+            }
+        });
+        for (int i = 0; i < 10; ++i) {
+            auto wrapping = find(Ego::Time::Profiler::get().summarize(), "test.wrapping");
+            EgoTest_Assert(nullptr == wrapping || wrapping->calls < capacity);
+        }
+        running.store(false);
+        thread.join();
+    }
+
+    EgoTest_Test(chromeTrace) {
+        { Ego::Time::ProfileZone zone("test.\"trace\""); }
+        std::ostringstream os;
+        Ego::Time::Profiler::get().writeChromeTrace(os);
+        const std::string trace = os.str();
+        EgoTest_Assert(0 == trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        EgoTest_Assert(std::string::npos != trace.find("\"name\":\"test.\\\"trace\\\"\""));
+        EgoTest_Assert(std::string::npos != trace.find("\"ph\":\"X\""));
+    }
+
+    EgoTest_Test(clockAdapter) {
+        // Static, as the recorded zones refer to the name of the clock.
+        static Ego::Time::Clock<Ego::Time::ClockPolicy::NonRecursive> clock("test.clock", 2, true);
+        for (int i = 0; i < 3; ++i) {
+            Ego::Time::ClockScope<Ego::Time::ClockPolicy::NonRecursive> scope(clock);
+        }
+        auto summary = find(Ego::Time::Profiler::get().summarize(), "test.clock");
+        EgoTest_Assert(nullptr != summary && 3 == summary->calls);
+        EgoTest_Assert(clock.avg() >= 0.0);
+        EgoTest_Assert(clock.lst() >= 0.0);
+    }
+
+    EgoTest_Test(clockAdapterIsOptIn) {
+        static Ego::Time::Clock<Ego::Time::ClockPolicy::NonRecursive> clock("test.unprofiledClock", 2);
+        for (int i = 0; i < 3; ++i) {
+            Ego::Time::ClockScope<Ego::Time::ClockPolicy::NonRecursive> scope(clock);
+        }
+        EgoTest_Assert(nullptr == find(Ego::Time::Profiler::get().summarize(), "test.unprofiledClock"));
+        EgoTest_Assert(clock.avg() >= 0.0);
+    }
+};
+
+} // namespace Test
+} // namespace Ego
@@ -0,0 +1,110 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoTest/EgoTest.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Test {
+
+EgoTest_TestCase(SoundBank) {
+
+    // Create the contents of a mono 16-bit WAV file with the given number of samples of a constant value.
+    static std::vector<uint8_t> makeWav(uint32_t samples, int16_t value) {
+        std::vector<uint8_t> wav;
+        auto put16 = [&wav](uint16_t x) { wav.push_back(x & 0xFF); wav.push_back(x >> 8); };
+        auto put32 = [&wav](uint32_t x) { for (int i = 0; i < 4; ++i) wav.push_back((x >> (8 * i)) & 0xFF); };
+        auto putTag = [&wav](const char *tag) { wav.insert(wav.end(), tag, tag + 4); };
+        const uint32_t dataSize = samples * 2;
+        putTag("RIFF"); put32(36 + dataSize); putTag("WAVE");
+        putTag("fmt "); put32(16); put16(1); put16(1); put32(22050); put32(22050 * 2); put16(2); put16(16);
+        putTag("data"); put32(dataSize);
+        for (uint32_t i = 0; i < samples; ++i) put16(static_cast<uint16_t>(value));
+        return wav;
+    }
+
+    EgoTest_SetUpTest() {
+        // The dummy driver does not require an audio device.
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+        SDL_InitSubSystem(SDL_INIT_AUDIO);
+        Mix_OpenAudio(22050, MIX_DEFAULT_FORMAT, 2, 1024);
+    }
+
+    EgoTest_TearDownTest() {
+        Mix_CloseAudio();
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+
+    EgoTest_Test(deduplication) {
+        Ego::Audio::SoundBank bank;
+        SoundID a = bank.add(makeWav(1000, 1));
+        SoundID b = bank.add(makeWav(1000, 1));
+        SoundID c = bank.add(makeWav(1000, 2));
+        EgoTest_Assert(a != INVALID_SOUND_ID);
+        EgoTest_Assert(a == b);
+        EgoTest_Assert(a != c);
+        EgoTest_Assert(1 == bank.getStatistics().duplicates);
+        EgoTest_Assert(INVALID_SOUND_ID == bank.add(std::vector<uint8_t>()));
+    }
+
+    EgoTest_Test(lazyDecoding) {
+        Ego::Audio::SoundBank bank;
+        SoundID a = bank.add(makeWav(1000, 1));
+        EgoTest_Assert(0 == bank.getStatistics().decodedSounds);
+        EgoTest_Assert(0 == bank.getStatistics().residentBytes);
+        EgoTest_Assert(nullptr != bank.get(a));
+        EgoTest_Assert(1 == bank.getStatistics().decodedSounds);
+        EgoTest_Assert(0 < bank.getStatistics().residentBytes);
+        // A second use does not decode again.
+        bank.get(a);
+        EgoTest_Assert(1 == bank.getStatistics().decodes);
+        EgoTest_Assert(nullptr == bank.get(INVALID_SOUND_ID));
+    }
+
+    EgoTest_Test(failedDecoding) {
+        Ego::Audio::SoundBank bank;
+        const std::string garbage = "not a sound file";
+        SoundID a = bank.add(std::vector<uint8_t>(garbage.begin(), garbage.end()));
+        EgoTest_Assert(nullptr == bank.get(a));
+        // The failure is remembered, the sound is not decoded again.
+        EgoTest_Assert(nullptr == bank.get(a));
+        EgoTest_Assert(1 == bank.getStatistics().failedDecodes);
+        EgoTest_Assert(0 == bank.getStatistics().decodedSounds);
+    }
+
+    EgoTest_Test(budget) {
+        Ego::Audio::SoundBank bank(1);
+        SoundID a = bank.add(makeWav(1000, 1));
+        SoundID b = bank.add(makeWav(1000, 2));
+        bank.prewarm(a);
+        // The most recently used sound is kept even if it exceeds the budget.
+        EgoTest_Assert(1 == bank.getStatistics().decodedSounds);
+        bank.prewarm(b);
+        EgoTest_Assert(1 == bank.getStatistics().decodedSounds);
+        EgoTest_Assert(1 == bank.getStatistics().evictions);
+        // An evicted sound is decoded again on its next use.
+        EgoTest_Assert(nullptr != bank.get(a));
+        EgoTest_Assert(3 == bank.getStatistics().decodes);
+        bank.release();
+        EgoTest_Assert(0 == bank.getStatistics().residentBytes);
+    }
+};
+
+} // namespace Test
+} // namespace Ego
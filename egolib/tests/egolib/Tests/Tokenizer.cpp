@@ -0,0 +1,119 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoTest/EgoTest.hpp"
+#include "egolib/egolib.h"
+
+namespace Ego {
+namespace Test {
+
+EgoTest_TestCase(Tokenizer) {
+
+    static const std::string& sample() {
+        static const std::string text =
+            "// Object data\r\n"
+            "Slot number       : 42\r\n"
+            "Class name        : Sword_of~Fire\r\n"
+            "Uniform light     : TRUE\r\n"
+            "Life              : 12-20.5\r\n"
+            "Size              : -1.5e1\r\n"
+            "Gender            : !\r\n"
+            "Experience        : +7\r\n"
+            "IDSZ              : [SWOR]\r\n"
+            "Skill             : T\n"
+            "Name              : Excalibur\n";
+        return text;
+    }
+
+    /// Read the sample with the utility functions of ReadContext or of the tokenizer.
+    template <typename Context>
+    static std::vector<std::string> readSample(Context& ctxt) {
+        std::vector<std::string> values;
+        std::string buffer;
+        values.push_back(std::to_string(vfs_get_next_int(ctxt)));
+        vfs_get_next_string_lit(ctxt, buffer);
+        values.push_back(buffer);
+        values.push_back(std::to_string(vfs_get_next_bool(ctxt)));
+        auto range = vfs_get_next_range(ctxt);
+        values.push_back(std::to_string(range.getLowerbound()) + " " + std::to_string(range.getUpperbound()));
+        values.push_back(std::to_string(vfs_get_next_float(ctxt)));
+        values.push_back(std::string(1, vfs_get_next_printable(ctxt)));
+        values.push_back(std::to_string(vfs_get_next_nat(ctxt)));
+        values.push_back(vfs_get_next_idsz(ctxt).toString());
+        values.push_back(std::to_string(vfs_get_next_bool(ctxt)));
+        vfs_get_next_name(ctxt, buffer);
+        values.push_back(buffer);
+        values.push_back(std::to_string(ctxt.getLineNumber()));
+        values.push_back(std::to_string(ctxt.skipToColon(true)));
+        return values;
+    }
+
+    /// Get the line number of the lexical error raised when reading an integer from @a text.
+    template <typename Context>
+    static size_t getErrorLine(const std::string& text) {
+        Context ctxt("test.txt", text.c_str(), text.size());
+        try {
+            vfs_get_next_int(ctxt);
+            vfs_get_next_int(ctxt);
+        } catch (const Id::AbstractLexicalErrorException& ex) {
+            return ex.getLocation().getLineNumber();
+        }
+        return 0;
+    }
+
+    EgoTest_Test(sameValuesAsReadContext) {
+        ReadContext reader("test.txt", sample().c_str(), sample().size());
+        Ego::Script::Tokenizer tokenizer("test.txt", sample().c_str(), sample().size());
+        auto expected = readSample(reader);
+        auto actual = readSample(tokenizer);
+        EgoTest_Assert(expected == actual);
+        EgoTest_Assert(actual[1] == "Sword of\tFire");
+        EgoTest_Assert(actual[10] == "11");
+    }
+
+    EgoTest_Test(lexemes) {
+        const std::string text = "  Name'x_1 rest of line\nnext";
+        Ego::Script::Tokenizer tokenizer("test.txt", text.c_str(), text.size());
+        EgoTest_Assert(tokenizer.readName() == "Name'x_1");
+        EgoTest_Assert(tokenizer.getColumnNumber() == 11);
+        EgoTest_Assert(tokenizer.readToEndOfLine() == "rest of line");
+        EgoTest_Assert(tokenizer.getLineNumber() == 2);
+        EgoTest_Assert(tokenizer.getColumnNumber() == 1);
+        EgoTest_Assert(tokenizer.readName() == "next");
+        EgoTest_Assert(tokenizer.isEndOfInput());
+    }
+
+    EgoTest_Test(sameErrorsAsReadContext) {
+        // Unexpected character, integer literals with exponents and integer overflow.
+        const std::string texts[] = {
+            "A : 1\nB : x\n",
+            "A : 1\n\nB : 1e3\n",
+            "A : 99999999999\n",
+            "A : 1\nB 2\n",
+        };
+        for (const auto& text : texts) {
+            const size_t expected = getErrorLine<ReadContext>(text);
+            EgoTest_Assert(0 != expected);
+            EgoTest_Assert(expected == getErrorLine<Ego::Script::Tokenizer>(text));
+        }
+    }
+};
+
+} // namespace Test
+} // namespace Ego
@@ -13,6 +13,7 @@ sub cleanTestCaseName ($);
 
 sub outputGeneratedObjCFile ($%);
 sub outputGeneratedCPPFile ($%);
+sub outputGeneratedBenchFile ($%);
 
 sub warning (@);
 sub error (@);
@@ -29,18 +30,24 @@ my $debug = 0;
 # Set output of STDERR To UTF-8
 binmode STDERR, ":encoding(UTF-8)";
 
-die "usage: $0 {objc|cpp} <file1> [file2...]\n" if @ARGV < 1;
+die "usage: $0 {objc|cpp|bench} <file1> [file2...]\n" if @ARGV < 1;
 
 my $useObjC = $ARGV[0] =~ /^objc$/i;
+my $useBench = $ARGV[0] =~ /^bench$/i;
 shift; # remove first argument
 
+# In bench mode, EgoBench benchmark cases are collected instead of EgoTest test cases
+my $genDir = $useBench ? "gen-bench" : "gen";
+my $caseMacro = $useBench ? "EgoBench_BenchCase" : "EgoTest_TestCase";
+my $testMacro = $useBench ? "EgoBench_Bench" : "EgoTest_Test";
+
 my @testCasesList;
 
 for my $testFile (@ARGV) {
     my %testCasesInFile = findTestCasesInFile($testFile);
     push @testCasesList, keys %testCasesInFile;
     
-    my $genFile = "gen/$testFile";
+    my $genFile = "$genDir/$testFile";
     {
         my ($volume, $directory, $file) = File::Spec->splitpath($genFile);
         my $dirToCreate = File::Spec->catpath($volume, $directory, '');
@@ -60,6 +67,8 @@ for my $testFile (@ARGV) {
     
     if ($useObjC) {
         outputGeneratedObjCFile($out, %testCasesInFile);
+    } elsif ($useBench) {
+        outputGeneratedBenchFile($out, %testCasesInFile);
     } else {
         outputGeneratedCPPFile($out, %testCasesInFile);
     }
@@ -69,8 +78,33 @@ for my $testFile (@ARGV) {
 
 exit 1 if $hasErrored;
 
+# Create gen-bench/BenchMain.cpp; this drives EgoBench
+if ($useBench) {
+    mkdir $genDir;
+    open my $out, '>:encoding(UTF-8)', "$genDir/BenchMain.cpp" or die "Cannot open $genDir/BenchMain.cpp: $!";
+    
+    for my $benchCase (@testCasesList) {
+        my $benchCaseClean = cleanTestCaseName($benchCase);
+        print $out "int BenchCase_$benchCaseClean();\n";
+    }
+    
+    print $out "\n";
+    print $out "#include \"EgoBench/EgoBench.cpp\"\n\n";
+    print $out "std::map<std::string, std::function<int(void)>> EgoBench::getBenchCases()\n";
+    print $out "{\n";
+    print $out "    std::map<std::string, std::function<int(void)>> ret;\n";
+    
+    for my $benchCase (@testCasesList) {
+        my $benchCaseClean = cleanTestCaseName($benchCase);
+        printf $out "    ret.insert(std::make_pair(\"%s\", &BenchCase_%s));\n", $benchCase, $benchCaseClean;
+    }
+    
+    print $out "    return ret;\n";
+    print $out "}\n";
+    close $out;
+}
 # Create gen/TestMain.cpp; this drives the handwritten backend
-unless ($useObjC) {
+elsif (!$useObjC) {
     mkdir "gen";
     open my $out, '>:encoding(UTF-8)', "gen/TestMain.cpp" or die "Cannot open gen/TestMain.cpp: $!";
     
@@ -148,6 +182,24 @@ sub outputGeneratedCPPFile ($%) {
     }
 }
 
+sub outputGeneratedBenchFile ($%) {
+    my ($out, %benchCases) = @_;
+    
+    for my $benchCase (keys %benchCases) {
+        my $benchCaseClean = cleanTestCaseName($benchCase);
+        print $out "\nint BenchCase_$benchCaseClean()\n";
+        print $out "{\n";
+        print $out "    int failures = 0;\n";
+        print $out "    $benchCase benchCase;\n";
+        my @benches = @{$benchCases{$benchCase}};
+        for my $bench (@benches) {
+            print $out "    failures += EgoBench::handleBench(\"${benchCase}::$bench\", std::bind(&${benchCase}::$bench, &benchCase, std::placeholders::_1));\n";
+        }
+        print $out "    return failures;\n";
+        print $out "}\n";
+    }
+}
+
 sub cleanTestCaseName ($) {
     my $testCaseClean = shift;
     $testCaseClean =~ s/::/_/g;
@@ -254,8 +306,8 @@ sub findTestCasesInFile ($) {
         /\*| # a multi-line comment
         //| # a single-line comment
         namespace        $sp+         ($id)         $sp* {| # a new namespace with a scope, the identifier is in $2
-        EgoTest_TestCase $sp* \( $sp* ($id) $sp* \) $sp* {| # a new testcase with a scope, the identifier is in $3
-        EgoTest_Test     $sp* \( $sp* ($id) $sp* \) $sp* {| # a new test with a scope, the identifier is in $4
+        $caseMacro $sp* \( $sp* ($id) $sp* \) $sp* {| # a new testcase with a scope, the identifier is in $3
+        $testMacro $sp* \( $sp* ($id) $sp* \) $sp* {| # a new test with a scope, the identifier is in $4
         {| # a new scope
         } #the end of a scope
     )>x; # x modifier ignores whitespace and comments inside the regex
@@ -287,7 +339,7 @@ sub findTestCasesInFile ($) {
         
             @namespaces = grep { $_->[1] <= $braceCount } @namespaces;
             undef $currentTestCase if $currentTestCase && $currentTestCase->[1] > $braceCount;
-        } elsif ($token eq 'EgoTest_TestCase') {
+        } elsif ($token eq $caseMacro) {
             $braceCount++;
         
             if ($currentTestCase) {
@@ -300,7 +352,7 @@ sub findTestCasesInFile ($) {
         
             $currentTestCase = [$testCase, $braceCount];
             $testCases{$testCase} = [];
-        } elsif ($token eq 'EgoTest_Test') {
+        } elsif ($token eq $testMacro) {
             $braceCount++;
         
             unless ($currentTestCase) {
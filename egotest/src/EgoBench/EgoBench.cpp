@@ -0,0 +1,402 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file EgoBench/EgoBench.cpp
+/// @brief The EgoBench driver: calibration, sampling, statistics, JSON output and baseline comparison.
+/// @ingroup EgoBench
+
+#include "EgoBench/EgoBench.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <vector>
+
+namespace EgoBench
+{
+    std::map<std::string, std::function<int(void)>> getBenchCases();
+}
+
+namespace
+{
+    struct Options
+    {
+        size_t warmup = 3;              ///< Number of samples discarded before measuring.
+        size_t samples = 20;            ///< Number of measured samples.
+        double minSampleTime = 5e6;     ///< Minimum duration of a sample in nanoseconds.
+        double threshold = 0.10;        ///< Relative increase of the median reported as a regression.
+        std::string filter;             ///< Only benchmarks containing this string are run.
+        std::string jsonFile;           ///< File to write the results to.
+        std::string baselineFile;       ///< File to read the baseline results from.
+    };
+
+    struct Result
+    {
+        std::string name;
+        size_t iterations;   ///< Iterations per sample.
+        size_t samples;
+        double median;       ///< Nanoseconds per iteration.
+        double p95;
+        double mean;
+        double stddev;
+        double min;
+        double max;
+    };
+
+    static Options options;
+    static std::vector<Result> results;
+    static std::map<std::string, double> baseline;
+    static EgoBench::BenchCase *currentBenchCase;
+    static int totalBenchesRan;
+
+    enum class ColorCodes : uint8_t
+    {
+        NORMAL = 0,
+        RED    = 31,
+        GREEN  = 32,
+        YELLOW = 33,
+    };
+
+    template<class CharT, class Traits>
+    std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &stream, ColorCodes color)
+    {
+#ifdef _MSC_VER
+        return stream;
+#else
+        return stream << "\033[" << static_cast<uint16_t>(color) << "m";
+#endif
+    }
+
+    /// Format a duration given in nanoseconds with a suitable unit.
+    std::string formatTime(double ns)
+    {
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(2);
+        if (ns < 1e3) os << ns << " ns";
+        else if (ns < 1e6) os << ns / 1e3 << " us";
+        else if (ns < 1e9) os << ns / 1e6 << " ms";
+        else os << ns / 1e9 << " s";
+        return os.str();
+    }
+
+    std::string escapeJson(const std::string &s)
+    {
+        std::string ret;
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\') ret += '\\';
+            ret += c;
+        }
+        return ret;
+    }
+
+    /// Run one sample of a benchmark. Return the nanoseconds per iteration, or a negative value on failure.
+    double runSample(const std::function<void(EgoBench::State&)> &bench, size_t iterations)
+    {
+        EgoBench::State state(iterations);
+        bench(state);
+        if (!state.isFinished())
+        {
+            return -1.0;
+        }
+        return state.getNanoseconds() / iterations;
+    }
+
+    /// Find the number of iterations such that a sample takes at least the minimum sample time.
+    size_t calibrate(const std::function<void(EgoBench::State&)> &bench)
+    {
+        static constexpr size_t MAX_ITERATIONS = 1000000000;
+        size_t iterations = 1;
+        while (iterations < MAX_ITERATIONS)
+        {
+            double perIteration = runSample(bench, iterations);
+            if (perIteration < 0.0)
+            {
+                return 0;
+            }
+            double elapsed = perIteration * iterations;
+            if (elapsed >= options.minSampleTime)
+            {
+                break;
+            }
+            // Grow by the estimated factor (with some headroom), but at most by a factor of 10.
+            double factor = elapsed > 0.0 ? 1.2 * options.minSampleTime / elapsed : 10.0;
+            factor = std::max(2.0, std::min(10.0, factor));
+            iterations = std::min(MAX_ITERATIONS, static_cast<size_t>(iterations * factor));
+        }
+        return iterations;
+    }
+
+    Result summarize(const std::string &name, size_t iterations, std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+        const size_t n = samples.size();
+
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.samples = n;
+        result.min = samples.front();
+        result.max = samples.back();
+        result.median = (n % 2) ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+        // Nearest-rank percentile.
+        result.p95 = samples[static_cast<size_t>(std::ceil(0.95 * n)) - 1];
+
+        double sum = 0.0;
+        for (double sample : samples) sum += sample;
+        result.mean = sum / n;
+
+        double squares = 0.0;
+        for (double sample : samples) squares += (sample - result.mean) * (sample - result.mean);
+        result.stddev = n > 1 ? std::sqrt(squares / (n - 1)) : 0.0;
+        return result;
+    }
+
+    void writeJson(const std::string &fileName)
+    {
+        std::ofstream out(fileName);
+        if (!out)
+        {
+            std::cout << ColorCodes::RED << "Unable to write \"" << fileName << "\".\n" << ColorCodes::NORMAL;
+            return;
+        }
+        out << std::setprecision(6);
+        out << "{\n  \"unit\": \"ns\",\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result &r = results[i];
+            out << "    {\"name\": \"" << escapeJson(r.name) << "\", \"iterations\": " << r.iterations
+                << ", \"samples\": " << r.samples << ", \"median\": " << r.median << ", \"p95\": " << r.p95
+                << ", \"mean\": " << r.mean << ", \"stddev\": " << r.stddev << ", \"min\": " << r.min
+                << ", \"max\": " << r.max << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+    /// Read the medians of a file written by writeJson.
+    bool readBaseline(const std::string &fileName)
+    {
+        std::ifstream in(fileName);
+        if (!in)
+        {
+            return false;
+        }
+        std::stringstream contents;
+        contents << in.rdbuf();
+        const std::string text = contents.str();
+
+        static const std::regex entry("\"name\"\\s*:\\s*\"((?:[^\"\\\\]|\\\\.)*)\"[^}]*\"median\"\\s*:\\s*([-+0-9.eE]+)");
+        for (auto it = std::sregex_iterator(text.begin(), text.end(), entry); it != std::sregex_iterator(); ++it)
+        {
+            std::string name = std::regex_replace((*it)[1].str(), std::regex("\\\\(.)"), "$1");
+            baseline[name] = std::strtod((*it)[2].str().c_str(), nullptr);
+        }
+        return true;
+    }
+
+    /// Get the value of an option of the form "--name=value".
+    bool getOption(const char *argument, const char *name, std::string &value)
+    {
+        size_t length = std::strlen(name);
+        if (std::strncmp(argument, name, length) == 0 && argument[length] == '=')
+        {
+            value = argument + length + 1;
+            return true;
+        }
+        return false;
+    }
+
+    void printUsage(const char *program)
+    {
+        std::cout << "usage: " << program << " [--filter=<substring>] [--samples=<n>] [--warmup=<n>]"
+                  << " [--min-time=<ms>] [--json=<file>] [--baseline=<file>] [--threshold=<percent>]\n";
+    }
+}
+
+namespace EgoBench
+{
+    State::State(size_t iterations) :
+        _iterations(iterations),
+        _remaining(iterations),
+        _finished(false),
+        _start(),
+        _end()
+    {}
+
+    double State::getNanoseconds() const
+    {
+        return std::chrono::duration<double, std::nano>(_end - _start).count();
+    }
+
+    BenchCase::BenchCase()
+    {
+        currentBenchCase = this;
+    }
+
+    BenchCase::~BenchCase()
+    {
+        currentBenchCase = nullptr;
+    }
+
+    void BenchCase::setUp() {}
+    void BenchCase::tearDown() {}
+}
+
+int EgoBench::handleBenchFunc(const std::string &benchName, const std::function<void(State&)> &bench)
+{
+    if (!options.filter.empty() && benchName.find(options.filter) == std::string::npos)
+    {
+        return 0;
+    }
+
+    totalBenchesRan++;
+    std::cout << "Running benchmark '" << benchName << "'...\n";
+
+    try
+    {
+        currentBenchCase->setUp();
+    }
+    catch (...)
+    {
+        std::cout << ColorCodes::RED << "Uncaught exception while setting up.\n" << ColorCodes::NORMAL;
+        return 1;
+    }
+
+    int failures = 0;
+    try
+    {
+        size_t iterations = calibrate(bench);
+        if (0 == iterations)
+        {
+            std::cout << ColorCodes::RED << "Benchmark did not run its loop to completion.\n" << ColorCodes::NORMAL;
+            failures++;
+        }
+        else
+        {
+            for (size_t i = 0; i < options.warmup; ++i)
+            {
+                runSample(bench, iterations);
+            }
+            std::vector<double> samples;
+            for (size_t i = 0; i < options.samples; ++i)
+            {
+                samples.push_back(runSample(bench, iterations));
+            }
+            Result result = summarize(benchName, iterations, samples);
+            results.push_back(result);
+
+            std::cout << "  median " << formatTime(result.median) << ", p95 " << formatTime(result.p95)
+                      << ", stddev " << formatTime(result.stddev) << " (" << result.samples << " x "
+                      << result.iterations << " iterations)\n";
+
+            auto it = baseline.find(benchName);
+            if (it != baseline.end() && it->second > 0.0)
+            {
+                double change = result.median / it->second - 1.0;
+                bool regressed = change > options.threshold;
+                std::cout << (regressed ? ColorCodes::RED : ColorCodes::GREEN)
+                          << "  " << std::showpos << std::fixed << std::setprecision(1) << change * 100.0
+                          << std::noshowpos << "% against baseline " << formatTime(it->second)
+                          << (regressed ? " (regression)" : "") << "\n" << ColorCodes::NORMAL;
+                std::cout.unsetf(std::ios::fixed);
+                if (regressed) failures++;
+            }
+        }
+    }
+    catch (...)
+    {
+        std::cout << ColorCodes::RED << "Uncaught exception in EgoBench::handleBenchFunc.\n" << ColorCodes::NORMAL;
+        failures++;
+    }
+
+    try
+    {
+        currentBenchCase->tearDown();
+    }
+    catch (...)
+    {
+        std::cout << ColorCodes::RED << "Uncaught exception while cleaning up.\n" << ColorCodes::NORMAL;
+        failures++;
+    }
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string value;
+        if (getOption(argv[i], "--filter", value)) options.filter = value;
+        else if (getOption(argv[i], "--samples", value)) options.samples = std::max(1, std::atoi(value.c_str()));
+        else if (getOption(argv[i], "--warmup", value)) options.warmup = std::max(0, std::atoi(value.c_str()));
+        else if (getOption(argv[i], "--min-time", value)) options.minSampleTime = std::atof(value.c_str()) * 1e6;
+        else if (getOption(argv[i], "--json", value)) options.jsonFile = value;
+        else if (getOption(argv[i], "--baseline", value)) options.baselineFile = value;
+        else if (getOption(argv[i], "--threshold", value)) options.threshold = std::atof(value.c_str()) / 100.0;
+        else
+        {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!options.baselineFile.empty() && !readBaseline(options.baselineFile))
+    {
+        std::cout << ColorCodes::YELLOW << "Unable to read baseline \"" << options.baselineFile << "\".\n" << ColorCodes::NORMAL;
+    }
+
+    std::cout << "\n";
+    auto benchCases = EgoBench::getBenchCases();
+    int totalFailures = 0;
+
+    for (const auto &benchCase : benchCases)
+    {
+        totalBenchesRan = 0;
+        try
+        {
+            int failures = benchCase.second();
+            totalFailures += failures;
+            if (totalBenchesRan)
+            {
+                std::cout << "Benchmark case \"" << benchCase.first << "\": " << totalBenchesRan << " benchmarks, "
+                          << failures << " failures\n\n";
+            }
+        }
+        catch (...)
+        {
+            std::cout << ColorCodes::RED << "Benchmark case \"" << benchCase.first << "\" has thrown an exception?\n" << ColorCodes::NORMAL;
+            totalFailures++;
+        }
+    }
+
+    if (!options.jsonFile.empty())
+    {
+        writeJson(options.jsonFile);
+    }
+
+    std::cout << results.size() << " benchmarks measured, " << totalFailures << " failures or regressions.\n\n";
+
+    return totalFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file EgoBench/EgoBench.hpp
+/// @brief Main include for EgoBench, the benchmark counterpart of EgoTest.
+/// @defgroup EgoBench
+/// @details
+/// Benchmarks are registered like EgoTest tests, by scanning the sources with
+/// generate_test_files.pl (in @a bench mode):
+/// @code
+/// EgoBench_BenchCase(Matrix) {
+///     Matrix4f4f a, b;
+///     EgoBench_SetUpBench() { a = ...; b = ...; }
+///     EgoBench_Bench(multiply) {
+///         while (state.keepRunning()) {
+///             EgoBench::doNotOptimize(a * b);
+///         }
+///     }
+/// };
+/// @endcode
+/// Only the body of the @a keepRunning loop is timed.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace EgoBench
+{
+    /// @brief The state of a running benchmark, passed to each benchmark function.
+    class State
+    {
+    public:
+        using Clock = std::chrono::high_resolution_clock;
+
+        explicit State(size_t iterations);
+
+        /// @brief Get if another iteration of the benchmark loop is to be run.
+        /// @remark The timer starts with the first call and stops when @a false is returned.
+        bool keepRunning()
+        {
+            if (_remaining > 0)
+            {
+                if (_remaining == _iterations)
+                {
+                    _start = Clock::now();
+                }
+                _remaining--;
+                return true;
+            }
+            _end = Clock::now();
+            _finished = true;
+            return false;
+        }
+
+        /// @brief Get the number of iterations run in this sample.
+        size_t getIterations() const { return _iterations; }
+
+        /// @brief Get if the benchmark loop ran to completion.
+        bool isFinished() const { return _finished; }
+
+        /// @brief Get the time of the benchmark loop in nanoseconds.
+        double getNanoseconds() const;
+
+    private:
+        size_t _iterations;
+        size_t _remaining;
+        bool _finished;
+        Clock::time_point _start;
+        Clock::time_point _end;
+    };
+
+    /// @brief Prevent the compiler from optimizing away the computation of a value.
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void *sink;
+        sink = &value;
+#endif
+    }
+
+    class BenchCase
+    {
+    protected:
+        BenchCase();
+    public:
+        virtual ~BenchCase();
+        /// @brief Called before a benchmark of this case is run (not before every sample).
+        virtual void setUp();
+        /// @brief Called after a benchmark of this case was run.
+        virtual void tearDown();
+    };
+
+    int handleBenchFunc(const std::string &benchName, const std::function<void(State&)> &bench);
+
+    template <typename T>
+    int handleBench(const std::string &benchName, T bench) {
+        std::function<void(State&)> benchFunc(bench);
+        return handleBenchFunc(benchName, benchFunc);
+    }
+}
+
+#define EgoBench_BenchCase(BENCHCASENAME) \
+struct BENCHCASENAME : ::EgoBench::BenchCase
+
+#define EgoBench_Bench(BENCHNAME) \
+void BENCHNAME(::EgoBench::State& state)
+
+#define EgoBench_SetUpBench() \
+void setUp()
+
+#define EgoBench_TearDownBench() \
+void tearDown()
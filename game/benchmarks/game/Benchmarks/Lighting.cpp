@@ -0,0 +1,114 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+#include "game/lighting.h"
+#include "game/Graphics/DynamicLightClusters.hpp"
+
+namespace Ego {
+namespace Bench {
+
+/// The dynamic lighting of the grid vertices of a visible region, one iteration being one vertex.
+EgoBench_BenchCase(Lighting) {
+    static constexpr size_t TILE_COUNT = 20;
+    static constexpr size_t NUMBER_OF_LIGHTS = 256;
+    static constexpr size_t VERTEX_COUNT = (TILE_COUNT + 1) * (TILE_COUNT + 1);
+
+    ego_frect_t _region;
+    std::vector<dynalight_data_t> _lights;
+    std::vector<ego_frect_t> _bounds;
+    Ego::Graphics::DynamicLightClusters _clusters;
+
+    EgoBench_SetUpBench() {
+        // A particle-heavy fight: many small lights spread over the visible region.
+        const float size = TILE_COUNT * Info<float>::Grid::Size();
+        _region = ego_frect_t{0.0f, 0.0f, size, size};
+        _lights.clear();
+        _bounds.clear();
+        for (size_t i = 0; i < NUMBER_OF_LIGHTS; ++i) {
+            dynalight_data_t light;
+            dynalight_data_t::init(light);
+            light.pos = Vector3f(Random::nextFloat() * size, Random::nextFloat() * size, 50.0f);
+            light.level = 0.5f + Random::nextFloat() * 0.5f;
+            light.falloff = 50.0f + Random::nextFloat() * 350.0f;
+            _lights.push_back(light);
+
+            const float radius = std::sqrt(light.falloff * 765.0f * 0.5f);
+            _bounds.push_back(ego_frect_t{std::max(light.pos[kX] - radius, _region.xmin), std::max(light.pos[kY] - radius, _region.ymin),
+                                          std::min(light.pos[kX] + radius, _region.xmax), std::min(light.pos[kY] + radius, _region.ymax)});
+        }
+        _clusters.rebuild(_region, _bounds, Info<float>::Grid::Size() * 0.5f);
+    }
+
+    void lightVertex(size_t vertex, uint32_t light, LightingVector& lighting) {
+        const float x0 = (vertex % (TILE_COUNT + 1)) * Info<float>::Grid::Size();
+        const float y0 = (vertex / (TILE_COUNT + 1)) * Info<float>::Grid::Size();
+        const float half = Info<float>::Grid::Size() * 0.5f;
+        const ego_frect_t& bound = _bounds[light];
+        if (x0 - half > bound.xmax || x0 + half < bound.xmin) return;
+        if (y0 - half > bound.ymax || y0 + half < bound.ymin) return;
+        const dynalight_data_t& pdyna = _lights[light];
+        sum_dyna_lighting(&pdyna, lighting, Vector3f(pdyna.pos[kX] - x0, pdyna.pos[kY] - y0, pdyna.pos[kZ]));
+    }
+
+    EgoBench_Bench(perVertexAllLights) {
+        size_t vertex = 0;
+        while (state.keepRunning()) {
+            LightingVector lighting = {0};
+            for (uint32_t light = 0; light < _lights.size(); ++light) {
+                lightVertex(vertex, light, lighting);
+            }
+            EgoBench::doNotOptimize(lighting);
+            vertex = (vertex + 1) % VERTEX_COUNT;
+        }
+    }
+
+    EgoBench_Bench(perVertexClustered) {
+        size_t vertex = 0;
+        while (state.keepRunning()) {
+            LightingVector lighting = {0};
+            const float x0 = (vertex % (TILE_COUNT + 1)) * Info<float>::Grid::Size();
+            const float y0 = (vertex / (TILE_COUNT + 1)) * Info<float>::Grid::Size();
+            for (uint32_t light : _clusters.get(x0, y0)) {
+                lightVertex(vertex, light, lighting);
+            }
+            EgoBench::doNotOptimize(lighting);
+            vertex = (vertex + 1) % VERTEX_COUNT;
+        }
+    }
+
+    EgoBench_Bench(binLights) {
+        while (state.keepRunning()) {
+            _clusters.rebuild(_region, _bounds, Info<float>::Grid::Size() * 0.5f);
+            EgoBench::doNotOptimize(_clusters.getClusterCount());
+        }
+    }
+
+    EgoBench_Bench(selectLights) {
+        while (state.keepRunning()) {
+            std::vector<dynalight_data_t> lights = _lights;
+            dyna_lighting_select(lights, 64);
+            EgoBench::doNotOptimize(lights.size());
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
@@ -0,0 +1,108 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+#include "egolib/AI/AStar.hpp"
+#include "egolib/AI/LineOfSight.hpp"
+#include "game/mesh.h"
+
+namespace Ego {
+namespace Bench {
+
+EgoBench_BenchCase(Mesh) {
+    static constexpr size_t TILE_COUNT = 64;
+    static constexpr size_t NUMBER_OF_QUERIES = 256;
+
+    std::shared_ptr<ego_mesh_t> _mesh;
+    std::vector<Vector3f> _positions;
+
+    EgoBench_SetUpBench() {
+        // A mesh with a border of walls and about one in six tiles being a wall.
+        _mesh = std::make_shared<ego_mesh_t>(Ego::MeshInfo(TILE_COUNT, TILE_COUNT));
+        for (size_t y = 0; y < TILE_COUNT; ++y) {
+            for (size_t x = 0; x < TILE_COUNT; ++x) {
+                bool border = 0 == x || 0 == y || TILE_COUNT - 1 == x || TILE_COUNT - 1 == y;
+                if (border || 0 == Random::next(5)) {
+                    _mesh->add_fx(_mesh->getTileIndex(Index2D(x, y)), MAPFX_WALL | MAPFX_IMPASS);
+                }
+            }
+        }
+        _positions.clear();
+        for (size_t i = 0; i < NUMBER_OF_QUERIES; ++i) {
+            _positions.emplace_back(Random::nextFloat() * TILE_COUNT * Info<float>::Grid::Size(),
+                                    Random::nextFloat() * TILE_COUNT * Info<float>::Grid::Size(), 0.0f);
+        }
+    }
+
+    EgoBench_TearDownBench() {
+        _mesh = nullptr;
+    }
+
+    EgoBench_Bench(getPressure) {
+        size_t i = 0;
+        while (state.keepRunning()) {
+            float pressure = _mesh->get_pressure(_positions[i++ % NUMBER_OF_QUERIES], 40.0f, MAPFX_WALL | MAPFX_IMPASS);
+            EgoBench::doNotOptimize(pressure);
+        }
+    }
+
+    void lineOfSight(EgoBench::State& state, bool cached) {
+        line_of_sight_info_t::setCachesEnabled(cached);
+        size_t i = 0;
+        while (state.keepRunning()) {
+            // Few distinct pairs, like AIs looking at the same targets frame after frame.
+            const Vector3f& source = _positions[i % 16];
+            const Vector3f& target = _positions[16 + (i * 7) % 16];
+            line_of_sight_info_t los;
+            los.x0 = source[kX]; los.y0 = source[kY]; los.z0 = source[kZ];
+            los.x1 = target[kX]; los.y1 = target[kY]; los.z1 = target[kZ];
+            los.stopped_by = MAPFX_WALL | MAPFX_IMPASS;
+            bool blocked = line_of_sight_info_t::with_mesh(los, _mesh);
+            EgoBench::doNotOptimize(blocked);
+            ++i;
+        }
+        line_of_sight_info_t::setCachesEnabled(true);
+    }
+
+    EgoBench_Bench(lineOfSightCached) {
+        lineOfSight(state, true);
+    }
+
+    EgoBench_Bench(lineOfSightUncached) {
+        lineOfSight(state, false);
+    }
+
+    EgoBench_Bench(findPath) {
+        AStar astar;
+        size_t i = 0;
+        while (state.keepRunning()) {
+            const Vector3f& source = _positions[i % NUMBER_OF_QUERIES];
+            const Vector3f& target = _positions[(i + 1) % NUMBER_OF_QUERIES];
+            bool found = astar.find_path(_mesh, MAPFX_WALL | MAPFX_IMPASS,
+                                         source[kX] / Info<float>::Grid::Size(), source[kY] / Info<float>::Grid::Size(),
+                                         target[kX] / Info<float>::Grid::Size(), target[kY] / Info<float>::Grid::Size());
+            EgoBench::doNotOptimize(found);
+            ++i;
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
@@ -0,0 +1,87 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "egolib/egolib.h"
+#include "game/graphic_prt.h"
+#include "game/lighting.h"
+#include "game/mesh.h"
+#include "game/Entities/_Include.hpp"
+
+namespace Ego {
+namespace Bench {
+
+/// The per-frame particle instance update of update_all_prt_instance(), one iteration being all particles.
+/// Each particle gets the lighting part of its instance update, which needs no camera or loaded module.
+EgoBench_BenchCase(Particles) {
+    static constexpr size_t TILE_COUNT = 64;
+    static constexpr size_t NUMBER_OF_PARTICLES = 4096;
+
+    std::shared_ptr<ego_mesh_t> _mesh;
+    std::vector<std::shared_ptr<Ego::Particle>> _particles;
+
+    EgoBench_SetUpBench() {
+        _mesh = std::make_shared<ego_mesh_t>(Ego::MeshInfo(TILE_COUNT, TILE_COUNT));
+        _particles.clear();
+        for (size_t i = 0; i < NUMBER_OF_PARTICLES; ++i) {
+            auto particle = std::make_shared<Ego::Particle>();
+            particle->inst.pos = Vector3f(Random::nextFloat() * TILE_COUNT * Info<float>::Grid::Size(),
+                                          Random::nextFloat() * TILE_COUNT * Info<float>::Grid::Size(), 50.0f);
+            particle->inst.size = 1.0f + Random::nextFloat() * 16.0f;
+            particle->inst.nrm = Vector3f(0.0f, 0.0f, 1.0f);
+            _particles.push_back(particle);
+        }
+    }
+
+    EgoBench_TearDownBench() {
+        _particles.clear();
+        _mesh = nullptr;
+    }
+
+    gfx_rv updateLighting(Ego::Particle& particle) {
+        prt_instance_t& inst = particle.inst;
+        lighting_cache_t global_light;
+        GridIllumination::grid_lighting_interpolate(*_mesh, global_light, Vector2f(inst.pos[kX], inst.pos[kY]));
+        lighting_cache_t loc_light;
+        lighting_cache_t::lighting_project_cache(loc_light, global_light, prt_instance_t::make_matrix(inst));
+        float amb, dir;
+        lighting_cache_t::lighting_evaluate_cache(loc_light, inst.nrm, inst.pos[kZ], _mesh->_tmem._bbox, &amb, &dir);
+        inst.fintens = amb + dir;
+        return gfx_success;
+    }
+
+    void update(EgoBench::State& state, size_t numberOfThreads) {
+        while (state.keepRunning()) {
+            gfx_rv result = update_prt_instances(_particles.begin(), _particles.end(), numberOfThreads,
+                                                 [this](Ego::Particle& particle) { return updateLighting(particle); });
+            EgoBench::doNotOptimize(result);
+        }
+    }
+
+    EgoBench_Bench(updateSerial) {
+        update(state, 1);
+    }
+
+    EgoBench_Bench(updateParallel) {
+        update(state, std::max(1U, std::thread::hardware_concurrency()));
+    }
+};
+
+} // namespace Bench
+} // namespace Ego
@@ -26,9 +26,10 @@
 
 static int get_grip_verts( Uint16 grip_verts[], const ObjectRef imount, int vrt_offset );
 
-static egolib_rv matrix_cache_needs_update( Object * pchr, matrix_cache_t& pmc );
+static egolib_rv matrix_cache_needs_update( Object * pchr, matrix_cache_t& pmc, bool update_mounts );
 static bool apply_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp );
-static bool chr_get_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp );
+static bool chr_get_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp, bool update_mounts );
+static Object *chr_get_matrix_parent( const Object * pchr );
 
 static bool apply_one_character_matrix( Object * pchr, matrix_cache_t& mcache );
 static bool apply_one_weapon_matrix( Object * pweap, matrix_cache_t& mcache );
@@ -166,10 +167,11 @@ int get_grip_verts( Uint16 grip_verts[], const ObjectRef imount, int vrt_offset
 }
 
 //--------------------------------------------------------------------------------------------
-bool chr_get_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp )
+bool chr_get_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp, bool update_mounts )
 {
     /// @author BB
     /// @details grab the matrix cache data for a given character and put it into mc_tmp.
+    ///     If update_mounts is false, the matrix of the overlay target or mount must be up to date.
     if ( nullptr == pchr ) return false;
     auto ichr = GET_INDEX_PCHR( pchr );
 
@@ -190,7 +192,7 @@ bool chr_get_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp )
         Object * ptarget = _currentModule->getObjectHandler().get( pchr->ai.getTarget() );
 
         // make sure we have the latst info from the target
-        chr_update_matrix( ptarget, true );
+        if ( update_mounts ) chr_update_matrix( ptarget, true );
 
         // grab the matrix cache into from the character we are overlaying
         mc_tmp = ptarget->inst.matrix_cache;
@@ -212,7 +214,7 @@ bool chr_get_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp )
             Object * pmount = _currentModule->getObjectHandler().get( pchr->attachedto );
 
             // make sure we have the latst info from the target
-            chr_update_matrix( pmount, true );
+            if ( update_mounts ) chr_update_matrix( pmount, true );
 
             // just in case the mounts's matrix cannot be corrected
             // then treat it as if it is not mounted... yuck
@@ -375,7 +377,7 @@ bool apply_one_weapon_matrix( Object * pweap, matrix_cache_t& mc_tmp )
         pweap->setPosition(Vector3f(nupoint[0][kX],nupoint[0][kY],nupoint[0][kZ]));
 
         // make sure we have the right data
-        chr_get_matrix_cache( pweap, mc_tmp );
+        chr_get_matrix_cache( pweap, mc_tmp, true );
 
         // add in the appropriate mods
         // this is a hybrid character and weapon matrix
@@ -484,7 +486,7 @@ bool apply_matrix_cache( Object * pchr, matrix_cache_t& mc_tmp )
 }
 
 //--------------------------------------------------------------------------------------------
-egolib_rv matrix_cache_needs_update( Object * pchr, matrix_cache_t& pmc )
+egolib_rv matrix_cache_needs_update( Object * pchr, matrix_cache_t& pmc, bool update_mounts )
 {
     /// @author BB
     /// @details determine whether a matrix cache has become invalid and needs to be updated
@@ -492,7 +494,7 @@ egolib_rv matrix_cache_needs_update( Object * pchr, matrix_cache_t& pmc )
     if ( nullptr == pchr ) return rv_error;
 
     // get the matrix data that is supposed to be used to make the matrix
-    chr_get_matrix_cache( pchr, pmc );
+    chr_get_matrix_cache( pchr, pmc, update_mounts );
 
     // compare that data to the actual data used to make the matrix
     return !(pmc == pchr->inst.matrix_cache) ? rv_success : rv_fail;
@@ -533,7 +535,7 @@ egolib_rv chr_update_matrix( Object * pchr, bool update_size )
 
     // does the matrix cache need an update at all?
     matrix_cache_t mc_tmp;
-    egolib_rv retval = matrix_cache_needs_update( pchr, mc_tmp );
+    egolib_rv retval = matrix_cache_needs_update( pchr, mc_tmp, true );
     if ( rv_error == retval ) return rv_error;
     needs_update = ( rv_success == retval );
 
@@ -566,6 +568,143 @@ egolib_rv chr_update_matrix( Object * pchr, bool update_size )
     return rv_fail;
 }
 
+//--------------------------------------------------------------------------------------------
+Object *chr_get_matrix_parent( const Object * pchr )
+{
+    /// @details Get the object whose matrix the matrix of this character is made from, if any.
+
+    const ObjectRef ichr = pchr->getObjRef();
+
+    if ( pchr->is_overlay && ichr != pchr->ai.getTarget() && _currentModule->getObjectHandler().exists( pchr->ai.getTarget() ) )
+    {
+        return _currentModule->getObjectHandler().get( pchr->ai.getTarget() );
+    }
+
+    if ( _currentModule->getObjectHandler().exists( pchr->attachedto ) )
+    {
+        return _currentModule->getObjectHandler().get( pchr->attachedto );
+    }
+
+    return nullptr;
+}
+
+//--------------------------------------------------------------------------------------------
+namespace
+{
+    /// An object of a matrix batch.
+    struct MatrixBatchEntry
+    {
+        Object *object;
+        /// The object this object is held by or is an overlay of, if any.
+        Object *parent;
+        /// The length of the chain of parents.
+        uint32_t depth;
+        /// The matrix of the parent is rebuilt in this batch.
+        bool parent_dirty;
+        matrix_cache_t cache;
+    };
+
+    /// The number of matrix batches so far.
+    uint32_t matrix_batch_count = 0;
+
+    /// The storage of the matrix batch, kept to avoid reallocations.
+    std::vector<MatrixBatchEntry> matrix_batch_entries;
+    std::vector<size_t> matrix_batch_dirty;
+
+    /// Chains of holders longer than this are considered to be cycles.
+    const uint32_t MATRIX_BATCH_MAX_DEPTH = 16;
+}
+
+void update_all_character_matrices()
+{
+    /// @details Update the matrices of all characters in a single pass.
+    ///     The characters are ordered such that holders (and the targets of overlays)
+    ///     come before the items they hold. The characters whose matrix inputs did not
+    ///     change (and whose holder did not change) are skipped, the matrices of the
+    ///     others are then rebuilt in one loop.
+
+    EGO_PROFILE_ZONE("render.prepare.characterMatrices");
+
+    // zero is the batch of a cache which was never found dirty
+    if ( 0 == ++matrix_batch_count ) matrix_batch_count = 1;
+    const uint32_t batch = matrix_batch_count;
+
+    std::vector<MatrixBatchEntry>& entries = matrix_batch_entries;
+    std::vector<size_t>& dirty = matrix_batch_dirty;
+    entries.clear();
+    dirty.clear();
+
+    // gather the characters and the length of their chains of holders
+    for ( const std::shared_ptr<Object> &object : _currentModule->getObjectHandler().iterator() )
+    {
+        if ( object->isTerminated() || object->isInsideInventory() ) continue;
+
+        // skip objects outside the map
+        if ( !_currentModule->getMeshPointer()->grid_is_valid( object->getTile() ) ) continue;
+
+        MatrixBatchEntry entry;
+        entry.object = object.get();
+        entry.parent = chr_get_matrix_parent( entry.object );
+        entry.depth = 0;
+        entry.parent_dirty = false;
+        for ( Object *parent = entry.parent; nullptr != parent && entry.depth < MATRIX_BATCH_MAX_DEPTH; parent = chr_get_matrix_parent( parent ) )
+        {
+            entry.depth++;
+        }
+        entries.push_back( entry );
+    }
+
+    // order the holders before the held items
+    std::stable_sort( entries.begin(), entries.end(),
+                      []( const MatrixBatchEntry& x, const MatrixBatchEntry& y ) { return x.depth < y.depth; } );
+
+    // find the dirty matrices
+    for ( size_t i = 0; i < entries.size(); ++i )
+    {
+        MatrixBatchEntry& entry = entries[i];
+        matrix_cache_t& mcache = entry.object->inst.matrix_cache;
+
+        entry.parent_dirty = nullptr != entry.parent && batch == entry.parent->inst.matrix_cache.batch;
+
+        egolib_rv retval = matrix_cache_needs_update( entry.object, entry.cache, false );
+        if ( rv_error == retval ) continue;
+        bool needs_update = entry.parent_dirty || !mcache.matrix_valid || rv_success == retval;
+
+        // has the holder changed its animation?
+        const std::shared_ptr<Object> &holder = _currentModule->getObjectHandler()[entry.cache.grip_chr];
+        if ( HAS_SOME_BITS( entry.cache.type_bits, MAT_WEAPON ) && holder )
+        {
+            if ( holder->inst.updateGripVertices( entry.cache.grip_verts.data(), GRIP_VERTS ) )
+            {
+                needs_update = true;
+            }
+        }
+
+        if ( needs_update )
+        {
+            mcache.batch = batch;
+            dirty.push_back( i );
+        }
+    }
+
+    // rebuild the dirty matrices, holders first
+    for ( size_t i : dirty )
+    {
+        MatrixBatchEntry& entry = entries[i];
+
+        // the cache data of the parent was stale when it was grabbed
+        if ( entry.parent_dirty )
+        {
+            chr_get_matrix_cache( entry.object, entry.cache, false );
+        }
+
+        entry.object->inst.matrix_cache.matrix_valid = false;
+        apply_matrix_cache( entry.object, entry.cache );
+
+        // applying the cache replaces the batch
+        entry.object->inst.matrix_cache.batch = batch;
+    }
+}
 
 //--------------------------------------------------------------------------------------------
 bool chr_getMatUp(Object *pchr, Vector3f& up)
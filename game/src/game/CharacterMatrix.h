@@ -51,7 +51,8 @@ struct matrix_cache_t : public Id::EqualToExpr<matrix_cache_t>
         grip_slot(SLOT_LEFT),
         grip_verts(),
         grip_scale(),
-        self_scale()
+        self_scale(),
+        batch(0)
     {
         grip_verts.fill(0xFFFF);
     }
@@ -84,6 +85,9 @@ struct matrix_cache_t : public Id::EqualToExpr<matrix_cache_t>
     // the body fixed scaling
     Vector3f  self_scale;
 
+    // the matrix batch which last found this cache dirty, not part of the comparison
+    uint32_t batch;
+
     /**
      * Get if this matrix cache is valid.
      * @return @a true if this matrix cache is valid, @a false otherwise
@@ -101,4 +105,5 @@ egolib_rv chr_update_matrix( Object * pchr, bool update_size );
 bool set_weapongrip( const ObjectRef iitem, const ObjectRef iholder, uint16_t vrt_off );
 bool chr_getMatUp(Object *pchr, Vector3f& up);
 void make_one_character_matrix( const ObjectRef object_ref );
+void update_all_character_matrices();
 bool chr_calc_grip_cv( Object * pmount, int grip_offset, oct_bb_t * grip_cv_ptr, const bool shift_origin );
@@ -19,6 +19,8 @@
 /// @author Johan Jansen
 
 #include "game/Core/GameEngine.hpp"
+#include "game/Core/HeadlessRunner.hpp"
+#include "game/Core/InputRecording.hpp"
 #include "egolib/egolib.h"
 #include "game/Graphics/CameraSystem.hpp"
 #include "game/GameStates/MainMenuState.hpp"
@@ -29,6 +31,7 @@
 #include "egolib/InputControl/ControlSettingsFile.hpp"
 #include "game/GUI/UIManager.hpp"
 #include "game/graphic.h"
+#include "game/graphic_billboard.h"
 #include "game/game.h"
 #include "game/Entities/_Include.hpp"
 #include "game/Physics/CollisionSystem.hpp"
@@ -48,6 +51,17 @@ const uint32_t GameEngine::MAX_FRAMESKIP;
 const std::string GameEngine::GAME_VERSION = "2.9.0";
 
 GameEngine::GameEngine() :
+    // Subscriptions
+    shown(),
+    hidden(),
+    resized(),
+#if 0
+    mouseEntered(),
+    mouseLeft(),
+    keyboardFocusReceived(),
+    keyboardFocusLost(),
+#endif
+
     _startupTimestamp(),
 	_terminateRequested(false),
 	_updateTimeout(0),
@@ -69,16 +83,8 @@ GameEngine::GameEngine() :
 
     _totalFramesRendered(0),
 
-    // Subscriptions
-    shown(),
-    hidden(),
-    resized(),
-#if 0
-    mouseEntered(),
-    mouseLeft(),
-    keyboardFocusReceived(),
-    keyboardFocusLost(),
-#endif
+    _headless(false),
+
     // Submodules
     _uiManager(nullptr)
 {
@@ -163,6 +169,43 @@ void GameEngine::start()
     uninitialize();
 }
 
+int GameEngine::startHeadless(HeadlessRunner& runner)
+{
+    _headless = true;
+    initialize();
+    _startupTimestamp = std::chrono::high_resolution_clock::now();
+
+    auto run = [this, &runner]()
+    {
+        g_updatePhaseTimings.reset();
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t tick = 0; tick < runner.getTicks() && !_terminateRequested; ++tick)
+        {
+            updateOneFrame();
+        }
+        runner.report(std::chrono::high_resolution_clock::now() - start);
+    };
+
+    bool success = runner.loadModule();
+    if (success)
+    {
+        run();
+    }
+    // A round trip replays the run it just recorded.
+    if (success && runner.isRoundTrip())
+    {
+        success = runner.beginReplay();
+        if (success)
+        {
+            run();
+        }
+    }
+    const int result = success && runner.isInSync() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+    uninitialize();
+    return result;
+}
+
 void GameEngine::estimateFrameRate()
 {
     const uint64_t now = getMicros();
@@ -238,6 +281,9 @@ void GameEngine::renderOneFrame()
     _currentGameState->drawAll(drawingContext);
     _totalFramesRendered++;
 
+    // Start a new frame of the font cache statistics
+    Ego::FontManager::get().endFrame();
+
     //Draw mouse cursor last
     if(_drawCursor)
     {
@@ -256,7 +302,7 @@ void GameEngine::renderOneFrame()
             _screenshotReady = false;
             _screenshotRequested = false;
             
-            if (!_uiManager->dumpScreenshot())
+            if (!_uiManager || !_uiManager->dumpScreenshot())
             {
                 DisplayMsg_printf("Error writing screenshot!"); // send a failure message to the screen
 				Log::get().warn("Error writing screenshot\n");      // Log the error in log.txt
@@ -271,6 +317,11 @@ void GameEngine::renderOneFrame()
 
 void GameEngine::renderPreloadText(const std::string &text)
 {
+    if (_headless)
+    {
+        return;
+    }
+
     static std::string preloadText("");
 
     preloadText += text + "\n";
@@ -310,15 +361,24 @@ bool GameEngine::initialize()
     /* ********************************************************************************** */
 
 
-    // Initialize the GFX system.
-    GFX::initialize();
-    
-    // Subscribe to window events.
-    subscribe();
+    if (_headless)
+    {
+        // Initialize the image, texture and font managers without OpenGL and without a renderer.
+        Ego::App::initializeHeadless();
+        BillboardSystem::initialize();
+    }
+    else
+    {
+        // Initialize the GFX system.
+        GFX::initialize();
+
+        // Subscribe to window events.
+        subscribe();
+    }
 
 	// TODO: REMOVE THIS.
 	gfx_system_init_all_graphics();
-	gfx_do_clear_screen();
+	if (!_headless) gfx_do_clear_screen();
 
 	// Initialize the audio system.
 	AudioSystem::initialize();
@@ -330,11 +390,15 @@ bool GameEngine::initialize()
 	Ego::Core::ConsoleHandler::initialize();
 
 
-    // load the bitmapped font (must be done after gfx_system_init_all_graphics())
-    font_bmp_load_vfs("mp_data/font_new_shadow", "mp_data/font.txt");
+    // A headless run has no screen: it loads no bitmapped font and has no system gui.
+    if (!_headless)
+    {
+        // load the bitmapped font (must be done after gfx_system_init_all_graphics())
+        font_bmp_load_vfs("mp_data/font_new_shadow", "mp_data/font.txt");
 
-    // setup the system gui
-    _uiManager = std::make_unique<Ego::GUI::UIManager>();
+        // setup the system gui
+        _uiManager = std::make_unique<Ego::GUI::UIManager>();
+    }
 
     //Tell them we are loading the game (This is earliest point we can render text to screen)
     renderPreloadText("Initializing game...");
@@ -347,8 +411,11 @@ bool GameEngine::initialize()
     // Initialize the sound system.
     renderPreloadText("Loading audio...");
     auto& audioSystem = AudioSystem::get();
-    audioSystem.loadAllMusic();
-    playMainMenuSong();
+    if (!_headless)
+    {
+        audioSystem.loadAllMusic();
+        playMainMenuSong();
+    }
     audioSystem.loadGlobalSounds();
 
     // synchronize the config values with the various game subsystems
@@ -381,8 +448,11 @@ bool GameEngine::initialize()
     renderPreloadText("Finished!");
     vfs_empty_temp_directories();
 
-    //Start the main menu
-    pushGameState(std::make_shared<MainMenuState>());
+    //Start the main menu (a headless run pushes the PlayingState of its module instead)
+    if (!_headless)
+    {
+        pushGameState(std::make_shared<MainMenuState>());
+    }
 
     return true;
 }
@@ -432,6 +502,7 @@ void GameEngine::uninitialize()
 
     _gameStateStack.clear();
     _currentGameState.reset();
+    InputRecording::endModule();
     _currentModule.release();
 
     // synchronize the config values with the various game subsystems
@@ -464,11 +535,19 @@ void GameEngine::uninitialize()
     // Uninitialize the audio system.
     AudioSystem::uninitialize();
 
-    // Unsubscribe from window events.
-    unsubscribe();
-    
-    // Uninitialize the GFX system.
-    GFX::uninitialize();
+    if (_headless)
+    {
+        BillboardSystem::uninitialize();
+        Ego::App::uninitialize();
+    }
+    else
+    {
+        // Unsubscribe from window events.
+        unsubscribe();
+
+        // Uninitialize the GFX system.
+        GFX::uninitialize();
+    }
 
     // Uninitialize the image manager.
     Ego::ImageManager::uninitialize();
@@ -594,14 +673,30 @@ std::shared_ptr<PlayingState> GameEngine::getActivePlayingState() const
  */
 int SDL_main(int argc, char **argv)
 {
+    int result = EXIT_SUCCESS;
     try
     {
+        HeadlessRunner headlessRunner;
+        const bool headless = headlessRunner.parseArguments(argc, argv);
+        if (headless)
+        {
+            // Neither a display nor an audio device is required to run headless.
+            SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+            SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+        }
         Ego::Core::System::initialize(std::string(argv[0]));
         try
         {
             _gameEngine = std::make_unique<GameEngine>();
 
-            _gameEngine->start();
+            if (headless)
+            {
+                result = _gameEngine->startHeadless(headlessRunner);
+            }
+            else
+            {
+                _gameEngine->start();
+            }
         }
         catch (...)
         {
@@ -645,7 +740,7 @@ int SDL_main(int argc, char **argv)
 
         return EXIT_FAILURE;
     }
-    return EXIT_SUCCESS;
+    return result;
 }
 
 uint32_t GameEngine::getCurrentUpdateFrame() const
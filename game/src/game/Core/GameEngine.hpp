@@ -36,6 +36,7 @@ class UIManager;
 } // namespace GUI
 } // namespace Ego
 class PlayingState;
+class HeadlessRunner;
 
 class GameEngine
 {
@@ -77,6 +78,15 @@ public:
     **/
     void start();
 
+    /**
+    * @brief
+    *	A blocking function like start() that, instead of entering the MainLoop, loads the module of
+    *	the HeadlessRunner and updates it as fast as possible without rendering any frames.
+    * @return
+    *	EXIT_SUCCESS if the module was loaded and run, EXIT_FAILURE otherwise
+    **/
+    int startHeadless(HeadlessRunner& runner);
+
     /**
     * @return
     *	true if the GameEngine is currently running and is not terminated
@@ -161,9 +171,19 @@ public:
         _drawCursor = false;
     }
 
+    /**
+    * @brief
+    *   Get if this GameEngine was started by startHeadless(), without a window, OpenGL or a renderer
+    **/
+    inline bool isHeadless() const {
+        return _headless;
+    }
+
     /**
     * @brief
     *	Get instance of the UIManager associated with the current GameEngine
+    * @return
+    *   the UIManager, @a nullptr if this GameEngine is headless
     **/
     inline const std::unique_ptr<Ego::GUI::UIManager>& getUIManager() const {
         return _uiManager;
@@ -217,6 +237,7 @@ private:
     /**
     * @brief
     *	Initializes all SDL subsystems and loads settings and any resources before the game is started.
+    *	If the GameEngine is headless, the window is never shown and neither OpenGL nor a renderer is initialized.
     **/
     bool initialize();
 
@@ -268,6 +289,8 @@ private:
 
     uint32_t _totalFramesRendered; ///< The total number of frames drawn so far
 
+    bool _headless;                             ///< true if started by startHeadless(), without a window, OpenGL or a renderer
+
     //GameEngine Submodules
     std::unique_ptr<Ego::GUI::UIManager> _uiManager;
 };
@@ -0,0 +1,268 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Core/HeadlessRunner.cpp
+/// @brief Runs the game simulation of a module without rendering and frame limiter.
+
+#include "game/Core/HeadlessRunner.hpp"
+#include "game/Core/GameEngine.hpp"
+#include "game/Core/InputRecording.hpp"
+#include "game/GameStates/PlayingState.hpp"
+#include "game/Graphics/CameraSystem.hpp"
+#include "game/Entities/_Include.hpp"
+#include "game/Module/Module.hpp"
+#include "game/graphic.h"
+#include "game/graphic_billboard.h"
+#include "game/game.h"
+#include "game/link.h"
+
+namespace {
+
+uint32_t parseNumber(const std::string& option, const std::string& value)
+{
+    try
+    {
+        return static_cast<uint32_t>(std::stoul(value));
+    }
+    catch (const std::exception&)
+    {
+        throw Id::InvalidArgumentException(__FILE__, __LINE__, "invalid value `" + value + "` for " + option);
+    }
+}
+
+} // namespace
+
+const std::string HeadlessRunner::DEFAULT_ROUND_TRIP_PATH = "roundtrip.txt";
+
+HeadlessRunner::HeadlessRunner() :
+    _moduleName(),
+    _playerPath(),
+    _ticks(DEFAULT_TICKS),
+    _seed(DEFAULT_SEED),
+    _replay(false),
+    _roundTripPath()
+{
+    //ctor
+}
+
+bool HeadlessRunner::parseArguments(int argc, char **argv)
+{
+    bool headless = false;
+    bool ticks = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--headless")
+        {
+            if (i + 1 >= argc)
+            {
+                throw Id::InvalidArgumentException(__FILE__, __LINE__, "--headless requires a module folder name");
+            }
+            _moduleName = argv[++i];
+            headless = true;
+        }
+        else if (argument.compare(0, 8, "--ticks=") == 0)
+        {
+            _ticks = parseNumber("--ticks", argument.substr(8));
+            ticks = true;
+        }
+        else if (argument.compare(0, 7, "--seed=") == 0)
+        {
+            _seed = parseNumber("--seed", argument.substr(7));
+        }
+        else if (argument.compare(0, 9, "--player=") == 0)
+        {
+            _playerPath = argument.substr(9);
+            // A plain name refers to a saved player
+            if (_playerPath.find('/') == std::string::npos)
+            {
+                _playerPath = "mp_players/" + _playerPath;
+            }
+        }
+        else if (argument.compare(0, 9, "--record=") == 0)
+        {
+            InputRecording::setRecordPath(argument.substr(9));
+        }
+        else if (argument.compare(0, 9, "--replay=") == 0)
+        {
+            g_inputRecording = InputRecording::load(argument.substr(9));
+            _replay = true;
+        }
+        else if (argument == "--roundtrip")
+        {
+            _roundTripPath = DEFAULT_ROUND_TRIP_PATH;
+        }
+        else if (argument.compare(0, 12, "--roundtrip=") == 0)
+        {
+            _roundTripPath = argument.substr(12);
+        }
+    }
+
+    if (isRoundTrip())
+    {
+        if (_replay)
+        {
+            throw Id::InvalidArgumentException(__FILE__, __LINE__, "--roundtrip can not be combined with --replay");
+        }
+        if (!headless)
+        {
+            throw Id::InvalidArgumentException(__FILE__, __LINE__, "--roundtrip requires --headless");
+        }
+        InputRecording::setRecordPath(_roundTripPath);
+    }
+
+    if (_replay)
+    {
+        _moduleName = g_inputRecording->getModuleName();
+        _seed = g_inputRecording->getSeed();
+        if (!g_inputRecording->getPlayers().empty())
+        {
+            _playerPath = g_inputRecording->getPlayers().front();
+        }
+        if (!ticks)
+        {
+            _ticks = g_inputRecording->getTickCount();
+        }
+        headless = true;
+    }
+    return headless;
+}
+
+std::shared_ptr<ModuleProfile> HeadlessRunner::findModule() const
+{
+    for (const std::shared_ptr<ModuleProfile>& module : ProfileSystem::get().getModuleProfiles())
+    {
+        if (module->getFolderName() == _moduleName)
+        {
+            return module;
+        }
+    }
+    return nullptr;
+}
+
+bool HeadlessRunner::loadModule()
+{
+    std::shared_ptr<ModuleProfile> module = findModule();
+    if (!module)
+    {
+        Log::get().warn("headless: unable to find module `%s`\n", _moduleName.c_str());
+        return false;
+    }
+
+    // The same steps as LoadingState::loadModuleData(), minus the progress display and music
+    game_quit_module();
+    BillboardSystem::get().reset();
+    if (!link_build_vfs("mp_data/link.txt", LinkList)) Log::get().warn("Failed to initialize module linking\n");
+    ProfileSystem::get().reset();
+    gfx_system_make_enviro();
+
+    std::list<std::string> playersToLoad;
+    if (!_playerPath.empty())
+    {
+        playersToLoad.push_back(_playerPath);
+        if (!game_import_players(playersToLoad))
+        {
+            Log::get().warn("headless: failed to load player `%s`\n", _playerPath.c_str());
+            return false;
+        }
+    }
+
+    if (!game_begin_module(module, _seed))
+    {
+        Log::get().warn("headless: failed to load module `%s`\n", _moduleName.c_str());
+        return false;
+    }
+    _currentModule->setImportPlayers(playersToLoad);
+
+    CameraSystem::get().initialize(local_stats.player_count);
+    config_synch(egoboo_config_t::get(), true, false);
+    // The tile set is not loaded: it is only needed for rendering and requires OpenGL.
+
+    _gameEngine->pushGameState(std::make_shared<PlayingState>());
+    return true;
+}
+
+bool HeadlessRunner::beginReplay()
+{
+    // Ending the module saves its recording
+    game_quit_module();
+    try
+    {
+        g_inputRecording = InputRecording::load(_roundTripPath);
+    }
+    catch (const Id::RuntimeErrorException& ex)
+    {
+        Log::get().warn("headless: %s\n", ((std::string)ex).c_str());
+        return false;
+    }
+    _replay = true;
+    return loadModule();
+}
+
+void HeadlessRunner::report(std::chrono::high_resolution_clock::duration elapsed) const
+{
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    const double totalMs = std::chrono::duration_cast<Milliseconds>(elapsed).count();
+    const uint32_t updates = g_updatePhaseTimings.updates;
+
+    std::ostringstream os;
+    os << "headless: " << _moduleName << ", seed " << _seed << ", " << updates << " updates in "
+       << std::fixed << std::setprecision(1) << totalMs << " ms";
+    if (totalMs > 0.0)
+    {
+        os << " (" << (updates * 1000.0 / totalMs) << " updates/s)";
+    }
+    os << std::endl;
+    os << "  objects: " << _currentModule->getObjectHandler().getObjectCount()
+       << ", particles: " << ParticleHandler::get().getCount() << std::endl;
+
+    for (size_t i = 0; i < UpdatePhaseTimings::Count; ++i)
+    {
+        const auto phase = static_cast<UpdatePhaseTimings::Phase>(i);
+        const double phaseMs = std::chrono::duration_cast<Milliseconds>(g_updatePhaseTimings.durations[i]).count();
+        os << "  " << std::left << std::setw(12) << UpdatePhaseTimings::getName(phase) << std::right
+           << std::setw(10) << std::setprecision(1) << phaseMs << " ms"
+           << std::setw(10) << std::setprecision(3) << (updates > 0 ? phaseMs / updates : 0.0) << " ms/update"
+           << std::setw(8) << std::setprecision(1) << (totalMs > 0.0 ? 100.0 * phaseMs / totalMs : 0.0) << " %"
+           << std::endl;
+    }
+
+    if (_replay)
+    {
+        os << "  replay: " << g_inputRecording->getCheckedCount() << " of " << g_inputRecording->getTickCount()
+           << " recorded updates checked, ";
+        if (isInSync())
+        {
+            os << "in sync" << std::endl;
+        }
+        else
+        {
+            os << "desync at update " << g_inputRecording->getFirstDesync() << std::endl;
+        }
+    }
+
+    std::cout << os.str();
+    Log::get().info("%s", os.str().c_str());
+}
+
+bool HeadlessRunner::isInSync() const
+{
+    return !_replay || InputRecording::NO_DESYNC == g_inputRecording->getFirstDesync();
+}
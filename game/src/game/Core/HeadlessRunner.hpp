@@ -0,0 +1,111 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Core/HeadlessRunner.hpp
+/// @brief Runs the game simulation of a module without rendering and frame limiter.
+/// @details
+/// Started with
+/// @code
+/// egoboo --headless <module folder> [--ticks=<n>] [--seed=<n>] [--player=<saved player>]
+/// egoboo --replay=<input recording> [--ticks=<n>]
+/// egoboo --headless <module folder> --roundtrip[=<input recording>] [--ticks=<n>] [--seed=<n>] [--player=<saved player>]
+/// @endcode
+/// The module is loaded with a fixed random seed and updated @a ticks times as fast as possible.
+/// Afterwards the number of updates per second and the time spent in each phase of update_game()
+/// are reported. A replay takes the module, the seed, the player and by default the number of
+/// updates from an InputRecording, replays the recorded input and reports if the game state
+/// deviated from the recorded session. A round trip records a run (to @a DEFAULT_ROUND_TRIP_PATH
+/// unless a file is given), loads the module again and replays the recording, which checks that
+/// the simulation is deterministic and that recordings are saved and loaded without loss.
+
+#pragma once
+
+#include "egolib/egolib.h"
+
+// Forward declarations.
+class ModuleProfile;
+
+class HeadlessRunner
+{
+public:
+    static const uint32_t DEFAULT_TICKS = 1000;
+    static const uint32_t DEFAULT_SEED = 0;
+    static const std::string DEFAULT_ROUND_TRIP_PATH;
+
+    HeadlessRunner();
+
+    /**
+    * @brief
+    *   Parse the command-line arguments.
+    * @return
+    *   @a true if the arguments request a headless run, @a false otherwise
+    * @throw Id::InvalidArgumentException
+    *   if the headless arguments are malformed or a round trip is requested without
+    *   @a --headless or with @a --replay
+    * @throw Id::RuntimeErrorException
+    *   if the input recording to replay can not be loaded
+    * @remark
+    *   @a --record=<file> sets the record path of InputRecording, in headless and regular runs.
+    **/
+    bool parseArguments(int argc, char **argv);
+
+    /**
+    * @brief
+    *   Load the module synchronously, like the LoadingState does in its background thread.
+    * @return
+    *   @a true on success, @a false otherwise
+    * @remark
+    *   Requires an initialized GameEngine.
+    **/
+    bool loadModule();
+
+    /**
+    * @brief
+    *   Replay the run just recorded by a round trip: end the module, which saves its recording,
+    *   load the recording and load the module again.
+    * @return
+    *   @a true on success, @a false otherwise
+    **/
+    bool beginReplay();
+
+    /**
+    * @brief
+    *   Log and print the results of a run of @a ticks updates which took @a elapsed.
+    **/
+    void report(std::chrono::high_resolution_clock::duration elapsed) const;
+
+    /// @brief Get the number of updates to run.
+    uint32_t getTicks() const { return _ticks; }
+
+    /// @brief Get if a replay did not deviate from its recording.
+    bool isInSync() const;
+
+    /// @brief Get if the run is to be recorded and replayed.
+    bool isRoundTrip() const { return !_roundTripPath.empty(); }
+
+private:
+    std::shared_ptr<ModuleProfile> findModule() const;
+
+    std::string _moduleName;    ///< The folder name of the module e.g. "adventurer.mod"
+    std::string _playerPath;    ///< The saved player to import or an empty string
+    uint32_t _ticks;
+    uint32_t _seed;
+    bool _replay;
+    std::string _roundTripPath; ///< The recording of a round trip or an empty string
+};
@@ -0,0 +1,359 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Core/InputRecording.cpp
+/// @brief Records the input of the players per update and replays it.
+/// @details
+/// A recording is a text file:
+/// @code
+/// egoboo-input 1
+/// module <module folder>
+/// seed <seed>
+/// player <saved player>
+/// ...
+/// tick <update> <checksum>
+/// input <player index> <buttons> <joystick x> <joystick y> <movement x> <movement y> <respawn>
+/// ...
+/// @endcode
+/// with one @a player line per imported player and one @a tick line per update followed by the @a input lines of that update. Checksums,
+/// buttons and the bit patterns of the floats are hexadecimal so a replay is exact.
+
+#include "game/Core/InputRecording.hpp"
+#include "game/Entities/_Include.hpp"
+#include "game/Module/Module.hpp"
+#include "game/game.h"
+
+std::unique_ptr<InputRecording> g_inputRecording = nullptr;
+
+namespace {
+
+/// The file to save the recordings to, if modules are recorded.
+std::string g_recordPath;
+
+const std::string MAGIC = "egoboo-input";
+const int VERSION = 1;
+
+/// 64-bit FNV-1a hash
+class Checksum
+{
+public:
+    Checksum() : _hash(UINT64_C(14695981039346656037)) {}
+
+    void add(const void *data, size_t size)
+    {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            _hash = (_hash ^ bytes[i]) * UINT64_C(1099511628211);
+        }
+    }
+
+    template <typename Type>
+    void add(const Type& value)
+    {
+        static_assert(std::is_arithmetic<Type>::value, "Type must be an arithmetic type");
+        add(&value, sizeof(Type));
+    }
+
+    void add(const Vector3f& value)
+    {
+        add(value[kX]); add(value[kY]); add(value[kZ]);
+    }
+
+    uint64_t get() const { return _hash; }
+
+private:
+    uint64_t _hash;
+};
+
+uint32_t floatToBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsToFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+Id::RuntimeErrorException malformed(const std::string& path, size_t line)
+{
+    return Id::RuntimeErrorException(__FILE__, __LINE__, "malformed input recording `" + path + "` at line " + std::to_string(line));
+}
+
+} // namespace
+
+InputRecording::Tick::Tick() :
+    inputs(),
+    checksum(0),
+    hasChecksum(false)
+{
+    //ctor
+}
+
+InputRecording::InputRecording(const std::string& moduleName, uint32_t seed) :
+    _mode(Mode::Record),
+    _moduleName(moduleName),
+    _seed(seed),
+    _players(),
+    _ticks(),
+    _checked(0),
+    _firstDesync(NO_DESYNC)
+{
+    //ctor
+}
+
+std::unique_ptr<InputRecording> InputRecording::load(const std::string& path)
+{
+    std::ifstream is(path);
+    if (!is)
+    {
+        throw Id::RuntimeErrorException(__FILE__, __LINE__, "unable to open input recording `" + path + "`");
+    }
+
+    std::string line;
+    std::string keyword;
+    size_t lineNumber = 0;
+    auto readHeader = [&](const std::string& expected) -> std::istringstream
+    {
+        ++lineNumber;
+        if (!std::getline(is, line)) throw malformed(path, lineNumber);
+        std::istringstream ls(line);
+        if (!(ls >> keyword) || keyword != expected) throw malformed(path, lineNumber);
+        return ls;
+    };
+
+    // The header
+    int version = 0;
+    if (!(readHeader(MAGIC) >> version)) throw malformed(path, lineNumber);
+    std::string moduleName;
+    if (!std::getline(readHeader("module") >> std::ws, moduleName)) throw malformed(path, lineNumber);
+    uint32_t seed = 0;
+    if (!(readHeader("seed") >> seed)) throw malformed(path, lineNumber);
+    if (version != VERSION)
+    {
+        throw Id::RuntimeErrorException(__FILE__, __LINE__, "unsupported version " + std::to_string(version) + " of input recording `" + path + "`");
+    }
+
+    auto recording = std::make_unique<InputRecording>(moduleName, seed);
+    recording->_mode = Mode::Replay;
+
+    // The updates
+    Tick *tick = nullptr;
+    while (std::getline(is, line))
+    {
+        ++lineNumber;
+        if (line.empty()) continue;
+        std::istringstream ls(line);
+        ls >> keyword;
+        if (keyword == "player" && !tick)
+        {
+            std::string player;
+            if (!std::getline(ls >> std::ws, player)) throw malformed(path, lineNumber);
+            recording->_players.push_back(player);
+        }
+        else if (keyword == "tick")
+        {
+            uint32_t update;
+            uint64_t checksum;
+            if (!(ls >> update >> std::hex >> checksum)) throw malformed(path, lineNumber);
+            tick = &recording->_ticks[update];
+            tick->checksum = checksum;
+            tick->hasChecksum = true;
+        }
+        else if (keyword == "input" && tick)
+        {
+            size_t index;
+            unsigned long buttons;
+            uint32_t joystickX, joystickY, movementX, movementY;
+            int respawn;
+            if (!(ls >> index >> std::hex >> buttons >> joystickX >> joystickY >> movementX >> movementY >> std::dec >> respawn)) throw malformed(path, lineNumber);
+            if (index >= tick->inputs.size())
+            {
+                tick->inputs.resize(index + 1);
+            }
+            Ego::PlayerInput& input = tick->inputs[index];
+            input.buttons = Ego::PlayerInput::Buttons(buttons);
+            input.joystick = Vector2f(bitsToFloat(joystickX), bitsToFloat(joystickY));
+            input.movement = Vector2f(bitsToFloat(movementX), bitsToFloat(movementY));
+            input.respawn = (0 != respawn);
+        }
+        else
+        {
+            throw malformed(path, lineNumber);
+        }
+    }
+    return recording;
+}
+
+void InputRecording::setRecordPath(const std::string& path)
+{
+    g_recordPath = path;
+}
+
+void InputRecording::beginModule(const std::string& moduleName, uint32_t seed)
+{
+    if (g_recordPath.empty() || (g_inputRecording && Mode::Replay == g_inputRecording->getMode()))
+    {
+        return;
+    }
+    endModule();
+    g_inputRecording = std::make_unique<InputRecording>(moduleName, seed);
+}
+
+void InputRecording::endModule()
+{
+    if (!g_inputRecording || Mode::Record != g_inputRecording->getMode())
+    {
+        return;
+    }
+    // The players are imported after the module was started
+    if (_currentModule)
+    {
+        g_inputRecording->_players = _currentModule->getImportPlayers();
+    }
+    if (g_inputRecording->save(g_recordPath))
+    {
+        Log::get().info("recorded %u updates of `%s` to `%s`\n", g_inputRecording->getTickCount(),
+                        g_inputRecording->getModuleName().c_str(), g_recordPath.c_str());
+    }
+    g_inputRecording = nullptr;
+}
+
+bool InputRecording::isActive()
+{
+    return nullptr != g_inputRecording;
+}
+
+bool InputRecording::save(const std::string& path) const
+{
+    std::ofstream os(path);
+    if (!os)
+    {
+        Log::get().warn("unable to save input recording `%s`\n", path.c_str());
+        return false;
+    }
+
+    os << MAGIC << " " << VERSION << std::endl
+       << "module " << _moduleName << std::endl
+       << "seed " << _seed << std::endl;
+    for (const std::string& player : _players)
+    {
+        os << "player " << player << std::endl;
+    }
+    for (const auto& tick : _ticks)
+    {
+        os << "tick " << tick.first << " " << std::hex << tick.second.checksum << std::dec << std::endl;
+        for (size_t index = 0; index < tick.second.inputs.size(); ++index)
+        {
+            const Ego::PlayerInput& input = tick.second.inputs[index];
+            os << "input " << index << std::hex
+               << " " << input.buttons.to_ulong()
+               << " " << floatToBits(input.joystick[kX]) << " " << floatToBits(input.joystick[kY])
+               << " " << floatToBits(input.movement[kX]) << " " << floatToBits(input.movement[kY])
+               << std::dec << " " << (input.respawn ? 1 : 0) << std::endl;
+        }
+    }
+    return static_cast<bool>(os);
+}
+
+Ego::PlayerInput InputRecording::getInput(uint32_t tick, size_t index, const Ego::Player& player)
+{
+    if (Mode::Replay == _mode)
+    {
+        // Updates and players without recorded input press nothing
+        const auto it = _ticks.find(tick);
+        if (it == _ticks.end() || index >= it->second.inputs.size())
+        {
+            return Ego::PlayerInput();
+        }
+        return it->second.inputs[index];
+    }
+
+    Ego::PlayerInput input = player.readInput();
+    std::vector<Ego::PlayerInput>& inputs = _ticks[tick].inputs;
+    if (index >= inputs.size())
+    {
+        inputs.resize(index + 1);
+    }
+    inputs[index] = input;
+    return input;
+}
+
+bool InputRecording::checkState(uint32_t tick)
+{
+    const uint64_t checksum = computeChecksum();
+    if (Mode::Record == _mode)
+    {
+        Tick& recorded = _ticks[tick];
+        recorded.checksum = checksum;
+        recorded.hasChecksum = true;
+        return true;
+    }
+
+    const auto it = _ticks.find(tick);
+    if (it == _ticks.end() || !it->second.hasChecksum)
+    {
+        return true;
+    }
+    _checked++;
+    if (it->second.checksum == checksum)
+    {
+        return true;
+    }
+    if (NO_DESYNC == _firstDesync)
+    {
+        _firstDesync = tick;
+        Log::get().warn("replay: desync at update %u\n", tick);
+    }
+    return false;
+}
+
+uint64_t InputRecording::computeChecksum()
+{
+    Checksum checksum;
+    checksum.add(update_wld);
+
+    for (const std::shared_ptr<Object>& object : _currentModule->getObjectHandler().iterator())
+    {
+        if (object->isTerminated()) continue;
+        checksum.add(static_cast<uint32_t>(object->getObjRef().get()));
+        checksum.add(object->getPosition());
+        checksum.add(object->vel);
+        checksum.add(object->getLife());
+        checksum.add(object->getMana());
+        checksum.add(static_cast<uint32_t>(object->getLatchButtons().to_ulong()));
+        checksum.add(object->getObjectPhysics().getDesiredVelocity()[kX]);
+        checksum.add(object->getObjectPhysics().getDesiredVelocity()[kY]);
+    }
+
+    for (const std::shared_ptr<Ego::Particle>& particle : ParticleHandler::get().iterator())
+    {
+        if (particle->isTerminated()) continue;
+        checksum.add(static_cast<uint32_t>(particle->getParticleID().get()));
+        checksum.add(particle->getPosition());
+        checksum.add(particle->vel);
+    }
+
+    return checksum.get();
+}
@@ -0,0 +1,180 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Core/InputRecording.hpp
+/// @brief Records the input of the players per update and replays it.
+/// @details
+/// Together with the module name, the random seed and the imported players, the input of the
+/// players is all a headless run needs to repeat a game session update by update, e.g. for
+/// profiling the same workload before and after a change. A checksum of the game state is stored
+/// for each update, so a replay detects the first update at which it deviates from the recorded
+/// session. Sessions are recorded with
+/// @code
+/// egoboo --record=<file>
+/// @endcode
+/// and replayed with
+/// @code
+/// egoboo --replay=<file> [--ticks=<n>]
+/// @endcode
+/// @remark
+/// Saved players are exported when a module is finished, so a session should be replayed before
+/// its saved player is played again.
+/// @remark
+/// A recorded or replayed session does not run the same code as normal play, because the
+/// simulation must not read the cameras (see isActive()): Object::getWallRadius() always uses the
+/// bump size, ParticleBudget does not thin out particles by their size on screen, and AIScheduler
+/// uses only the players and not the cameras as focus points. A replayed workload is therefore not
+/// a profile of the collisions, the particle budget and the AI scheduling of normal play.
+
+#pragma once
+
+#include "egolib/egolib.h"
+#include "game/Logic/Player.hpp"
+
+class InputRecording
+{
+public:
+    enum class Mode
+    {
+        Record,     ///< Read the input from the input devices and record it
+        Replay      ///< Replay the recorded input and compare the checksums
+    };
+
+    /// The tick of a desync if there was none.
+    static const uint32_t NO_DESYNC = std::numeric_limits<uint32_t>::max();
+
+    /**
+    * @brief
+    *   Construct an empty recording.
+    * @param moduleName
+    *   the folder name of the recorded module
+    * @param seed
+    *   the random seed the module was started with
+    **/
+    InputRecording(const std::string& moduleName, uint32_t seed);
+
+    /**
+    * @brief
+    *   Load a recording to replay it.
+    * @throw Id::RuntimeErrorException
+    *   if the file can not be read or is malformed
+    **/
+    static std::unique_ptr<InputRecording> load(const std::string& path);
+
+    /**
+    * @brief
+    *   Record the modules started from now on.
+    * @param path
+    *   the file to save the recording of a module to when it ends
+    **/
+    static void setRecordPath(const std::string& path);
+
+    /**
+    * @brief
+    *   Start recording a module if a record path is set and no recording is replayed.
+    **/
+    static void beginModule(const std::string& moduleName, uint32_t seed);
+
+    /**
+    * @brief
+    *   Save and discard the recording of the current module, if it is recorded.
+    **/
+    static void endModule();
+
+    /**
+    * @brief
+    *   Get if the current module is recorded or replayed.
+    * @remark
+    *   The cameras are neither recorded nor replayed, so the simulation must not depend on them
+    *   while a module is recorded or replayed.
+    **/
+    static bool isActive();
+
+    /**
+    * @brief
+    *   Save this recording.
+    * @return
+    *   @a true on success, @a false otherwise
+    **/
+    bool save(const std::string& path) const;
+
+    /**
+    * @brief
+    *   Get the input of a player for an update: read from its input device and recorded or
+    *   replayed from this recording.
+    * @param tick
+    *   the update i.e. update_wld
+    * @param index
+    *   the index of the player in the player list of the module
+    **/
+    Ego::PlayerInput getInput(uint32_t tick, size_t index, const Ego::Player& player);
+
+    /**
+    * @brief
+    *   Record the checksum of the game state at the end of an update or compare it with the
+    *   recorded checksum.
+    * @param tick
+    *   the update i.e. update_wld
+    * @return
+    *   @a false if the checksum differs from the recorded one, @a true otherwise
+    **/
+    bool checkState(uint32_t tick);
+
+    /**
+    * @brief
+    *   Compute a checksum of the game state relevant to the simulation: the update counter
+    *   and the positions, velocities, life, mana and latches of all objects and particles.
+    **/
+    static uint64_t computeChecksum();
+
+    Mode getMode() const { return _mode; }
+    const std::string& getModuleName() const { return _moduleName; }
+    uint32_t getSeed() const { return _seed; }
+    const std::list<std::string>& getPlayers() const { return _players; }
+
+    /// @brief Get the number of updates with a checksum.
+    uint32_t getTickCount() const { return static_cast<uint32_t>(_ticks.size()); }
+
+    /// @brief Get the number of updates whose checksum was compared.
+    uint32_t getCheckedCount() const { return _checked; }
+
+    /// @brief Get the first update whose checksum differed or @a NO_DESYNC.
+    uint32_t getFirstDesync() const { return _firstDesync; }
+
+private:
+    struct Tick
+    {
+        Tick();
+
+        std::vector<Ego::PlayerInput> inputs;   ///< The input of each player, by index
+        uint64_t checksum;
+        bool hasChecksum;
+    };
+
+    Mode _mode;
+    std::string _moduleName;
+    uint32_t _seed;
+    std::list<std::string> _players;    ///< The imported players
+    std::map<uint32_t, Tick> _ticks;
+    uint32_t _checked;
+    uint32_t _firstDesync;
+};
+
+/// The recording being recorded or replayed by the game, if any.
+extern std::unique_ptr<InputRecording> g_inputRecording;
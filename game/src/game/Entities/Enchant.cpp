@@ -458,8 +458,8 @@ void Enchantment::applyEnchantment(std::shared_ptr<Object> target)
         owner->getTempAttributes()[Ego::Attribute::LIFE_REGEN] += _ownerLifeSustain;
     }
 
-    //Insert this enchantment into the Objects list of active enchants
-    target->getActiveEnchants().push_front(shared_from_this());    
+    //Insert this enchantment into the active enchants of the module
+    _currentModule->getEnchantHandler().add(shared_from_this());
 }
 
 std::shared_ptr<Object> Enchantment::getTarget() const
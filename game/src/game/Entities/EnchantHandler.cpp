@@ -0,0 +1,151 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/EnchantHandler.cpp
+/// @details Storage and batched update of the active enchantments of a module
+
+#define GAME_ENTITIES_PRIVATE 1
+#include "game/Entities/EnchantHandler.hpp"
+#include "game/Entities/Enchant.hpp"
+#include "game/Entities/Object.hpp"
+
+EnchantHandler::EnchantHandler() :
+    _enchantments(),
+    _byTarget(),
+    _targetKeys(),
+    _expired(),
+    _indexDirty(false)
+{
+    //ctor
+}
+
+void EnchantHandler::add(const std::shared_ptr<Ego::Enchantment> &enchant)
+{
+    _enchantments.push_back(enchant);
+    _indexDirty = true;
+}
+
+EnchantHandler::Range EnchantHandler::getEnchantments(const ObjectRef target)
+{
+    if (_indexDirty)
+    {
+        rebuildIndex();
+    }
+    const auto first = std::lower_bound(_targetKeys.begin(), _targetKeys.end(), target.get());
+    const auto last = std::upper_bound(first, _targetKeys.end(), target.get());
+    const std::shared_ptr<Ego::Enchantment> *data = _byTarget.data();
+    return Range(data + (first - _targetKeys.begin()), data + (last - _targetKeys.begin()));
+}
+
+EnchantHandler::Range EnchantHandler::getAllEnchantments() const
+{
+    const std::shared_ptr<Ego::Enchantment> *data = _enchantments.data();
+    return Range(data, data + _enchantments.size());
+}
+
+void EnchantHandler::update()
+{
+    // Enchantments added by this loop (e.g. through a kill) are updated from the next update on
+    const size_t count = _enchantments.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        Ego::Enchantment *enchant = _enchantments[i].get();
+        enchant->update();
+        if (!enchant->isTerminated())
+        {
+            continue;
+        }
+
+        // The end effects only apply to targets which are still in the game
+        const std::shared_ptr<Object> target = enchant->getTarget();
+        if (target && !target->isTerminated())
+        {
+            enchant->playEndSound();
+            if (enchant->getProfile()->killtargetonend)
+            {
+                target->kill(enchant->getOwner(), true);
+            }
+        }
+        _expired.push_back(_enchantments[i]);
+    }
+
+    if (_expired.empty())
+    {
+        return;
+    }
+
+    // Remove the expired enchantments, they are in the same order as in _enchantments.
+    // Enchantments terminated after their turn in this loop are handled in the next update.
+    size_t next = 0;
+    _enchantments.erase(std::remove_if(_enchantments.begin(), _enchantments.end(),
+        [this, &next](const std::shared_ptr<Ego::Enchantment> &enchant)
+        {
+            if (next < _expired.size() && _expired[next] == enchant)
+            {
+                next++;
+                return true;
+            }
+            return false;
+        }), _enchantments.end());
+
+    // Release the last references, the destructors remove the modifiers from the targets and owners
+    _byTarget.clear();
+    _targetKeys.clear();
+    _indexDirty = true;
+    _expired.clear();
+}
+
+void EnchantHandler::clear()
+{
+    _byTarget.clear();
+    _targetKeys.clear();
+    _expired.clear();
+    _enchantments.clear();
+    _indexDirty = false;
+}
+
+void EnchantHandler::rebuildIndex()
+{
+    // Sort by target, the newest enchantment of a target first
+    std::vector<std::pair<ObjectRef::Type, size_t>> order;
+    order.reserve(_enchantments.size());
+    for (size_t i = _enchantments.size(); i-- > 0;)
+    {
+        const std::shared_ptr<Object> target = _enchantments[i]->getTarget();
+        if (!target)
+        {
+            continue;
+        }
+        order.emplace_back(target->getObjRef().get(), i);
+    }
+    std::stable_sort(order.begin(), order.end(),
+        [](const std::pair<ObjectRef::Type, size_t> &x, const std::pair<ObjectRef::Type, size_t> &y)
+        {
+            return x.first < y.first;
+        });
+
+    _byTarget.clear();
+    _targetKeys.clear();
+    for (const auto &element : order)
+    {
+        _targetKeys.push_back(element.first);
+        _byTarget.push_back(_enchantments[element.second]);
+    }
+    _indexDirty = false;
+}
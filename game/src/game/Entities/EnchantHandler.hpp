@@ -0,0 +1,108 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/EnchantHandler.hpp
+/// @details Storage and batched update of the active enchantments of a module
+
+#pragma once
+#if !defined(GAME_ENTITIES_PRIVATE) || GAME_ENTITIES_PRIVATE != 1
+#error(do not include directly, include `game/Entities/_Include.hpp` instead)
+#endif
+
+#include "game/egoboo.h"
+
+//Forward declarations
+class Object;
+namespace Ego { class Enchantment; }
+
+/**
+* @brief
+*	The active enchantments of a module. All enchantments are stored in one contiguous array which
+*	is updated in a single pass. A second array holds the same enchantments sorted by target (newest
+*	first), so the enchantments of a target are a range of that array.
+* @remark
+*	The target index is rebuilt lazily on the first query after the set of enchantments changed.
+*	A Range points into the arrays of this handler: add(), update() and clear() invalidate all
+*	ranges, as does the rebuild of the index by the first query after add(). Do not add an
+*	enchantment or query the enchantments of another target while iterating a range; terminating
+*	an enchantment (Ego::Enchantment::requestTerminate()) is safe, it is only removed by update().
+**/
+class EnchantHandler : public Id::NonCopyable
+{
+public:
+	/// A range of enchantments of the index
+	class Range
+	{
+	public:
+		Range(const std::shared_ptr<Ego::Enchantment> *begin, const std::shared_ptr<Ego::Enchantment> *end) : _begin(begin), _end(end) {}
+		const std::shared_ptr<Ego::Enchantment> *begin() const { return _begin; }
+		const std::shared_ptr<Ego::Enchantment> *end() const { return _end; }
+		size_t size() const { return _end - _begin; }
+		bool empty() const { return _begin == _end; }
+		const std::shared_ptr<Ego::Enchantment>& front() const { return *_begin; }
+	private:
+		const std::shared_ptr<Ego::Enchantment> *_begin;
+		const std::shared_ptr<Ego::Enchantment> *_end;
+	};
+
+	EnchantHandler();
+
+	/**
+	* @brief
+	*	Add an enchantment which was applied to its target
+	**/
+	void add(const std::shared_ptr<Ego::Enchantment> &enchant);
+
+	/**
+	* @return
+	*	the active enchantments on the specified object, newest first. The range is valid until
+	*	the next call to add(), update() or clear().
+	**/
+	Range getEnchantments(const ObjectRef target);
+
+	/**
+	* @return
+	*	all active enchantments, oldest first
+	**/
+	Range getAllEnchantments() const;
+
+	/**
+	* @brief
+	*	Update the timers, drains and particle spawns of all enchantments and remove the ones
+	*	which ended
+	**/
+	void update();
+
+	/**
+	* @brief
+	*	Remove all enchantments
+	**/
+	void clear();
+
+	size_t getCount() const { return _enchantments.size(); }
+
+private:
+	void rebuildIndex();
+
+	std::vector<std::shared_ptr<Ego::Enchantment>> _enchantments;	///< All enchantments in the order they were added
+	std::vector<std::shared_ptr<Ego::Enchantment>> _byTarget;		///< The enchantments sorted by target
+	std::vector<ObjectRef::Type> _targetKeys;						///< The target of each element of _byTarget
+	std::vector<std::shared_ptr<Ego::Enchantment>> _expired;		///< Scratch buffer of ended enchantments
+	bool _indexDirty;
+};
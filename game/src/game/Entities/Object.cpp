@@ -33,6 +33,7 @@
 #include "egolib/Graphics/ModelDescriptor.hpp"
 #include "game/script_implementation.h" //for stealth
 #include "game/CharacterMatrix.h"
+#include "game/Core/InputRecording.hpp"
 
 //For the minimap
 #include "game/Core/GameEngine.hpp"
@@ -124,6 +125,7 @@ Object::Object(const PRO_REF proRef, ObjectRef objRef) :
     
     _terminateRequested(false),
     _objRef(objRef),
+    _randomStream(_currentModule->getRandomStream(GameModule::RandomStreamDomain::Object, objRef.get())),
     _profileID(proRef),
     _profile(ProfileSystem::get().getProfile(_profileID)),
     _showStatus(false),
@@ -138,7 +140,7 @@ Object::Object(const PRO_REF proRef, ObjectRef objRef) :
     _inventory(),
     _money(0),
     _perks(),
-    _levelUpSeed(Random::next(std::numeric_limits<uint32_t>::max())),
+    _levelUpSeed(_randomStream.next(std::numeric_limits<uint32_t>::max())),
 
     //Graphics
     inst(*this),
@@ -157,7 +159,6 @@ Object::Object(const PRO_REF proRef, ObjectRef objRef) :
     _observationTimer((objRef.get() % ONESECOND) + update_wld), //spread observations so all characters don't happen at the same time
 
     //Enchants
-    _activeEnchants(),
     _lastEnchantSpawned()
 {
     // Grip info
@@ -176,7 +177,7 @@ Object::Object(const PRO_REF proRef, ObjectRef objRef) :
     //Initialize primary attributes
     for(size_t i = 0; i < Ego::Attribute::NR_OF_PRIMARY_ATTRIBUTES; ++i) {
         const Ego::Math::Interval<float>& baseRange = _profile->getAttributeBase(static_cast<Ego::Attribute::AttributeType>(i));
-        _baseAttribute[i] = Random::next(baseRange);
+        _baseAttribute[i] = _randomStream.next(baseRange);
     }
 
     //Initialize timer to a random value
@@ -385,7 +386,7 @@ int Object::damage(Facing direction, const IPair  damage, const DamageType damag
 
     // Lessen actual damage taken by resistance
     // This can also be used to lessen effectiveness of healing
-    int base_damage = Random::next(damage.base, damage.base+damage.rand);
+    int base_damage = _randomStream.next(damage.base, damage.base+damage.rand);
     int actual_damage = base_damage - base_damage*getDamageReduction(damagetype, !ignoreArmour);
 
     // Increase electric damage when in water
@@ -497,7 +498,7 @@ int Object::damage(Facing direction, const IPair  damage, const DamageType damag
                     if ( base_damage > HURTDAMAGE )
                     {
                         //If we have Endurance perk, we have 1% chance per Might to resist hurt animation (which cause a minor delay)
-                        if(!hasPerk(Ego::Perks::ENDURANCE) || Random::getPercent() > getAttribute(Ego::Attribute::MIGHT))
+                        if(!hasPerk(Ego::Perks::ENDURANCE) || _randomStream.getPercent() > getAttribute(Ego::Attribute::MIGHT))
                         {
                             if(inst.getModelDescriptor()->isActionValid(ACTION_HA)) {
                                 inst.playAction(getProfile()->getModel()->randomizeAction(ACTION_HA), false);
@@ -705,28 +706,6 @@ bool Object::teleport(const Vector3f& position, Facing facing_z)
 
 void Object::update()
 {
-    //Update active enchantments on this Object
-    if(!_activeEnchants.empty()) {
-        _activeEnchants.remove_if([this](const std::shared_ptr<Ego::Enchantment> &enchant) 
-            {
-                //Update enchantment 
-                enchant->update();
-
-                //Remove all terminated enchants
-                if(enchant->isTerminated()) {
-                    enchant->playEndSound();
-
-                    if(enchant->getProfile()->killtargetonend) {
-                        this->kill(enchant->getOwner(), true);
-                    }
-
-                    return true;
-                }
-
-                return false; 
-            });
-    }
-
     // the following functions should not be done the first time through the update loop
     if (0 == update_wld) return;
 
@@ -887,7 +866,7 @@ void Object::update()
 
         //Give Rally bonus to friends within 6 tiles
         if(hasPerk(Ego::Perks::RALLY)) {
-            std::vector<std::shared_ptr<Object>> nearbyObjects = _currentModule->getObjectHandler().findObjects(getPosX(), getPosY(), WIDE, false);
+            auto nearbyObjects = _currentModule->getObjectHandler().findObjects(getPosX(), getPosY(), WIDE, Ego::Core::FrameArena::update(), false);
             for(const std::shared_ptr<Object> &object : nearbyObjects)
             {
                 //Only valid objects that are on our team
@@ -915,7 +894,7 @@ void Object::update()
             lineOfSightInfo.stopped_by = stoppedby;
 
             //Check for nearby enemies
-            std::vector<std::shared_ptr<Object>> nearbyObjects = _currentModule->getObjectHandler().findObjects(getPosX(), getPosY(), WIDE, false);
+            auto nearbyObjects = _currentModule->getObjectHandler().findObjects(getPosX(), getPosY(), WIDE, Ego::Core::FrameArena::update(), false);
             for(const std::shared_ptr<Object> &target : nearbyObjects) {
                 //Valid objects only
                 if(target->isTerminated() || target->isHidden()) continue;
@@ -966,7 +945,7 @@ void Object::update()
                 }
 
                 //Were they detected by us?
-                if(Random::getPercent() <= chance) {
+                if(_randomStream.getPercent() <= chance) {
                     target->deactivateStealth();
                     target->_stealthTimer = ONESECOND * 6; //6 second timeout
                     break;
@@ -1352,7 +1331,7 @@ void Object::checkLevelUp()
 
             //Primary Attribute increase
             for(size_t i = 0; i < Ego::Attribute::NR_OF_PRIMARY_ATTRIBUTES; ++i) {
-                _baseAttribute[i] += Random::next(getProfile()->getAttributeGain(static_cast<Ego::Attribute::AttributeType>(i)));
+                _baseAttribute[i] += _randomStream.next(getProfile()->getAttributeGain(static_cast<Ego::Attribute::AttributeType>(i)));
             }
 
             //Grab random Perk? (ZF> just uncomment if we want to do this for AI characters as well)
@@ -1376,7 +1355,7 @@ void Object::kill(const std::shared_ptr<Object> &originalKiller, bool ignoreInvi
     if(hasPerk(Ego::Perks::TOO_SILLY_TO_DIE) && !ignoreInvincibility)
     {
         //1% per character level to simply not die
-        if(Random::getPercent() <= getExperienceLevel())
+        if(_randomStream.getPercent() <= getExperienceLevel())
         {
             //Refill to full Life instead!
             _currentLife = getAttribute(Ego::Attribute::MAX_LIFE);
@@ -1391,7 +1370,7 @@ void Object::kill(const std::shared_ptr<Object> &originalKiller, bool ignoreInvi
     if(hasPerk(Ego::Perks::GUARDIAN_ANGEL) && !ignoreInvincibility)
     {
         //1% per character level to be rescued by your guardian angel
-        if(Random::getPercent() <= getExperienceLevel())
+        if(_randomStream.getPercent() <= getExperienceLevel())
         {
             //Refill to full Life instead!
             _currentLife = getAttribute(Ego::Attribute::MAX_LIFE);
@@ -1694,24 +1673,28 @@ void Object::removeFromGame(Object *obj)
 	AudioSystem::get().stopObjectLoopingSounds(objRef);
 }
 
-BIT_FIELD Object::hit_wall(const Vector3f& pos, Vector2f& nrm, float *pressure)
+float Object::getWallRadius() const
 {
-	if (Ego::Physics::CHR_INFINITE_WEIGHT == phys.weight)
+	// Calculate the radius based on whether the character is on camera.
+	if (InputRecording::isActive() ||
+		(CameraSystem::get().isInitialized() && CameraSystem::get().getMainCamera()->getTileList()->inRenderList(getTile())))
 	{
-		return EMPTY_BIT_FIELD;
+		return bump_1.size;
 	}
+	return 0.0f;
+}
 
-	// Calculate the radius based on whether the character is on camera.
-	float radius = 0.0f;
-	if (CameraSystem::get().isInitialized() && CameraSystem::get().getMainCamera()->getTileList()->inRenderList(getTile()))
+BIT_FIELD Object::hit_wall(const Vector3f& pos, Vector2f& nrm, float *pressure)
+{
+	if (Ego::Physics::CHR_INFINITE_WEIGHT == phys.weight)
 	{
-		radius = bump_1.size;
+		return EMPTY_BIT_FIELD;
 	}
 
 	g_meshStats.mpdfxTests = 0;
 	g_meshStats.boundTests = 0;
 	g_meshStats.pressureTests = 0;
-	BIT_FIELD result = _currentModule->getMeshPointer()->hit_wall(pos, radius, stoppedby, nrm, pressure);
+	BIT_FIELD result = _currentModule->getMeshPointer()->hit_wall(pos, getWallRadius(), stoppedby, nrm, pressure);
 	chr_stoppedby_tests += g_meshStats.mpdfxTests;
 	chr_pressure_tests += g_meshStats.pressureTests;
 
@@ -1725,17 +1708,10 @@ BIT_FIELD Object::hit_wall(const Vector3f& pos, Vector2f& nrm, float * pressure,
 		return EMPTY_BIT_FIELD;
 	}
 
-    // Calculate the radius based on whether the character is on camera.
-	float radius = 0.0f;
-	if (CameraSystem::get().isInitialized() && CameraSystem::get().getMainCamera()->getTileList()->inRenderList(getTile()))
-	{
-		radius = bump_1.size;
-	}
-
 	g_meshStats.mpdfxTests = 0;
 	g_meshStats.boundTests = 0;
 	g_meshStats.pressureTests = 0;
-	BIT_FIELD result = _currentModule->getMeshPointer()->hit_wall(pos, radius, stoppedby, nrm, pressure, data);
+	BIT_FIELD result = _currentModule->getMeshPointer()->hit_wall(pos, getWallRadius(), stoppedby, nrm, pressure, data);
 	chr_stoppedby_tests += g_meshStats.mpdfxTests;
 	chr_pressure_tests += g_meshStats.pressureTests;
 
@@ -1776,6 +1752,15 @@ BIT_FIELD Object::test_wall(const Vector3f& pos)
 	return result;
 }
 
+void Object::onTileChanged()
+{
+	// Terminated objects were already removed from the occupancy
+	if (isTerminated()) {
+		return;
+	}
+	_currentModule->getObjectHandler().getTileOccupancy().update(getObjRef(), TileOccupancy::Area::ofPoint(getPosX(), getPosY()));
+}
+
 bool Object::costMana(int amount, const ObjectRef killer)
 {
     const std::shared_ptr<Object> &pkiller = _currentModule->getObjectHandler()[killer];
@@ -2187,7 +2172,7 @@ void Object::removeEnchantsWithIDSZ(const IDSZ2& idsz)
     if(idsz == IDSZ2::None) return;
 
     //Remove all active enchants that have the corresponding IDSZ
-    for(const std::shared_ptr<Ego::Enchantment> &enchant : _activeEnchants)
+    for(const std::shared_ptr<Ego::Enchantment> &enchant : getActiveEnchants())
     {
         if(enchant->isTerminated()) continue;
         if(idsz == enchant->getProfile()->removedByIDSZ) {
@@ -2196,16 +2181,16 @@ void Object::removeEnchantsWithIDSZ(const IDSZ2& idsz)
     }
 }
 
-std::forward_list<std::shared_ptr<Ego::Enchantment>>& Object::getActiveEnchants()
+EnchantHandler::Range Object::getActiveEnchants() const
 {
-    return _activeEnchants;
+    return _currentModule->getEnchantHandler().getEnchantments(getObjRef());
 }
 
 bool Object::disenchant()
 {
     bool oneRemoved = false;
 
-    for(const std::shared_ptr<Ego::Enchantment> &enchant : _activeEnchants) {
+    for(const std::shared_ptr<Ego::Enchantment> &enchant : getActiveEnchants()) {
         if(enchant->isTerminated()) continue;
         enchant->requestTerminate();
         oneRemoved = true;
@@ -2538,7 +2523,7 @@ bool Object::activateStealth()
     lineOfSightInfo.z1 = getPosZ() + std::max(1.0f, bump.height);
 
     //Check if there are any nearby Objects disrupting our stealth attempt
-    std::vector<std::shared_ptr<Object>> nearbyObjects = _currentModule->getObjectHandler().findObjects(getPosX(), getPosY(), WIDE, false);
+    auto nearbyObjects = _currentModule->getObjectHandler().findObjects(getPosX(), getPosY(), WIDE, Ego::Core::FrameArena::update(), false);
     for(const std::shared_ptr<Object> &object : nearbyObjects) {
         //Valid objects only
         if(object->isTerminated() || !object->isAlive() || object->isBeingHeld()) continue;
@@ -2979,7 +2964,7 @@ uint16_t Object::getMoney() const
 void Object::resetBoredTimer()
 {
     //5-8 seconds
-    bore_timer = Random::next<uint16_t>(250, 800);
+    bore_timer = _randomStream.next<uint16_t>(250, 800);
 }
 
 const std::shared_ptr<const Ego::Texture> Object::getSkinTexture() const
@@ -481,6 +481,17 @@ public:
 	/** @override */
 	BIT_FIELD test_wall(const Vector3f& pos) override;
 
+protected:
+	/** @override */
+	void onTileChanged() override;
+
+private:
+	/// The radius of the wall collision tests, the bump size if this object is on camera and 0 otherwise.
+	/// A recorded or replayed session always uses the bump size, the cameras are not part of the recording.
+	float getWallRadius() const;
+
+public:
+
     inline const AxisAlignedBox2f& getAxisAlignedBox2D() const { return _objectPhysics.getAxisAlignedBox2D(); }
 
     /**
@@ -647,7 +658,14 @@ public:
     *   Generates a new random level up seed. Should be called every time a level up is complete
     *   or first time generating a character from scratch (not a save game)
     **/
-    void randomizeLevelUpSeed() { _levelUpSeed = Random::next(Random::next<uint32_t>(numeric_limits<uint32_t>::max())); }
+    void randomizeLevelUpSeed() { _levelUpSeed = _randomStream.next<uint32_t>(numeric_limits<uint32_t>::max()); }
+
+    /**
+    * @brief
+    *   Get the random stream of this object. Random numbers concerning this object (damage rolls, its AI
+    *   script) are drawn from it, so they do not depend on the order in which the objects are updated.
+    **/
+    RandomStream& getRandomStream() { return _randomStream; }
 
     /**
     * @brief
@@ -663,7 +681,12 @@ public:
 
     void removeEnchantsWithIDSZ(const IDSZ2& idsz);
 
-    std::forward_list<std::shared_ptr<Ego::Enchantment>>& getActiveEnchants();
+    /**
+    * @return
+    *   the active enchantments on this Object, newest first. The range is invalidated by adding
+    *   an enchantment to any object, see EnchantHandler.
+    **/
+    EnchantHandler::Range getActiveEnchants() const;
 
     /**
     * @brief
@@ -823,6 +846,18 @@ public:
 
     inline bool isAnyLatchButtonPressed() { return _inputLatchesPressed.any(); }
 
+    /**
+    * @brief
+    *   Release all latch buttons but keep the desired velocity (unlike resetInputCommands())
+    **/
+    inline void resetLatchButtons() { _inputLatchesPressed.reset(); }
+
+    /**
+    * @return
+    *   the latch buttons currently set
+    **/
+    inline const std::bitset<LATCHBUTTON_COUNT>& getLatchButtons() const { return _inputLatchesPressed; }
+
 private:
 
     /**
@@ -977,6 +1012,7 @@ private:
 
     bool _terminateRequested;                        ///< True if this character no longer exists in the game and should be destructed
     ObjectRef _objRef;                               ///< The unique object reference of this object
+    RandomStream _randomStream;                      ///< The random stream of this object
     PRO_REF _profileID;                              ///< The ID of our profile
     std::shared_ptr<ObjectProfile> _profile;         ///< Our Profile
     bool _showStatus;                                ///< Display stats?
@@ -1013,7 +1049,6 @@ private:
     uint32_t _observationTimer;                       ///< Next update frame we are going to scan for hidden objects
 
     //Enchantment stuff
-    std::forward_list<std::shared_ptr<Ego::Enchantment>> _activeEnchants;    ///< List of all active enchants on this Object
     std::weak_ptr<Ego::Enchantment> _lastEnchantSpawned;    //< Last enchantment that his Object has spawned
 
     friend class ObjectHandler;
@@ -43,7 +43,10 @@ ObjectHandler::ObjectHandler() :
     _totalCharactersSpawned(0),
     _dynamicObjects(),
     _staticObjects(),
-    _updateStaticTreeClock(0)
+    _updateStaticTreeClock(0),
+    _teamIndex(),
+    _tileOccupancy(),
+    _boundsOccupancy()
 {
     _iteratorList.reserve(OBJECTS_MAX);
 }
@@ -67,6 +70,8 @@ bool ObjectHandler::remove(ObjectRef ref) {
 
 	// We can safely modify the map, it is not iterable from the outside.
 	_internalCharacterList.erase(ref);
+	_tileOccupancy.remove(ref);
+	_boundsOccupancy.remove(ref);
 
 	return true;
 }
@@ -169,6 +174,8 @@ void ObjectHandler::clear()
 	_internalCharacterList.clear();
 	_iteratorList.clear();
     _dynamicObjects.clear(0, 0, 0, 0);
+    _tileOccupancy.clear();
+    _boundsOccupancy.clear();
     _deletedCharacters = 0;
     _totalCharactersSpawned = 0;
 }
@@ -329,6 +336,9 @@ void ObjectHandler::updateQuadTree(float minX, float minY, float maxX, float max
             _dynamicObjects.insert(object);
         }
     }
+
+    //Rebuild team index (includes hidden objects, they still belong to their team)
+    _teamIndex.rebuild(_iteratorList, minX, minY, maxX, maxY);
 }
 
 std::vector<std::shared_ptr<Object>> ObjectHandler::findObjects(const float x, const float y, const float distance, bool includeSceneryObjects) const { 
@@ -339,8 +349,12 @@ std::vector<std::shared_ptr<Object>> ObjectHandler::findObjects(const float x, c
     return result;
 }
 
-void ObjectHandler::findObjects(const AxisAlignedBox2f &searchArea, std::vector<std::shared_ptr<Object>> &result, bool includeSceneryObjects) const
+Ego::Core::FrameVector<std::shared_ptr<Object>> ObjectHandler::findObjects(const float x, const float y, const float distance, Ego::Core::FrameArena &arena,
+                                                                            bool includeSceneryObjects) const
 {
+    auto result = Ego::Core::makeFrameVector<std::shared_ptr<Object>>(arena);
+    AxisAlignedBox2f searchArea = AxisAlignedBox2f(Point2f(x-distance, y-distance), Point2f(x+distance, y+distance));
+    _dynamicObjects.find(searchArea, result);
     if(includeSceneryObjects) _staticObjects.find(searchArea, result);
-    return _dynamicObjects.find(searchArea, result);
+    return result;
 }
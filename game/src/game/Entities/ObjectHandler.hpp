@@ -28,6 +28,8 @@
 
 #include "game/egoboo.h"
 #include "egolib/Core/QuadTree.hpp"
+#include "game/Entities/TeamSpatialIndex.hpp"
+#include "game/Entities/TileOccupancy.hpp"
 
 //Forward declarations
 class Object;
@@ -168,27 +170,57 @@ public:
 	**/
 	std::vector<std::shared_ptr<Object>> findObjects(const float x, const float y, const float distance, bool includeSceneryObjects = true) const;
 
+	/**
+	* @brief
+	*	Same as findObjects() above, but the result is allocated from a frame arena
+	**/
+	Ego::Core::FrameVector<std::shared_ptr<Object>> findObjects(const float x, const float y, const float distance, Ego::Core::FrameArena &arena,
+	                                                            bool includeSceneryObjects = true) const;
+
 	/**
 	* @brief
 	*	Find all elements that collide with a 2D bounding box area
 	* @param searchArea
 	*	The bounding box to scan
 	* @param result
-	*	reference to the vector where the result is stored
+	*	reference to the vector where the result is stored (e.g. a Ego::Core::FrameVector)
 	* @param includeSceneryObjects
 	*	if true, it will also include Scenery objects in the search as defined by Object::isScenery()
 	**/
-	void findObjects(const AxisAlignedBox2f &searchArea, std::vector<std::shared_ptr<Object>> &result, bool includeSceneryObjects = true) const;
+	template <typename Allocator>
+	void findObjects(const AxisAlignedBox2f &searchArea, std::vector<std::shared_ptr<Object>, Allocator> &result, bool includeSceneryObjects = true) const
+	{
+		if(includeSceneryObjects) _staticObjects.find(searchArea, result);
+		_dynamicObjects.find(searchArea, result);
+	}
 
 	/**
 	* @brief
-	* 	Clear and rebuild the quad tree for this update frame
+	* 	Clear and rebuild the quad tree and the team index for this update frame
 	*	This function is NOT thread-safe
 	* @param minX, minY, maxX, maxY
 	*	Sets the bounds of this quad tree (size of the entire current level)
 	**/
 	void updateQuadTree(float minX, float minY, float maxX, float maxY);
 
+	/**
+	* @return
+	*	The objects of each team as of the last updateQuadTree()
+	**/
+	const TeamSpatialIndex& getTeamIndex() const { return _teamIndex; }
+
+	/**
+	* @return
+	*	The objects on each tile by the position of the objects (kept current by the objects)
+	**/
+	TileOccupancy& getTileOccupancy() { return _tileOccupancy; }
+
+	/**
+	* @return
+	*	The objects on each tile by the 2D bounding box of the objects (kept current by the objects)
+	**/
+	TileOccupancy& getBoundsOccupancy() { return _boundsOccupancy; }
+
 	/**
 	* @return
 	*	All objects contained in this ObjectHandler
@@ -226,6 +258,9 @@ private:
 	Ego::QuadTree<Object> _dynamicObjects;			//Objects that can move (Creatures, moving platforms, etc.)
 	Ego::QuadTree<Object> _staticObjects;			//Objects that rarely move - if ever (Trees, pillars, chairs)
 	int _updateStaticTreeClock;
+	TeamSpatialIndex _teamIndex;					//All objects by team and location, for target searches
+	TileOccupancy _tileOccupancy;					//All objects by the tile of their position
+	TileOccupancy _boundsOccupancy;					//All objects by the tiles touched by their bounding box
 
 	std::unordered_map<ObjectRef, std::shared_ptr<Object>> _internalCharacterList; ///< Maps object references to shared pointers to objects
 	std::vector<std::shared_ptr<Object>> _iteratorList;					///< For iterating, contains only valid objects (unsorted)
@@ -37,6 +37,7 @@ const std::shared_ptr<Particle> Particle::INVALID_PARTICLE = nullptr;
 
 Particle::Particle() :
     _particleID(),
+    _randomStream(),
     _particlePhysics(*this),
     _collidedObjects(),
     _attachedTo(),
@@ -765,6 +766,7 @@ bool Particle::initialize(const ParticleRef particleID, const Vector3f& spawnPos
 
     //Clear any old data first
     reset(ParticleRef(particleID));
+    _randomStream = _currentModule->getRandomStream(GameModule::RandomStreamDomain::Particle, particleID.get());
 
     //Load particle profile
     _spawnerProfile = spawnProfile;
@@ -819,9 +821,9 @@ bool Particle::initialize(const ParticleRef particleID, const Vector3f& spawnPos
     // Targeting...
     vel.z() = 0;
 
-    offset.z() = generate_irand_pair(getProfile()->getSpawnPositionOffsetZ()) - (getProfile()->getSpawnPositionOffsetZ().rand / 2);
+    offset.z() = generate_irand_pair(getProfile()->getSpawnPositionOffsetZ(), _randomStream) - (getProfile()->getSpawnPositionOffsetZ().rand / 2);
     tmp_pos.z() += offset.z();
-    const int velocity = generate_irand_pair(getProfile()->getSpawnVelocityOffsetXY());
+    const int velocity = generate_irand_pair(getProfile()->getSpawnVelocityOffsetXY(), _randomStream);
 
     //Set target
     _target = spawnTarget;
@@ -869,7 +871,7 @@ bool Particle::initialize(const ParticleRef particleID, const Vector3f& spawnPos
                     aimError -= (0.5f/PERFECT_AIM) * attackerAgility;
                 }
 
-                offsetfacing = Random::next(getProfile()->getSpawnFacing().rand) - (getProfile()->getSpawnFacing().rand / 2);
+                offsetfacing = _randomStream.next(getProfile()->getSpawnFacing().rand) - (getProfile()->getSpawnFacing().rand / 2);
                 offsetfacing *= aimError;
             }
 
@@ -918,14 +920,14 @@ bool Particle::initialize(const ParticleRef particleID, const Vector3f& spawnPos
     else
     {
         // Correct loc_facing for randomness
-        offsetfacing = generate_irand_pair(getProfile()->getSpawnFacing()) - (getProfile()->getSpawnFacing().base + getProfile()->getSpawnFacing().rand / 2);
+        offsetfacing = generate_irand_pair(getProfile()->getSpawnFacing(), _randomStream) - (getProfile()->getSpawnFacing().base + getProfile()->getSpawnFacing().rand / 2);
     }
     loc_facing += Facing(offsetfacing);
     facing = Facing(loc_facing);
 
     // this is actually pointing in the opposite direction?
     // Location data from arguments
-    newrand = generate_irand_pair(getProfile()->getSpawnPositionOffsetXY());
+    newrand = generate_irand_pair(getProfile()->getSpawnPositionOffsetXY(), _randomStream);
     offset[kX] = -std::cos(loc_facing) * newrand;
     offset[kY] = -std::sin(loc_facing) * newrand;
 
@@ -947,7 +949,7 @@ bool Particle::initialize(const ParticleRef particleID, const Vector3f& spawnPos
     // Velocity data
     vel.x() = -std::cos(loc_facing) * velocity;
     vel.y() = -std::sin(loc_facing) * velocity;
-    vel.z() += generate_irand_pair(getProfile()->getSpawnVelocityOffsetZ()) - (getProfile()->getSpawnVelocityOffsetZ().rand / 2);
+    vel.z() += generate_irand_pair(getProfile()->getSpawnVelocityOffsetZ(), _randomStream) - (getProfile()->getSpawnVelocityOffsetZ().rand / 2);
     this->vel = vel_old = vel_stt = vel;
 
     // Template values
@@ -955,14 +957,14 @@ bool Particle::initialize(const ParticleRef particleID, const Vector3f& spawnPos
     type = getProfile()->type;
 
     // Image data
-    rotate = Facing((FACING_T)generate_irand_pair(getProfile()->rotate_pair));
+    rotate = Facing(static_cast<FACING_T>(generate_irand_pair(getProfile()->rotate_pair, _randomStream)));
     rotate_add = Facing(getProfile()->rotate_add);
 
     size_stt = getProfile()->size_base;
     size_add = getProfile()->size_add;
 
     _image._start = (getProfile()->image_stt)*EGO_ANIMATION_MULTIPLIER;
-    _image._add = generate_irand_pair(getProfile()->image_add);
+    _image._add = generate_irand_pair(getProfile()->image_add, _randomStream);
     _image._count = (getProfile()->image_max)*EGO_ANIMATION_MULTIPLIER;
 
     // a particle can EITHER end_lastframe or end_time.
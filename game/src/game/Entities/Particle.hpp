@@ -125,6 +125,13 @@ public:
      */
     ParticleRef getParticleID() const;
 
+    /**
+     * @brief
+     *  Get the random stream of this particle. It is derived from the module seed and the
+     *  particle reference, so the numbers drawn do not depend on the update order.
+     */
+    RandomStream& getRandomStream() { return _randomStream; }
+
     /**
      * @brief
      *  Get a pointer to the profile of this particle.
@@ -474,6 +481,7 @@ public:
 
 private:
     ParticleRef _particleID;                 ///< Unique identifier
+    RandomStream _randomStream;              ///< Random numbers of this particle
 
     //Collisions
     Ego::Physics::ParticlePhysics _particlePhysics;
@@ -0,0 +1,116 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/ParticleBudget.cpp
+/// @details Decides which particle spawn requests are granted, for a predictable particle cost
+
+#define GAME_ENTITIES_PRIVATE 1
+#include "game/Entities/ParticleBudget.hpp"
+#include "game/Graphics/CameraSystem.hpp"
+#include "game/Core/InputRecording.hpp"
+
+constexpr float ParticleBudget::THINNING_LOAD;
+constexpr float ParticleBudget::MIN_ANGULAR_SIZE;
+constexpr size_t ParticleBudget::SPAWN_LIMIT_DIVISOR;
+
+ParticleBudget::ParticleBudget() :
+    _cameraPositions(),
+    _credits(),
+    _cosmeticSpawns(0),
+    _statistics(),
+    _lastStatistics()
+{
+    //ctor
+}
+
+void ParticleBudget::beginUpdate()
+{
+    _lastStatistics = _statistics;
+    _statistics = Statistics();
+    _cosmeticSpawns = 0;
+
+    _cameraPositions.clear();
+    // Without a camera position the size on screen does not thin out particles (see InputRecording::isActive())
+    if (CameraSystem::get().isInitialized() && !InputRecording::isActive())
+    {
+        for (const std::shared_ptr<Camera> &camera : CameraSystem::get().getCameraList())
+        {
+            _cameraPositions.push_back(camera->getPosition());
+        }
+    }
+}
+
+void ParticleBudget::clear()
+{
+    _credits.clear();
+    _cosmeticSpawns = 0;
+    _statistics = Statistics();
+    _lastStatistics = Statistics();
+}
+
+float ParticleBudget::getAngularSize(const ParticleProfile &profile, const Vector3f &position) const
+{
+    if (_cameraPositions.empty())
+    {
+        return std::numeric_limits<float>::max();
+    }
+
+    float distance2 = std::numeric_limits<float>::max();
+    for (const Vector3f &cameraPosition : _cameraPositions)
+    {
+        distance2 = std::min(distance2, (position - cameraPosition).length_2());
+    }
+
+    // The base scale of Particle::getScale()
+    const float size = FP8_TO_FLOAT(profile.size_base) * 0.25f;
+    return size / std::max(1.0f, std::sqrt(distance2));
+}
+
+bool ParticleBudget::admit(PIP_REF profileRef, const ParticleProfile &profile, const Vector3f &position, size_t count, size_t limit)
+{
+    _statistics.requests++;
+    if (!profile.isCosmetic())
+    {
+        return true;
+    }
+    _statistics.cosmeticRequests++;
+
+    if (_cosmeticSpawns >= std::max<size_t>(1, limit / SPAWN_LIMIT_DIVISOR))
+    {
+        _statistics.capped++;
+        return false;
+    }
+
+    // The share of the requests to keep shrinks with the load of the pool and the size on screen
+    const float load = limit > 0 ? static_cast<float>(count) / limit : 1.0f;
+    const float loadShare = Ego::Math::constrain((1.0f - load) / (1.0f - THINNING_LOAD), 0.0f, 1.0f);
+    const float sizeShare = Ego::Math::constrain(getAngularSize(profile, position) / MIN_ANGULAR_SIZE, 0.0f, 1.0f);
+
+    float &credit = _credits[profileRef];
+    credit = std::min(1.0f, credit + loadShare * sizeShare);
+    if (credit < 1.0f)
+    {
+        _statistics.thinned++;
+        return false;
+    }
+    credit -= 1.0f;
+
+    _cosmeticSpawns++;
+    return true;
+}
@@ -0,0 +1,97 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/ParticleBudget.hpp
+/// @details Decides which particle spawn requests are granted, for a predictable particle cost
+
+#pragma once
+#if !defined(GAME_ENTITIES_PRIVATE) || GAME_ENTITIES_PRIVATE != 1
+#error(do not include directly, include `game/Entities/_Include.hpp` instead)
+#endif
+
+#include "game/egoboo.h"
+
+/**
+* @brief
+*	The emission budget of the ParticleHandler. Particles which affect the game are always granted
+*	(and may still fail if the pool is exhausted). Cosmetic particles (see ParticleProfile::isCosmetic())
+*	are thinned out as the pool fills up and as they become small on screen, and the number of cosmetic
+*	particles spawned per update is capped. The cost of particles degrades gradually under load rather
+*	than by sudden spawn failures.
+* @remark
+*	Thinning is deterministic: every particle profile accumulates the share of its requests to keep and
+*	a request is granted whenever a whole particle has accumulated, so a thinned emitter spawns evenly.
+**/
+class ParticleBudget : public Id::NonCopyable
+{
+public:
+	/// Cosmetic particles are thinned out once the pool is filled beyond this fraction
+	static constexpr float THINNING_LOAD = 0.5f;
+	/// Cosmetic particles smaller on screen than this angle (radians, a few pixels) are thinned out
+	static constexpr float MIN_ANGULAR_SIZE = 0.004f;
+	/// At most 1/SPAWN_LIMIT_DIVISOR of the display limit cosmetic particles are spawned per update
+	static constexpr size_t SPAWN_LIMIT_DIVISOR = 16;
+
+	struct Statistics
+	{
+		size_t requests;            ///< Spawn requests of the last update
+		size_t cosmeticRequests;    ///< Spawn requests of cosmetic particles of the last update
+		size_t thinned;             ///< Cosmetic particles thinned out due to load or screen size
+		size_t capped;              ///< Cosmetic particles dropped due to the per-update cap
+	};
+
+	ParticleBudget();
+
+	/**
+	* @brief
+	*	Start the budget of an update. Publishes the statistics of the previous one and
+	*	collects the positions of the cameras.
+	**/
+	void beginUpdate();
+
+	/**
+	* @brief
+	*	Decide if a particle spawn request is granted
+	* @param profileRef, profile
+	*	the profile of the particle
+	* @param position
+	*	the spawn position of the particle
+	* @param count, limit
+	*	the number of particles allocated and the display limit of the ParticleHandler
+	**/
+	bool admit(PIP_REF profileRef, const ParticleProfile &profile, const Vector3f &position, size_t count, size_t limit);
+
+	void clear();
+
+	/**
+	* @return
+	*	The statistics of the last update
+	**/
+	const Statistics& getStatistics() const { return _lastStatistics; }
+
+private:
+	/// The approximate size of a particle on screen as an angle, as seen from the nearest camera
+	float getAngularSize(const ParticleProfile &profile, const Vector3f &position) const;
+
+	std::vector<Vector3f> _cameraPositions;
+	std::unordered_map<PIP_REF, float> _credits;	///< The share of a particle accumulated per profile
+	size_t _cosmeticSpawns;							///< Cosmetic particles granted in this update
+	Statistics _statistics;
+	Statistics _lastStatistics;
+};
@@ -78,12 +78,15 @@ std::shared_ptr<Ego::Particle> ParticleHandler::spawnParticle(const Vector3f& sp
 
     if (!ppip)
     {
-        const std::string spawnOriginName = _currentModule->getObjectHandler().exists(spawnOrigin) ? _currentModule->getObjectHandler()[spawnOrigin]->getName() : "INVALID";
-        const std::string spawnProfileName = ProfileSystem::get().isValidProfileID(spawnProfile) ? ProfileSystem::get().getProfile(spawnProfile)->getPathname() : "INVALID";
-		Log::get().debug("spawn_one_particle() - cannot spawn particle with invalid particle profile == %d, spawn origin == %" PRIuZ " (\"%s\"), spawn profile == %d (\"%s\"))\n",
-                         REF_TO_INT(particleProfile), 
-                         spawnOrigin.get(), spawnOriginName.c_str(),
-                         REF_TO_INT(spawnProfile), spawnProfileName.c_str());
+        if (Log::isEnabled(Log::Level::Debug))
+        {
+            const std::string spawnOriginName = _currentModule->getObjectHandler().exists(spawnOrigin) ? _currentModule->getObjectHandler()[spawnOrigin]->getName() : "INVALID";
+            const std::string spawnProfileName = ProfileSystem::get().isValidProfileID(spawnProfile) ? ProfileSystem::get().getProfile(spawnProfile)->getPathname() : "INVALID";
+            Log::get().debug("spawn_one_particle() - cannot spawn particle with invalid particle profile == %d, spawn origin == %" PRIuZ " (\"%s\"), spawn profile == %d (\"%s\"))\n",
+                             REF_TO_INT(particleProfile), 
+                             spawnOrigin.get(), spawnOriginName.c_str(),
+                             REF_TO_INT(spawnProfile), spawnProfileName.c_str());
+        }
 
         return Ego::Particle::INVALID_PARTICLE;
     }
@@ -91,6 +94,11 @@ std::shared_ptr<Ego::Particle> ParticleHandler::spawnParticle(const Vector3f& sp
     // count all the requests for this particle type
     ppip->_spawnRequestCount++;
 
+    //Thin out cosmetic particles under load before they take a particle from the pool
+    if(!_budget.admit(particleProfile, *ppip, spawnPos, getCount(), _maxParticles)) {
+        return Ego::Particle::INVALID_PARTICLE;
+    }
+
     //Try to get a free particle
     std::shared_ptr<Ego::Particle> particle = getFreeParticle(ppip->force);
     if(particle) {
@@ -107,7 +115,7 @@ std::shared_ptr<Ego::Particle> ParticleHandler::spawnParticle(const Vector3f& sp
         }        
     }
 
-    if(!particle) {
+    if(!particle && Log::isEnabled(Log::Level::Debug)) {
         const std::string spawnOriginName = _currentModule->getObjectHandler().exists(spawnOrigin) ? _currentModule->getObjectHandler().get(spawnOrigin)->getName() : "INVALID";
         const std::string particleProfileName = LOADED_PIP(particleProfile) ? ProfileSystem::get().ParticleProfileSystem.get_ptr(particleProfile)->_name : "INVALID";
         const std::string spawnProfileName = ProfileSystem::get().isValidProfileID(spawnProfile) ? ProfileSystem::get().getProfile(spawnProfile)->getPathname().c_str() : "INVALID";
@@ -243,6 +251,8 @@ void ParticleHandler::unlock()
 
 void ParticleHandler::updateAllParticles()
 {
+    _budget.beginUpdate();
+
     //Update every active particle
     for(const std::shared_ptr<Ego::Particle> &particle : iterator())
     {
@@ -264,6 +274,7 @@ void ParticleHandler::clear()
     _activeParticles.clear();
     _unusedPool.clear();
     _particleMap.clear();
+    _budget.clear();
     _totalParticlesSpawned = 0;
 }
 
@@ -27,6 +27,7 @@
 
 #include "game/egoboo.h"
 #include "game/Entities/Particle.hpp"
+#include "game/Entities/ParticleBudget.hpp"
 
 class ParticleHandler : public Ego::Core::Singleton<ParticleHandler>
 {
@@ -92,6 +93,7 @@ public:
         _unusedPool(),
         _activeParticles(),
         _particleMap(),
+        _budget(),
         
         _transparentParticleTexture("mp_data/globalparticles/particle_trans"),
         _lightParticleTexture("mp_data/globalparticles/particle_light")
@@ -218,6 +220,12 @@ public:
 
     void spawnDefencePing(const std::shared_ptr<Object> &object, const std::shared_ptr<Object> &attacker);
 
+    /**
+    * @brief
+    *   Get the statistics of the emission budget of the last update
+    **/
+    const ParticleBudget::Statistics& getBudgetStatistics() const { return _budget.getStatistics(); }
+
 private:
     std::shared_ptr<Ego::Particle> getFreeParticle(bool force);
 
@@ -237,6 +245,7 @@ private:
     std::vector<std::shared_ptr<Ego::Particle>> _pendingParticles;   //Particles that will be added to the active list as soon as it is unlocked
 
     std::unordered_map<ParticleRef, std::shared_ptr<Ego::Particle>> _particleMap; //Mapping from PRT_REF to Particle
+    ParticleBudget _budget;                                                       //Decides which spawn requests are granted
 
     Ego::DeferredTexture _transparentParticleTexture;
     Ego::DeferredTexture _lightParticleTexture;
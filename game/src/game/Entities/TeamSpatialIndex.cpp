@@ -0,0 +1,225 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/TeamSpatialIndex.cpp
+/// @details A uniform grid of the objects of each team, for fast target searches
+
+#define GAME_ENTITIES_PRIVATE 1
+#include "game/Entities/TeamSpatialIndex.hpp"
+#include "game/Entities/Object.hpp"
+
+constexpr float TeamSpatialIndex::CELL_SIZE;
+
+TeamSpatialIndex::TeamSpatialIndex() :
+    _minX(0.0f),
+    _minY(0.0f),
+    _cellsX(1),
+    _cellsY(1),
+    _cellCount(1),
+    _objects(),
+    _bucketOffsets(Team::TEAM_MAX + 1, 0),
+    _objectBuckets()
+{
+    //ctor
+}
+
+int TeamSpatialIndex::getCellX(float x) const
+{
+    return Ego::Math::constrain(static_cast<int>(std::floor((x - _minX) / CELL_SIZE)), 0, _cellsX - 1);
+}
+
+int TeamSpatialIndex::getCellY(float y) const
+{
+    return Ego::Math::constrain(static_cast<int>(std::floor((y - _minY) / CELL_SIZE)), 0, _cellsY - 1);
+}
+
+void TeamSpatialIndex::rebuild(const std::vector<std::shared_ptr<Object>> &objects, float minX, float minY, float maxX, float maxY)
+{
+    _minX = minX;
+    _minY = minY;
+    _cellsX = std::max(1, static_cast<int>(std::ceil((maxX - minX) / CELL_SIZE)));
+    _cellsY = std::max(1, static_cast<int>(std::ceil((maxY - minY) / CELL_SIZE)));
+    _cellCount = _cellsX * _cellsY;
+
+    // Counting sort of the objects by bucket
+    const size_t bucketCount = Team::TEAM_MAX * _cellCount;
+    _bucketOffsets.assign(bucketCount + 1, 0);
+    _objectBuckets.clear();
+    for (const std::shared_ptr<Object> &object : objects)
+    {
+        if (object->isTerminated())
+        {
+            _objectBuckets.push_back(bucketCount);
+            continue;
+        }
+        const size_t bucket = getBucket(object->getTeam().toRef(), getCellX(object->getPosX()), getCellY(object->getPosY()));
+        _objectBuckets.push_back(bucket);
+        _bucketOffsets[bucket + 1]++;
+    }
+    for (size_t i = 0; i < bucketCount; ++i)
+    {
+        _bucketOffsets[i + 1] += _bucketOffsets[i];
+    }
+
+    _objects.assign(_bucketOffsets[bucketCount], nullptr);
+    std::vector<uint32_t> next(_bucketOffsets.begin(), _bucketOffsets.end() - 1);
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (_objectBuckets[i] != bucketCount)
+        {
+            _objects[next[_objectBuckets[i]]++] = objects[i];
+        }
+    }
+}
+
+TeamSpatialIndex::Range TeamSpatialIndex::getTeamMembers(TEAM_REF team) const
+{
+    const std::shared_ptr<Object> *data = _objects.data();
+    return Range(data + _bucketOffsets[team * _cellCount], data + _bucketOffsets[(team + 1) * _cellCount]);
+}
+
+void TeamSpatialIndex::findWithinRadius(const TeamMask &teams, const Vector3f &position, float radius, const Predicate &predicate,
+                                        std::vector<std::shared_ptr<Object>> &result) const
+{
+    const int minCellX = getCellX(position[kX] - radius), maxCellX = getCellX(position[kX] + radius);
+    const int minCellY = getCellY(position[kY] - radius), maxCellY = getCellY(position[kY] + radius);
+    const float radius2 = radius * radius;
+
+    for (TEAM_REF team = 0; team < Team::TEAM_MAX; ++team)
+    {
+        if (!teams[team]) continue;
+
+        for (int cellY = minCellY; cellY <= maxCellY; ++cellY)
+        {
+            // The cells of a row are adjacent buckets
+            const size_t first = _bucketOffsets[getBucket(team, minCellX, cellY)];
+            const size_t last = _bucketOffsets[getBucket(team, maxCellX, cellY) + 1];
+            for (size_t i = first; i < last; ++i)
+            {
+                const std::shared_ptr<Object> &object = _objects[i];
+                if ((object->getPosition() - position).length_2() > radius2) continue;
+                if (!predicate(object)) continue;
+                result.push_back(object);
+            }
+        }
+    }
+}
+
+void TeamSpatialIndex::findNearest(const TeamMask &teams, const Vector3f &position, size_t k, float radius, const Predicate &predicate,
+                                   std::vector<std::shared_ptr<Object>> &result) const
+{
+    if (0 == k) return;
+    size_t found = 0;
+    visitNearest(teams, position, radius, predicate,
+        [&result, &found, k](const std::shared_ptr<Object> &object, float)
+        {
+            result.push_back(object);
+            return ++found >= k;
+        });
+}
+
+bool TeamSpatialIndex::visitNearest(const TeamMask &teams, const Vector3f &position, float radius, const Predicate &predicate,
+                                    const Visitor &visitor) const
+{
+    struct Candidate
+    {
+        float distance2;
+        const std::shared_ptr<Object> *object;
+        bool operator<(const Candidate &other) const { return distance2 > other.distance2; } //min-heap
+    };
+    std::vector<Candidate> heap;
+
+    const bool limited = radius > 0.0f;
+    const float radius2 = radius * radius;
+    const int centerX = getCellX(position[kX]);
+    const int centerY = getCellY(position[kY]);
+    const int maxRing = std::max(std::max(centerX, _cellsX - 1 - centerX), std::max(centerY, _cellsY - 1 - centerY));
+
+    auto scanCell = [&](int cellX, int cellY)
+    {
+        if (cellX < 0 || cellY < 0 || cellX >= _cellsX || cellY >= _cellsY) return;
+        for (TEAM_REF team = 0; team < Team::TEAM_MAX; ++team)
+        {
+            if (!teams[team]) continue;
+            const size_t bucket = getBucket(team, cellX, cellY);
+            for (size_t i = _bucketOffsets[bucket]; i < _bucketOffsets[bucket + 1]; ++i)
+            {
+                const float distance2 = (_objects[i]->getPosition() - position).length_2();
+                if (limited && distance2 > radius2) continue;
+                if (!predicate(_objects[i])) continue;
+                heap.push_back(Candidate{distance2, &_objects[i]});
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+    };
+
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        // Scan the cells at Chebyshev distance ring from the center cell
+        if (0 == ring)
+        {
+            scanCell(centerX, centerY);
+        }
+        else
+        {
+            for (int i = -ring; i <= ring; ++i)
+            {
+                scanCell(centerX + i, centerY - ring);
+                scanCell(centerX + i, centerY + ring);
+            }
+            for (int i = -ring + 1; i <= ring - 1; ++i)
+            {
+                scanCell(centerX - ring, centerY + i);
+                scanCell(centerX + ring, centerY + i);
+            }
+        }
+
+        // Any object not scanned yet is at least this far away
+        float bound = std::numeric_limits<float>::max();
+        if (ring < maxRing)
+        {
+            bound = std::min(std::min(position[kX] - (_minX + (centerX - ring) * CELL_SIZE),
+                                      (_minX + (centerX + ring + 1) * CELL_SIZE) - position[kX]),
+                             std::min(position[kY] - (_minY + (centerY - ring) * CELL_SIZE),
+                                      (_minY + (centerY + ring + 1) * CELL_SIZE) - position[kY]));
+            bound = std::max(0.0f, bound);
+            if (limited && bound >= radius)
+            {
+                bound = std::numeric_limits<float>::max();
+            }
+        }
+        const bool done = (bound == std::numeric_limits<float>::max());
+        const float bound2 = done ? bound : bound * bound;
+
+        while (!heap.empty() && heap.front().distance2 <= bound2)
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            const Candidate candidate = heap.back();
+            heap.pop_back();
+            if (visitor(*candidate.object, candidate.distance2))
+            {
+                return true;
+            }
+        }
+
+        if (done) break;
+    }
+
+    return false;
+}
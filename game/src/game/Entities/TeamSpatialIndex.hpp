@@ -0,0 +1,134 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/TeamSpatialIndex.hpp
+/// @details A uniform grid of the objects of each team, for fast target searches
+
+#pragma once
+#if !defined(GAME_ENTITIES_PRIVATE) || GAME_ENTITIES_PRIVATE != 1
+#error(do not include directly, include `game/Entities/_Include.hpp` instead)
+#endif
+
+#include "game/egoboo.h"
+#include "egolib/Logic/Team.hpp"
+
+//Forward declarations
+class Object;
+
+/**
+* @brief
+*	The objects of a level bucketed by team and by grid cell. The buckets are stored contiguously
+*	(team major, cell minor), so the members of a team and the members of a team within a cell are
+*	both ranges of one array.
+* @remark
+*	The index is a snapshot rebuilt once per update frame together with the quad trees of the
+*	ObjectHandler, before the AI runs. It is not updated afterwards: objects spawned or moved to
+*	another team since then are missing or listed under their old team, and objects which moved
+*	since then stay in the cell of their old position. Distances are measured from the current
+*	positions, so findWithinRadius() and visitNearest() may miss such an object or, as the cells
+*	scanned are chosen by the old positions, visit it out of order. CleanUp and NEAREST target
+*	searches must not miss objects and scan the ObjectHandler instead.
+**/
+class TeamSpatialIndex : public Id::NonCopyable
+{
+public:
+	using TeamMask = std::bitset<Team::TEAM_MAX>;
+	using Predicate = std::function<bool(const std::shared_ptr<Object>&)>;
+	/// Returns true to end the search.
+	using Visitor = std::function<bool(const std::shared_ptr<Object>&, float distance2)>;
+
+	/// Side length of a grid cell (4 tiles)
+	static constexpr float CELL_SIZE = 512.0f;
+
+	/// A range of objects of the index
+	class Range
+	{
+	public:
+		Range(const std::shared_ptr<Object> *begin, const std::shared_ptr<Object> *end) : _begin(begin), _end(end) {}
+		const std::shared_ptr<Object> *begin() const { return _begin; }
+		const std::shared_ptr<Object> *end() const { return _end; }
+		size_t size() const { return _end - _begin; }
+	private:
+		const std::shared_ptr<Object> *_begin;
+		const std::shared_ptr<Object> *_end;
+	};
+
+	TeamSpatialIndex();
+
+	/**
+	* @brief
+	*	Clear and rebuild this index
+	* @param objects
+	*	the objects to index, terminated objects are skipped
+	* @param minX, minY, maxX, maxY
+	*	the bounds of the grid (size of the entire current level)
+	**/
+	void rebuild(const std::vector<std::shared_ptr<Object>> &objects, float minX, float minY, float maxX, float maxY);
+
+	/**
+	* @return
+	*	all indexed objects of a team
+	**/
+	Range getTeamMembers(TEAM_REF team) const;
+
+	/**
+	* @brief
+	*	Find the objects of the specified teams within a radius, in no particular order
+	* @param radius
+	*	the maximum distance to @a position
+	* @param predicate
+	*	objects for which the predicate returns false are skipped
+	**/
+	void findWithinRadius(const TeamMask &teams, const Vector3f &position, float radius, const Predicate &predicate,
+	                      std::vector<std::shared_ptr<Object>> &result) const;
+
+	/**
+	* @brief
+	*	Find the (up to) @a k nearest objects of the specified teams, in ascending distance
+	* @param radius
+	*	the maximum distance to @a position or 0 for no limit
+	**/
+	void findNearest(const TeamMask &teams, const Vector3f &position, size_t k, float radius, const Predicate &predicate,
+	                 std::vector<std::shared_ptr<Object>> &result) const;
+
+	/**
+	* @brief
+	*	Visit the objects of the specified teams in ascending distance until the visitor returns true.
+	*	Only the cells required to establish the order are scanned.
+	* @param radius
+	*	the maximum distance to @a position or 0 for no limit
+	* @return
+	*	true if the visitor ended the search
+	**/
+	bool visitNearest(const TeamMask &teams, const Vector3f &position, float radius, const Predicate &predicate,
+	                  const Visitor &visitor) const;
+
+private:
+	int getCellX(float x) const;
+	int getCellY(float y) const;
+	size_t getBucket(TEAM_REF team, int cellX, int cellY) const { return team * _cellCount + cellY * _cellsX + cellX; }
+
+	float _minX, _minY;
+	int _cellsX, _cellsY;
+	size_t _cellCount;
+
+	std::vector<std::shared_ptr<Object>> _objects;		///< Objects sorted by bucket
+	std::vector<uint32_t> _bucketOffsets;				///< Start of each bucket in _objects (plus the end)
+	std::vector<size_t> _objectBuckets;					///< Scratch buffer for rebuilding
+};
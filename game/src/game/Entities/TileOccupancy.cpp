@@ -0,0 +1,142 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/TileOccupancy.cpp
+/// @details The objects on each tile, updated only when an object moves to other tiles
+
+#define GAME_ENTITIES_PRIVATE 1
+#include "game/Entities/TileOccupancy.hpp"
+
+TileOccupancy::Area TileOccupancy::Area::ofPoint(float x, float y)
+{
+    const int tileX = std::max(0, static_cast<int>(std::floor(x / Info<float>::Grid::Size())));
+    const int tileY = std::max(0, static_cast<int>(std::floor(y / Info<float>::Grid::Size())));
+    return Area{tileX, tileY, tileX, tileY};
+}
+
+TileOccupancy::Area TileOccupancy::Area::ofBox(const AxisAlignedBox2f &box)
+{
+    const Area min = ofPoint(box.getMin().x(), box.getMin().y());
+    const Area max = ofPoint(box.getMax().x(), box.getMax().y());
+    return Area{min.minX, min.minY, max.maxX, max.maxY};
+}
+
+TileOccupancy::TileOccupancy() :
+    _areas(),
+    _tiles()
+{
+    //ctor
+}
+
+void TileOccupancy::update(ObjectRef ref, const Area &area)
+{
+    auto it = _areas.find(ref);
+    if (it != _areas.end())
+    {
+        if (it->second == area) return;
+        erase(ref, it->second);
+        it->second = area;
+    }
+    else
+    {
+        _areas.emplace(ref, area);
+    }
+    insert(ref, area);
+}
+
+void TileOccupancy::remove(ObjectRef ref)
+{
+    auto it = _areas.find(ref);
+    if (it == _areas.end()) return;
+    erase(ref, it->second);
+    _areas.erase(it);
+}
+
+void TileOccupancy::clear()
+{
+    _areas.clear();
+    _tiles.clear();
+}
+
+void TileOccupancy::insert(ObjectRef ref, const Area &area)
+{
+    for (int y = area.minY; y <= area.maxY; ++y)
+    {
+        for (int x = area.minX; x <= area.maxX; ++x)
+        {
+            _tiles[getKey(x, y)].push_back(ref);
+        }
+    }
+}
+
+void TileOccupancy::erase(ObjectRef ref, const Area &area)
+{
+    for (int y = area.minY; y <= area.maxY; ++y)
+    {
+        for (int x = area.minX; x <= area.maxX; ++x)
+        {
+            auto it = _tiles.find(getKey(x, y));
+            if (it == _tiles.end()) continue;
+            std::vector<ObjectRef> &objects = it->second;
+            auto object = std::find(objects.begin(), objects.end(), ref);
+            if (object != objects.end())
+            {
+                *object = objects.back();
+                objects.pop_back();
+            }
+            // Only occupied tiles have a list
+            if (objects.empty())
+            {
+                _tiles.erase(it);
+            }
+        }
+    }
+}
+
+void TileOccupancy::sortUnique(std::vector<ObjectRef> &result, size_t first)
+{
+    std::sort(result.begin() + first, result.end());
+    result.erase(std::unique(result.begin() + first, result.end()), result.end());
+}
+
+void TileOccupancy::find(const Area &area, std::vector<ObjectRef> &result) const
+{
+    const size_t first = result.size();
+    for (int y = area.minY; y <= area.maxY; ++y)
+    {
+        for (int x = area.minX; x <= area.maxX; ++x)
+        {
+            auto it = _tiles.find(getKey(x, y));
+            if (it == _tiles.end()) continue;
+            result.insert(result.end(), it->second.begin(), it->second.end());
+        }
+    }
+    sortUnique(result, first);
+}
+
+void TileOccupancy::find(const TilePredicate &predicate, std::vector<ObjectRef> &result) const
+{
+    const size_t first = result.size();
+    for (const auto &tile : _tiles)
+    {
+        if (!predicate(tile.first & 0xFFFF, tile.first >> 16)) continue;
+        result.insert(result.end(), tile.second.begin(), tile.second.end());
+    }
+    sortUnique(result, first);
+}
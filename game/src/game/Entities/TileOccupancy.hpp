@@ -0,0 +1,109 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Entities/TileOccupancy.hpp
+/// @details The objects on each tile, updated only when an object moves to other tiles
+
+#pragma once
+#if !defined(GAME_ENTITIES_PRIVATE) || GAME_ENTITIES_PRIVATE != 1
+#error(do not include directly, include `game/Entities/_Include.hpp` instead)
+#endif
+
+#include "game/egoboo.h"
+
+/**
+* @brief
+*	Lists the objects occupying each tile of a level. Every object occupies a rectangle of tiles
+*	(a single tile for its position or the tiles touched by its bounding box). Only tiles which
+*	are occupied by at least one object have a list, so visiting the occupied tiles costs
+*	O(occupied tiles) rather than O(objects).
+* @remark
+*	The owner of an occupancy keeps it current by calling update() whenever the rectangle of an
+*	object may have changed, update() returns right away if it did not.
+**/
+class TileOccupancy : public Id::NonCopyable
+{
+public:
+	/// An inclusive rectangle of tiles
+	struct Area
+	{
+		int minX, minY, maxX, maxY;
+
+		/// The tile containing a point
+		static Area ofPoint(float x, float y);
+		/// The tiles touched by a box
+		static Area ofBox(const AxisAlignedBox2f &box);
+
+		bool operator==(const Area &other) const
+		{
+			return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+		}
+		bool operator!=(const Area &other) const { return !(*this == other); }
+	};
+
+	/// Returns true for the tiles whose objects are to be found.
+	using TilePredicate = std::function<bool(int x, int y)>;
+
+	TileOccupancy();
+
+	/**
+	* @brief
+	*	Move an object to the tiles of an area, adding it if it is not in this occupancy yet
+	**/
+	void update(ObjectRef ref, const Area &area);
+
+	/**
+	* @brief
+	*	Remove an object from this occupancy
+	**/
+	void remove(ObjectRef ref);
+
+	void clear();
+
+	/**
+	* @brief
+	*	Find the objects occupying any tile of an area
+	* @param result
+	*	the objects are appended in ascending order of their references, each object once
+	**/
+	void find(const Area &area, std::vector<ObjectRef> &result) const;
+
+	/**
+	* @brief
+	*	Find the objects occupying any of the occupied tiles for which the predicate returns true
+	* @param result
+	*	the objects are appended in ascending order of their references, each object once
+	**/
+	void find(const TilePredicate &predicate, std::vector<ObjectRef> &result) const;
+
+	/**
+	* @return
+	*	the number of tiles occupied by at least one object
+	**/
+	size_t getOccupiedTileCount() const { return _tiles.size(); }
+
+private:
+	static uint32_t getKey(int x, int y) { return (static_cast<uint32_t>(y) << 16) | static_cast<uint32_t>(x); }
+	void insert(ObjectRef ref, const Area &area);
+	void erase(ObjectRef ref, const Area &area);
+	static void sortUnique(std::vector<ObjectRef> &result, size_t first);
+
+	std::unordered_map<ObjectRef, Area> _areas;						///< The area each object occupies
+	std::unordered_map<uint32_t, std::vector<ObjectRef>> _tiles;	///< The objects on each occupied tile
+};
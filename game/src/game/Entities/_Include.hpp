@@ -2,6 +2,7 @@
 
 #define GAME_ENTITIES_PRIVATE 1
 #include "game/Entities/Enchant.hpp"
+#include "game/Entities/EnchantHandler.hpp"
 #include "game/Entities/Particle.hpp"
 #include "game/Entities/ParticleHandler.hpp"
 #include "game/Entities/Object.hpp"
@@ -120,40 +120,7 @@ void LoadingState::beginState()
 
 bool LoadingState::loadPlayers()
 {
-    // blank out any existing data
-    import_list_t::init(g_importList);
-
-    // loop through the selected players and store all the valid data in the list of imported players
-    for(const std::string &loadPath : _playersToLoad)
-    {
-        // get a new import data pointer
-        import_element_t *import_ptr = g_importList.lst + g_importList.count;
-        g_importList.count++;
-
-        //figure out which player we are (1, 2, 3 or 4)
-        import_ptr->local_player_num = g_importList.count-1;
-
-        // set the import info
-        import_ptr->slot            = (import_ptr->local_player_num) * MAX_IMPORT_PER_PLAYER;
-        import_ptr->player          = (import_ptr->local_player_num);
-
-        import_ptr->srcDir = loadPath;
-        import_ptr->dstDir = "";
-    }
-
-    if(g_importList.count > 0) {
-
-        if(game_copy_imports(&g_importList) == rv_success) {
-            return true;
-        }
-        else {
-            // erase the data in the import folder
-            vfs_removeDirectoryAndContents( "import", VFS_TRUE );
-            return false;
-        }
-    }
-
-    return false;
+    return game_import_players(_playersToLoad);
 }
 
 void LoadingState::loadModuleData()
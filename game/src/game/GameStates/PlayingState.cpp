@@ -32,19 +32,48 @@
 #include "game/GUI/MessageLog.hpp"
 #include "game/game.h"
 #include "game/graphic.h"
+#include "game/graphic_billboard.h"
+#include "game/graphic_prt.h"
 #include "game/Logic/Player.hpp"
 
 //For cheats
 #include "game/Entities/_Include.hpp"
 #include "game/Module/Module.hpp"
 
+namespace {
+
+/// Get the average and maximum milliseconds per call of a profiler zone during the last second.
+std::string getProfileZoneSummary(const std::string& zone)
+{
+    // Summarizing copies the recent zones of all threads, so do it at most four times a second
+    static std::vector<Ego::Time::ProfileSummary> summaries;
+    static uint32_t nextUpdate = 0;
+    if (Time::now<Time::Unit::Ticks>() >= nextUpdate)
+    {
+        summaries = Ego::Time::Profiler::get().summarize();
+        nextUpdate = Time::now<Time::Unit::Ticks>() + 250;
+    }
+    for (const Ego::Time::ProfileSummary& summary : summaries)
+    {
+        if (summary.name == zone)
+        {
+            std::ostringstream os;
+            os << std::fixed << std::setprecision(2) << summary.average << " / " << summary.maximum << " ms (" << summary.calls << ")";
+            return os.str();
+        }
+    }
+    return "-";
+}
+
+} // namespace
+
 PlayingState::PlayingState() :
     _miniMap(std::make_shared<Ego::GUI::MiniMap>()),
     _messageLog(std::make_shared<Ego::GUI::MessageLog>()),
     _statusList()
 {
-    //For debug only
-    if (egoboo_config_t::get().debug_developerMode_enable.getValue())
+    //For debug only (a headless run has no UIManager and hence no fonts for the debug windows)
+    if (egoboo_config_t::get().debug_developerMode_enable.getValue() && !_gameEngine->isHeadless())
     {
         auto debugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("CurrentModule");
         debugWindow->addWatchVariable("Passages", []{return std::to_string(_currentModule->getPassageCount());} );
@@ -55,18 +84,112 @@ PlayingState::PlayingState() :
         debugWindow->addWatchVariable("Name", []{return _currentModule->getName();} );
         debugWindow->addWatchVariable("Path", []{return _currentModule->getPath();} );
         addComponent(debugWindow);        
+
+        auto fontDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("FontCache");
+        fontDebugWindow->addWatchVariable("Hits", []{return std::to_string(Ego::FontManager::get().getStatistics().cacheHits);} );
+        fontDebugWindow->addWatchVariable("Misses", []{return std::to_string(Ego::FontManager::get().getStatistics().cacheMisses);} );
+        fontDebugWindow->addWatchVariable("Evictions", []{return std::to_string(Ego::FontManager::get().getStatistics().cacheEvictions);} );
+        fontDebugWindow->addWatchVariable("Glyphs", []{return std::to_string(Ego::FontManager::get().getStatistics().glyphsRasterized);} );
+        fontDebugWindow->addWatchVariable("Raster (us)", []{return std::to_string(Ego::FontManager::get().getStatistics().rasterizationMicroseconds);} );
+        addComponent(fontDebugWindow);
+
+        auto audioDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("SoundBank");
+        audioDebugWindow->addWatchVariable("Resident (bytes)", []{return std::to_string(AudioSystem::get().getSoundStatistics().residentBytes);} );
+        audioDebugWindow->addWatchVariable("Encoded (bytes)", []{return std::to_string(AudioSystem::get().getSoundStatistics().encodedBytes);} );
+        audioDebugWindow->addWatchVariable("Decoded", []{return std::to_string(AudioSystem::get().getSoundStatistics().decodedSounds);} );
+        audioDebugWindow->addWatchVariable("Evictions", []{return std::to_string(AudioSystem::get().getSoundStatistics().evictions);} );
+        audioDebugWindow->addWatchVariable("Failed decodes", []{return std::to_string(AudioSystem::get().getSoundStatistics().failedDecodes);} );
+        audioDebugWindow->addWatchVariable("Decode (us)", []{return std::to_string(AudioSystem::get().getSoundStatistics().decodeMicroseconds);} );
+        addComponent(audioDebugWindow);
+
+        auto losDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("LineOfSight");
+        losDebugWindow->addWatchVariable("Tests", []{return std::to_string(line_of_sight_info_t::getStatistics().tests);} );
+        losDebugWindow->addWatchVariable("Regions clear", []{return std::to_string(line_of_sight_info_t::getStatistics().regionsClear);} );
+        losDebugWindow->addWatchVariable("Cache hits", []{return std::to_string(line_of_sight_info_t::getStatistics().cacheHits);} );
+        losDebugWindow->addWatchVariable("Walks", []{return std::to_string(line_of_sight_info_t::getStatistics().walks);} );
+        addComponent(losDebugWindow);
+
+        auto billboardDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("Billboards");
+        billboardDebugWindow->addWatchVariable("Billboards", []{return std::to_string(BillboardSystem::get().getStatistics().billboards);} );
+        billboardDebugWindow->addWatchVariable("Atlas pages", []{return std::to_string(BillboardSystem::get().getStatistics().pages);} );
+        billboardDebugWindow->addWatchVariable("Own textures", []{return std::to_string(BillboardSystem::get().getStatistics().fallbacks);} );
+        billboardDebugWindow->addWatchVariable("Textures created/s", []{return std::to_string(BillboardSystem::get().getStatistics().texturesCreatedPerSecond);} );
+        addComponent(billboardDebugWindow);
+
+        auto particleDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("ParticleBatch");
+        particleDebugWindow->addWatchVariable("Billboards", []{return std::to_string(ParticleBatch::get().getStatistics().billboards);} );
+        particleDebugWindow->addWatchVariable("Draw calls", []{return std::to_string(ParticleBatch::get().getStatistics().drawCalls);} );
+        addComponent(particleDebugWindow);
+
+        auto budgetDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("ParticleBudget");
+        budgetDebugWindow->addWatchVariable("Spawn requests", []{return std::to_string(ParticleHandler::get().getBudgetStatistics().requests);} );
+        budgetDebugWindow->addWatchVariable("Cosmetic requests", []{return std::to_string(ParticleHandler::get().getBudgetStatistics().cosmeticRequests);} );
+        budgetDebugWindow->addWatchVariable("Thinned", []{return std::to_string(ParticleHandler::get().getBudgetStatistics().thinned);} );
+        budgetDebugWindow->addWatchVariable("Capped", []{return std::to_string(ParticleHandler::get().getBudgetStatistics().capped);} );
+        budgetDebugWindow->addWatchVariable("Active", []{return std::to_string(ParticleHandler::get().getCount());} );
+        addComponent(budgetDebugWindow);
+
+        auto aiDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("AIScheduler");
+        aiDebugWindow->addWatchVariable("Scripts run", []{return std::to_string(_currentModule->getAIScheduler().getStatistics().scriptsRun);} );
+        aiDebugWindow->addWatchVariable("Scripts skipped", []{return std::to_string(_currentModule->getAIScheduler().getStatistics().scriptsSkipped);} );
+        aiDebugWindow->addWatchVariable("Woken by events", []{return std::to_string(_currentModule->getAIScheduler().getStatistics().scriptsWoken);} );
+        addComponent(aiDebugWindow);
+
+        auto arenaDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("FrameArena");
+        arenaDebugWindow->addWatchVariable("Update heap allocs", []{return std::to_string(Ego::Core::FrameArena::update().getStatistics().heapAllocations);} );
+        arenaDebugWindow->addWatchVariable("Update used", []{return std::to_string(Ego::Core::FrameArena::update().getStatistics().used) + " / " + std::to_string(Ego::Core::FrameArena::update().getStatistics().capacity);} );
+        arenaDebugWindow->addWatchVariable("Update overflows", []{return std::to_string(Ego::Core::FrameArena::update().getStatistics().overflows);} );
+        arenaDebugWindow->addWatchVariable("Render heap allocs", []{return std::to_string(Ego::Core::FrameArena::render().getStatistics().heapAllocations);} );
+        arenaDebugWindow->addWatchVariable("Render used", []{return std::to_string(Ego::Core::FrameArena::render().getStatistics().used) + " / " + std::to_string(Ego::Core::FrameArena::render().getStatistics().capacity);} );
+        arenaDebugWindow->addWatchVariable("Render overflows", []{return std::to_string(Ego::Core::FrameArena::render().getStatistics().overflows);} );
+        addComponent(arenaDebugWindow);
+
+        auto cameraDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("CameraSystem");
+        auto formatMilliseconds = [](double milliseconds)
+        {
+            std::ostringstream os;
+            os << std::fixed << std::setprecision(2) << milliseconds << " ms";
+            return os.str();
+        };
+        cameraDebugWindow->addWatchVariable("Cameras", []{return std::to_string(CameraSystem::get().getStatistics().cameras);} );
+        for (size_t i = 0; i < MAX_CAMERAS; ++i)
+        {
+            cameraDebugWindow->addWatchVariable("Prepare #" + std::to_string(i + 1), [i, formatMilliseconds]
+            {
+                const auto& statistics = CameraSystem::get().getStatistics();
+                return i < statistics.cameras ? formatMilliseconds(statistics.prepareTime[i]) : std::string("-");
+            });
+        }
+        cameraDebugWindow->addWatchVariable("Prepare (all)", [formatMilliseconds]{return formatMilliseconds(CameraSystem::get().getStatistics().prepareWallTime);} );
+        cameraDebugWindow->addWatchVariable("Frame", [formatMilliseconds]{return formatMilliseconds(CameraSystem::get().getStatistics().frameTime);} );
+        addComponent(cameraDebugWindow);
+
+        auto profilerDebugWindow = std::make_shared<Ego::GUI::InternalDebugWindow>("Profiler (F10: trace)");
+        for (const char *zone : {"update", "update.misc", "update.ai", "update.objects", "update.particles",
+                                 "update.movement", "update.collisions", "update.camera",
+                                 "render", "render.prepare", "render.world", "render.billboards", "render.hud"})
+        {
+            const std::string name = zone;
+            profilerDebugWindow->addWatchVariable(name, [name]{return getProfileZoneSummary(name);} );
+        }
+        addComponent(profilerDebugWindow);
     }
 
     //Add minimap to the list of GUI components to render
     _miniMap->setSize(Vector2f(Ego::GUI::MiniMap::MAPSIZE, Ego::GUI::MiniMap::MAPSIZE));
-    _miniMap->setPosition(Point2f(0, _gameEngine->getUIManager()->getScreenHeight()-_miniMap->getHeight()));
     addComponent(_miniMap);
 
     //Add the message log
-    _messageLog->setSize(Vector2f(_gameEngine->getUIManager()->getScreenWidth() - WRAP_TOLERANCE, _gameEngine->getUIManager()->getScreenHeight() / 3));
-    _messageLog->setPosition(Point2f(0, fontyspacing));
     addComponent(_messageLog);
 
+    //Place them on the screen (a headless run has none and never draws them)
+    if (!_gameEngine->isHeadless())
+    {
+        _miniMap->setPosition(Point2f(0, _gameEngine->getUIManager()->getScreenHeight()-_miniMap->getHeight()));
+        _messageLog->setSize(Vector2f(_gameEngine->getUIManager()->getScreenWidth() - WRAP_TOLERANCE, _gameEngine->getUIManager()->getScreenHeight() / 3));
+        _messageLog->setPosition(Point2f(0, fontyspacing));
+    }
+
     //Show status display for all players
     for(const std::shared_ptr<Ego::Player> &player : _currentModule->getPlayerList()) {
         addStatusMonitor(player->getObject());
@@ -176,6 +299,23 @@ bool PlayingState::notifyKeyboardKeyPressed(const Ego::Events::KeyboardKeyPresse
             }
         break;
 
+        //Export the recently profiled zones for chrome://tracing
+        case SDLK_F10:
+            if (egoboo_config_t::get().debug_developerMode_enable.getValue())
+            {
+                std::ostringstream os;
+                Ego::Time::Profiler::get().writeChromeTrace(os);
+                vfs_FILE *file = vfs_openWrite("/debug/profile_trace.json");
+                if (file)
+                {
+                    vfs_puts(os.str().c_str(), file);
+                    vfs_close(file);
+                    Log::get().info("wrote profiler trace to /debug/profile_trace.json\n");
+                }
+                return true;
+            }
+        break;
+
         //Show character sheet
         case SDLK_1:
         case SDLK_2:
@@ -25,12 +25,15 @@
 #include "game/Core/GameEngine.hpp"
 
 #include "game/Entities/_Include.hpp"
+#include "egolib/Core/ThreadPool.hpp"
 
 CameraSystem::CameraSystem() :
 	_initialized(false),
 	_cameraList(),
     _mainCamera(nullptr),
-    _cameraOptions()
+    _cameraOptions(),
+    _preparePool(),
+    _statistics()
 {
     //ctor
 }
@@ -102,9 +105,9 @@ void CameraSystem::resetAllTargets( const ego_mesh_t * mesh )
     }
 }
 
-egolib_rv CameraSystem::renderAll(std::function<void(std::shared_ptr<Camera>, std::shared_ptr<Ego::Graphics::TileList>, std::shared_ptr<Ego::Graphics::EntityList>)> renderFunction)
+egolib_rv CameraSystem::renderAll(const PrepareFunction& prepareFunction, const RenderFunction& renderFunction)
 {
-    if ( NULL == renderFunction ) {
+    if ( NULL == prepareFunction || NULL == renderFunction ) {
         return rv_error;
     }
 
@@ -112,19 +115,83 @@ egolib_rv CameraSystem::renderAll(std::function<void(std::shared_ptr<Camera>, st
         return rv_fail;
     }
 
+    using Clock = std::chrono::steady_clock;
+    auto milliseconds = [](Clock::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); };
+    const Clock::time_point frameStart = Clock::now();
+
+    // has a camera already rendered this frame?
+    std::vector<std::shared_ptr<Camera>> cameras;
+    for(const std::shared_ptr<Camera> &camera : _cameraList) 
+    {
+        if ( camera->getLastFrame() >= 0 && static_cast<uint32_t>(camera->getLastFrame()) >= _gameEngine->getNumberOfFramesRendered()) {
+            continue;
+        }
+        cameras.push_back(camera);
+    }
+
+    _statistics = Statistics();
+    _statistics.cameras = cameras.size();
+
+    // prepare all cameras at once, the calling thread takes the first one
+    std::array<egolib_rv, MAX_CAMERAS> prepared;
+    prepared.fill(rv_error);
+    {
+        // keep terminated particles from being freed while the worker threads iterate the particles
+        auto particles = ParticleHandler::get().iterator();
+
+        auto prepare = [this, &prepareFunction, &prepared, &milliseconds](const std::shared_ptr<Camera> &camera, size_t index)
+        {
+            const Clock::time_point start = Clock::now();
+            prepared[index] = prepareFunction(camera, camera->getTileList(), camera->getEntityList());
+            _statistics.prepareTime[index] = milliseconds(Clock::now() - start);
+        };
+
+        if (cameras.size() > 1 && !_preparePool) {
+            _preparePool = std::make_unique<ThreadPool>(MAX_CAMERAS - 1);
+        }
+        std::vector<std::future<void>> pending;
+        for(size_t i = 1; i < cameras.size(); ++i) {
+            pending.push_back(_preparePool->submit(prepare, cameras[i], i));
+        }
+        // wait for all worker threads before passing on an exception, they refer to this stack frame
+        std::exception_ptr error;
+        try {
+            if (!cameras.empty()) {
+                prepare(cameras[0], 0);
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+        for(std::future<void> &future : pending) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!error) error = std::current_exception();
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    _statistics.prepareWallTime = milliseconds(Clock::now() - frameStart);
+
     //Store main camera to restore
     std::shared_ptr<Camera> storeMainCam = _mainCamera;
 
-    for(const std::shared_ptr<Camera> &camera : _cameraList) 
+    egolib_rv result = rv_success;
+    for(size_t i = 0; i < cameras.size(); ++i)
     {
-        // set the "global" camera pointer to this camera
-        _mainCamera = camera;
+        const std::shared_ptr<Camera> &camera = cameras[i];
 
-	    // has this camera already rendered this frame?
-        if ( camera->getLastFrame() >= 0 && static_cast<uint32_t>(camera->getLastFrame()) >= _gameEngine->getNumberOfFramesRendered()) {
+        // do not render a camera whose tile list or entity list could not be built
+        if (rv_error == prepared[i]) {
+            result = rv_error;
             continue;
         }
 
+        // set the "global" camera pointer to this camera
+        _mainCamera = camera;
+
         // set up everything for this camera
         beginCameraMode(camera);
 
@@ -141,7 +208,9 @@ egolib_rv CameraSystem::renderAll(std::function<void(std::shared_ptr<Camera>, st
     // reset the "global" camera pointer to whatever it was
     _mainCamera = storeMainCam;
 
-    return rv_success;
+    _statistics.frameTime = milliseconds(Clock::now() - frameStart);
+
+    return result;
 }
 
 size_t CameraSystem::getCameraIndex(ObjectRef targetRef) const {
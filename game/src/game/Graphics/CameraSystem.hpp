@@ -25,6 +25,7 @@
 
 // Forward declaration.
 class ego_mesh_t;
+class ThreadPool;
 
 static constexpr size_t MAX_CAMERAS = MAX_LOCAL_PLAYERS;
 
@@ -48,6 +49,24 @@ protected:
     virtual ~CameraSystem();
 
 public:
+	/// A function preparing the world as seen by a camera.
+	using PrepareFunction = std::function<egolib_rv(std::shared_ptr<Camera>, std::shared_ptr<Ego::Graphics::TileList>, std::shared_ptr<Ego::Graphics::EntityList>)>;
+	/// A function rendering the world as seen by a camera.
+	using RenderFunction = std::function<void(std::shared_ptr<Camera>, std::shared_ptr<Ego::Graphics::TileList>, std::shared_ptr<Ego::Graphics::EntityList>)>;
+
+	/// Timings of the last call to renderAll(), in milliseconds.
+	struct Statistics {
+		/// The number of cameras rendered.
+		size_t cameras;
+		/// The CPU time spent preparing each camera.
+		std::array<double, MAX_CAMERAS> prepareTime;
+		/// The wall time spent preparing all cameras.
+		double prepareWallTime;
+		/// The wall time spent in renderAll() altogether.
+		double frameTime;
+		Statistics() : cameras(0), prepareTime(), prepareWallTime(0.0), frameTime(0.0) {}
+	};
+
 	/**
 	 * @return true if the camera system has been initialized and can be used
 	 */
@@ -56,7 +75,22 @@ public:
 	void updateAll( const ego_mesh_t * mesh );
 	void resetAllTargets( const ego_mesh_t * mesh );
 
-	egolib_rv renderAll(std::function<void(std::shared_ptr<Camera>, std::shared_ptr<Ego::Graphics::TileList>, std::shared_ptr<Ego::Graphics::EntityList>)> renderFunction);
+	/**
+	 * @brief
+	 *  Render the world for all cameras which have not been rendered this frame yet.
+	 * @param prepareFunction
+	 *  called for each camera first. The calls for the different cameras run concurrently
+	 *  on worker threads and may thus neither touch OpenGL nor state shared by the cameras.
+	 * @param renderFunction
+	 *  called for each camera on the calling thread, once all cameras were prepared.
+	 *  It is not called for a camera which could not be prepared.
+	 * @return
+	 *  rv_error if a camera could not be prepared, rv_success otherwise
+	 */
+	egolib_rv renderAll(const PrepareFunction& prepareFunction, const RenderFunction& renderFunction);
+
+	/// @return the timings of the last call to renderAll()
+	const Statistics& getStatistics() const { return _statistics; }
 
 	/**
 	 * @brief
@@ -116,4 +150,7 @@ private:
 	std::vector<std::shared_ptr<Camera>> _cameraList;
 	std::shared_ptr<Camera> _mainCamera;
 	CameraOptions _cameraOptions;
+	/// The threads preparing all but the first camera (created on demand).
+	std::unique_ptr<ThreadPool> _preparePool;
+	Statistics _statistics;
 };
@@ -0,0 +1,90 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Graphics/DynamicLightClusters.cpp
+/// @brief A 2D grid of clusters binning the dynamic lights of the visible region
+
+#include "game/Graphics/DynamicLightClusters.hpp"
+
+namespace Ego {
+namespace Graphics {
+
+constexpr float DynamicLightClusters::CLUSTER_SIZE;
+
+DynamicLightClusters::DynamicLightClusters() :
+    _minX(0.0f),
+    _minY(0.0f),
+    _clustersX(1),
+    _clustersY(1),
+    _lights(),
+    _clusterOffsets(2, 0)
+{}
+
+int DynamicLightClusters::getClusterX(float x) const {
+    return Ego::Math::constrain(static_cast<int>(std::floor((x - _minX) / CLUSTER_SIZE)), 0, _clustersX - 1);
+}
+
+int DynamicLightClusters::getClusterY(float y) const {
+    return Ego::Math::constrain(static_cast<int>(std::floor((y - _minY) / CLUSTER_SIZE)), 0, _clustersY - 1);
+}
+
+void DynamicLightClusters::rebuild(const ego_frect_t& region, const std::vector<ego_frect_t>& bounds, float margin) {
+    _minX = region.xmin;
+    _minY = region.ymin;
+    _clustersX = std::max(1, static_cast<int>(std::ceil((region.xmax - region.xmin) / CLUSTER_SIZE)));
+    _clustersY = std::max(1, static_cast<int>(std::ceil((region.ymax - region.ymin) / CLUSTER_SIZE)));
+    const size_t clusterCount = _clustersX * _clustersY;
+
+    // Counting sort of the lights by cluster. A light is in every cluster its bound overlaps.
+    _clusterOffsets.assign(clusterCount + 1, 0);
+    for (const ego_frect_t& bound : bounds) {
+        const int minX = getClusterX(bound.xmin - margin), maxX = getClusterX(bound.xmax + margin);
+        const int minY = getClusterY(bound.ymin - margin), maxY = getClusterY(bound.ymax + margin);
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                _clusterOffsets[y * _clustersX + x + 1]++;
+            }
+        }
+    }
+    for (size_t i = 0; i < clusterCount; ++i) {
+        _clusterOffsets[i + 1] += _clusterOffsets[i];
+    }
+
+    _lights.resize(_clusterOffsets[clusterCount]);
+    std::vector<uint32_t> next(_clusterOffsets.begin(), _clusterOffsets.end() - 1);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        const ego_frect_t& bound = bounds[i];
+        const int minX = getClusterX(bound.xmin - margin), maxX = getClusterX(bound.xmax + margin);
+        const int minY = getClusterY(bound.ymin - margin), maxY = getClusterY(bound.ymax + margin);
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                _lights[next[y * _clustersX + x]++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
+
+DynamicLightClusters::Range DynamicLightClusters::get(float x, float y) const {
+    const size_t cluster = getClusterY(y) * _clustersX + getClusterX(x);
+    const uint32_t *data = _lights.data();
+    return Range(data + _clusterOffsets[cluster], data + _clusterOffsets[cluster + 1]);
+}
+
+} // namespace Graphics
+} // namespace Ego
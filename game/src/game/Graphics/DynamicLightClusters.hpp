@@ -0,0 +1,89 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Graphics/DynamicLightClusters.hpp
+/// @brief A 2D grid of clusters binning the dynamic lights of the visible region
+
+#pragma once
+
+#include "game/egoboo.h"
+
+namespace Ego {
+namespace Graphics {
+
+/**
+ * @brief
+ *  The dynamic lights overlapping a region binned into a 2D grid of clusters. The lights of all
+ *  clusters are stored contiguously (row major), so the lights of a cluster are a range of one array.
+ * @remark
+ *  The lights of a cluster are in the order in which they were added, so summing them yields the
+ *  same result as summing all lights in that order and skipping the ones which do not overlap.
+ */
+class DynamicLightClusters : public Id::NonCopyable {
+public:
+    /// Side length of a cluster (4 tiles)
+    static constexpr float CLUSTER_SIZE = 512.0f;
+
+    /// A range of light indices
+    class Range {
+    public:
+        Range(const uint32_t *begin, const uint32_t *end) : _begin(begin), _end(end) {}
+        const uint32_t *begin() const { return _begin; }
+        const uint32_t *end() const { return _end; }
+        size_t size() const { return _end - _begin; }
+    private:
+        const uint32_t *_begin;
+        const uint32_t *_end;
+    };
+
+    DynamicLightClusters();
+
+    /**
+     * @brief
+     *  Clear and rebuild the clusters.
+     * @param region
+     *  the region covered by the clusters, points outside belong to the nearest cluster
+     * @param bounds
+     *  the bounds of the lights, light @a i is added to every cluster overlapping <tt>bounds[i]</tt>
+     *  grown by @a margin
+     */
+    void rebuild(const ego_frect_t& region, const std::vector<ego_frect_t>& bounds, float margin);
+
+    /**
+     * @return
+     *  the indices of the lights whose bounds overlap the cluster containing the point, in ascending order
+     */
+    Range get(float x, float y) const;
+
+    /// @return the number of clusters
+    size_t getClusterCount() const { return _clusterOffsets.size() - 1; }
+
+private:
+    int getClusterX(float x) const;
+    int getClusterY(float y) const;
+
+    float _minX, _minY;
+    int _clustersX, _clustersY;
+
+    std::vector<uint32_t> _lights;          ///< Light indices sorted by cluster
+    std::vector<uint32_t> _clusterOffsets;  ///< Start of each cluster in _lights (plus the end)
+};
+
+} // namespace Graphics
+} // namespace Ego
@@ -31,6 +31,7 @@ void EntityList::clear() {
         }
     }
     list.clear();
+    reflectedList.clear();
 }
 
 size_t EntityList::add(::Camera& camera, Object& object) {
@@ -61,10 +62,8 @@ size_t EntityList::add(::Camera& camera, Object& object) {
 size_t EntityList::add(::Camera& camera, Ego::Particle& particle) {
     size_t count = 0;
     if (!test(camera, particle)) {
-        particle.inst.indolist = false;
         return count;
     }
-    particle.inst.indolist = true;
 
     list.emplace_back(ObjectRef::Invalid, particle.getParticleID());
     set.emplace((void *)(&particle));
@@ -73,59 +72,67 @@ size_t EntityList::add(::Camera& camera, Ego::Particle& particle) {
     return count;
 }
 
-void EntityList::sort(Camera& cam, const bool do_reflect) {
+void EntityList::commit() {
+    for (const std::shared_ptr<Ego::Particle>& particle : ParticleHandler::get().iterator()) {
+        particle->inst.indolist = set.find((void *)particle.get()) != set.cend();
+    }
+}
+
+void EntityList::sort(::Camera& cam) {
+    assert(list.size() <= CAPACITY);
+    reflectedList = list;
+    sort(cam, true, reflectedList);
+    sort(cam, false, list);
+}
+
+void EntityList::sort(const ::Camera& cam, const bool do_reflect, std::vector<Element>& elements) {
     /// @author ZZ
     /// @details This function orders the entity list based on distance from camera,
     ///    which is needed for reflections to properly clip themselves.
     ///    Order from closest to farthest
-    assert(list.size() <= CAPACITY);
 
     Vector3f vcam;
     mat_getCamForward(cam.getViewMatrix(), vcam);
 
-    // Figure the distance of each.
+    // Figure the distance of each. The render instances (matrices, billboards) are only updated
+    // after the entity lists are made, so the positions are taken from the entities themselves.
     size_t count = 0;
-    for (size_t i = 0; i < list.size(); ++i) {
-        Vector3f vtmp;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        Vector3f pos_tmp;
 
-        if (ParticleRef::Invalid == list[i].iprt && ObjectRef::Invalid != list[i].iobj) {
-            Vector3f pos_tmp;
-
-            ObjectRef iobj = list[i].iobj;
+        if (ParticleRef::Invalid == elements[i].iprt && ObjectRef::Invalid != elements[i].iobj) {
+            const Object *pobj = _currentModule->getObjectHandler().get(elements[i].iobj);
 
+            pos_tmp = pobj->getPosition();
             if (do_reflect) {
-                pos_tmp = mat_getTranslate(_currentModule->getObjectHandler().get(iobj)->inst.getReflectionMatrix());
-            } else {
-                pos_tmp = mat_getTranslate(_currentModule->getObjectHandler().get(iobj)->inst.getMatrix());
+                pos_tmp[kZ] = 2.0f * pobj->getFloorElevation() - pos_tmp[kZ];
             }
+        } else if (ObjectRef::Invalid == elements[i].iobj && elements[i].iprt != ParticleRef::Invalid) {
+            const std::shared_ptr<Ego::Particle> &pprt = ParticleHandler::get()[elements[i].iprt];
 
-            vtmp = pos_tmp - cam.getPosition();
-        } else if (ObjectRef::Invalid == list[i].iobj && list[i].iprt != ParticleRef::Invalid) {
-            ParticleRef iprt = list[i].iprt;
-
+            pos_tmp = pprt->getPosition();
             if (do_reflect) {
-                vtmp = ParticleHandler::get()[iprt]->inst.pos - cam.getPosition();
-            } else {
-                vtmp = ParticleHandler::get()[iprt]->inst.ref_pos - cam.getPosition();
+                pos_tmp[kZ] = 2.0f * pprt->enviro.floor_level - pos_tmp[kZ];
             }
         } else {
             continue;
         }
+        const Vector3f vtmp = pos_tmp - cam.getPosition();
 
         // If theangle between this vector and the camera vector is greater than 90 degrees,
         // then set the distance to positive infinity.
         float dist = vtmp.dot(vcam);
         if (dist > 0) {
-            list[count].iobj = list[i].iobj;
-            list[count].iprt = list[i].iprt;
-            list[count].dist = dist;
+            elements[count].iobj = elements[i].iobj;
+            elements[count].iprt = elements[i].iprt;
+            elements[count].dist = dist;
             count++;
         }
     }
 
     // use qsort to sort the list in-place
     if (count > 1) {
-        std::sort(list.begin(), list.end(), Compare());
+        std::sort(elements.begin(), elements.end(), Compare());
     }
 }
 
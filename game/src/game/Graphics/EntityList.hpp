@@ -65,6 +65,8 @@ struct EntityList {
 private:
     /** An array of the entities in this entity list. */
     std::vector<Element> list;
+    /** The entities of this entity list in the order for rendering their reflections, see sort(). */
+    std::vector<Element> reflectedList;
     /** For checking in amortized constant time if an object is already in this entity list. */
     std::unordered_set<void *> set;
 
@@ -82,6 +84,12 @@ private:
      */
     bool test(::Camera& camera, const Ego::Particle& particle);
 
+    /**
+     * @brief Sort the specified elements by distance from the camera, closest first.
+     * @param reflect if the distances of the reflections of the entities are used
+     */
+    static void sort(const ::Camera& camera, const bool reflect, std::vector<Element>& elements);
+
 public:
     EntityList();
 
@@ -103,9 +111,28 @@ public:
         return list.size();
     }
 
+    /** @brief Get an entity in the order for rendering the reflections of the entities. */
+    const Element& getReflected(size_t index) const {
+        if (index >= reflectedList.size()) {
+            throw std::out_of_range("index out of range");
+        }
+        return reflectedList[index];
+    }
+
+    size_t getReflectedSize() const {
+        return reflectedList.size();
+    }
+
     /** @brief Clear this entity list. */
     void clear();
-    void sort(Camera& camera, const bool reflect);
+
+    /**
+     * @brief Sort this entity list by distance from the camera, once for rendering the entities
+     * (get()) and once for rendering their reflections (getReflected()).
+     * @remark Only reads the positions of the entities, not their render instances, so that the
+     * entity lists of several cameras can be sorted concurrently.
+     */
+    void sort(::Camera& camera);
 
     /**
      * @brief Add an object entity if it is eligible for addition.
@@ -121,11 +148,16 @@ public:
      * @brief Add a particle entity if it is eligible for addition.
      * @param obj the particle entity to add
      * @return the total number of entities added
-     * @remark A (legacy) occlusion test is performed. If the particle is occluded,
-     * then particle.getInstance().isOccluded() is set to @a true, otherwise it is
-     * set to @a false.
+     * @remark Only reads the particle, so that the entity lists of several cameras
+     * can be filled concurrently. Call commit() to flag the particles as listed.
      */
     size_t add(::Camera& camera, Ego::Particle& particle);
+
+    /**
+     * @brief Set particle.inst.indolist of all particles to whether they are in this entity list.
+     * @remark Must not be called concurrently with another entity list being filled or committed.
+     */
+    void commit();
 };
 
 } // namespace Graphics
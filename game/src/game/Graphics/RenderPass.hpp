@@ -57,7 +57,7 @@ public:
 	 *	Intentionally protected.
 	 */
 	RenderPass(const std::string& name)
-		: _clock(name, 512) {
+		: _clock(name, 512, true) {
 	}
 	/**
 	 * @brief
@@ -104,7 +104,8 @@ void TileListV2::render(const ego_mesh_t& mesh, const Graphics::renderlist_lst_t
 	}
 
 	// insert the rlst values into lst_vals
-	std::vector<ElementV2> lst_vals(rlst.size);
+	auto lst_vals = Ego::Core::makeFrameVector<ElementV2>(Ego::Core::FrameArena::render());
+	lst_vals.resize(rlst.size);
 	for (size_t i = 0; i < rlst.size; ++i)
 	{
         uint32_t textureIndex;
@@ -1135,16 +1136,19 @@ void EntityReflections::doRun(::Camera& camera, const TileList& tl, const Entity
 		// surfaces must be closer to the camera to be drawn
 		renderer.setDepthFunction(CompareFunction::LessOrEqual);
 
-		for (size_t j = el.getSize(); j > 0; --j)
+		for (size_t j = el.getReflectedSize(); j > 0; --j)
 		{
 			size_t i = j - 1;
-			if (ParticleRef::Invalid == el.get(i).iprt && ObjectRef::Invalid != el.get(i).iobj)
+			if (ParticleRef::Invalid == el.getReflected(i).iprt && ObjectRef::Invalid != el.getReflected(i).iobj)
 			{
-				const std::shared_ptr<Object> &object = _currentModule->getObjectHandler()[el.get(i).iobj];
+				const std::shared_ptr<Object> &object = _currentModule->getObjectHandler()[el.getReflected(i).iobj];
 				if(!object || object->isTerminated()) {
 					continue;
 				}
 
+				// draw the particle reflections behind the object first
+				ParticleBatch::get().flush();
+
 				// cull backward facing polygons
 				// use couter-clockwise orientation to determine backfaces
 				oglx_begin_culling(CullingMode::Back, MAP_REF_CULL);
@@ -1163,17 +1167,10 @@ void EntityReflections::doRun(::Camera& camera, const TileList& tl, const Entity
 					MadRenderer::render_ref(camera, object);
 				}
 			}
-			else if (ObjectRef::Invalid == el.get(i).iobj && ParticleRef::Invalid != el.get(i).iprt)
+			else if (ObjectRef::Invalid == el.getReflected(i).iobj && ParticleRef::Invalid != el.getReflected(i).iprt)
 			{
-				// draw draw front and back faces of polygons
-				renderer.setCullingMode(CullingMode::None);
-
-				// render_one_prt_ref() actually sets its own blend function, but just to be safe
-				// allow transparent objects
-				renderer.setBlendingEnabled(true);
-				// set the default particle blending
-				renderer.setBlendFunction(BlendFunction::SourceAlpha, BlendFunction::OneMinusSourceAlpha);
-				ParticleRef iprt = el.get(i).iprt;
+				// render_one_prt_ref() only adds the particle to the batch, which sets its render state when flushed
+				ParticleRef iprt = el.getReflected(i).iprt;
 				Index1D itile = ParticleHandler::get()[iprt]->getTile();
 
 				if (mesh->grid_is_valid(itile) && (0 != mesh->test_fx(itile, MAPFX_REFLECTIVE)))
@@ -1183,6 +1180,7 @@ void EntityReflections::doRun(::Camera& camera, const TileList& tl, const Entity
 				}
 			}
 		}
+		ParticleBatch::get().flush();
 	}
 }
 
@@ -1215,6 +1213,8 @@ void SolidEntities::doRun(::Camera& camera, const TileList& tl, const EntityList
 				render_one_prt_solid(el.get(i).iprt);
 			}
 		}
+		// The solid parts of the particles are opaque, so their order relative to the objects does not matter.
+		ParticleBatch::get().flush();
 	}
 }
 
@@ -1239,6 +1239,8 @@ void TransparentEntities::doRun(::Camera& camera, const TileList& tl, const Enti
 			// A character.
 			if (ParticleRef::Invalid == el.get(j).iprt && ObjectRef::Invalid != el.get(j).iobj)
 			{
+				// draw the particles behind the object first
+				ParticleBatch::get().flush();
 				MadRenderer::render_trans(camera, _currentModule->getObjectHandler()[el.get(j).iobj]);
 			}
 			// A particle.
@@ -1247,6 +1249,7 @@ void TransparentEntities::doRun(::Camera& camera, const TileList& tl, const Enti
 				render_one_prt_trans(el.get(j).iprt);
 			}
 		}
+		ParticleBatch::get().flush();
 	}
 }
 
@@ -51,7 +51,8 @@ TileList::TileList() :
 	_water(),
 
 	_renderTiles(),
-	_lastRenderTiles()
+	_lastRenderTiles(),
+	_newTiles()
 {}
 
 TileList::~TileList()
@@ -73,6 +74,7 @@ gfx_rv TileList::reset()
 	// Clear out the "in render list" flag for the old mesh.
 	_lastRenderTiles = _renderTiles;
 	_renderTiles.reset();
+	_newTiles.clear();
 
 	// Re-initialize the renderlist.
 	init();
@@ -141,9 +143,7 @@ gfx_rv TileList::add(const Index1D& index, ::Camera& camera)
 
 	// if the tile was not in the renderlist last frame, then we need to force a lighting update of this tile
 	if(!_lastRenderTiles[index.i()]) {
-		ego_tile_info_t& tile = getMesh()->_tmem.get(index);
-		tile._lightingCache.setNeedUpdate(true);
-		tile._lightingCache.setLastFrame(-1);
+		_newTiles.push_back(index);
 	}
 
 	if (gfx_error == insert(index, camera))
@@ -154,6 +154,16 @@ gfx_rv TileList::add(const Index1D& index, ::Camera& camera)
 	return gfx_success;
 }
 
+void TileList::commit()
+{
+	for (const Index1D& index : _newTiles) {
+		ego_tile_info_t& tile = getMesh()->_tmem.get(index);
+		tile._lightingCache.setNeedUpdate(true);
+		tile._lightingCache.setLastFrame(-1);
+	}
+	_newTiles.clear();
+}
+
 bool TileList::inRenderList(const Index1D& index) const
 {
 	if(index == Index1D::Invalid) return false;
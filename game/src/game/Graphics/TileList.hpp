@@ -127,8 +127,14 @@ struct TileList
 	/// @brief Insert a tile into this render list.
 	/// @param the index of the tile to insert
 	/// @param camera the camera
+	/// @remark Only reads the mesh, so that the tile lists of several cameras can be filled concurrently.
+	///         Call commit() to apply the changes to the mesh.
 	gfx_rv add(const Index1D& index, ::Camera& camera);
 
+	/// @brief Force a lighting update of the tiles which were added but not in the render list last frame.
+	/// @remark Must not be called concurrently with another tile list being filled or committed.
+	void commit();
+
 	/**
 	* @brief
 	*	check wheter a tile was rendered this render frame
@@ -142,6 +148,7 @@ struct TileList
 private:
 	std::bitset<MAP_TILE_MAX> _renderTiles;		//index of all tiles to be rendered
 	std::bitset<MAP_TILE_MAX> _lastRenderTiles; //index of all tiles that were rendered last frame
+	std::vector<Index1D> _newTiles;				//tiles added which were not rendered last frame
 };
 
 }
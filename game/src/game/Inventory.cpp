@@ -324,6 +324,20 @@ std::vector<std::shared_ptr<Object>> Inventory::iterate() const
     return result;
 }
 
+Ego::Core::FrameVector<std::shared_ptr<Object>> Inventory::iterate(Ego::Core::FrameArena &arena) const
+{
+    auto result = Ego::Core::makeFrameVector<std::shared_ptr<Object>>(arena);
+    result.reserve(_items.size());
+    for(const std::weak_ptr<Object> &weak : _items)
+    {
+        std::shared_ptr<Object> item = weak.lock();
+        if(item && !item->isTerminated()) {
+            result.push_back(item);
+        }
+    }
+    return result;
+}
+
 size_t Inventory::getFirstFreeSlotNumber() const
 {
     for(size_t i = 0; i < _items.size(); ++i)
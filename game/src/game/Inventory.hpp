@@ -132,6 +132,12 @@ public:
     **/
     std::vector<std::shared_ptr<Object>> iterate() const;
 
+    /**
+    * @brief
+    *   Same as iterate() above, but the vector is allocated from a frame arena
+    **/
+    Ego::Core::FrameVector<std::shared_ptr<Object>> iterate(Ego::Core::FrameArena &arena) const;
+
     /*
      * @brief
      *  Remove an item from this inventory.
@@ -0,0 +1,130 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Logic/AIScheduler.cpp
+/// @details Decides how often the AI script of an object runs
+
+#include "game/Logic/AIScheduler.hpp"
+#include "game/Logic/Player.hpp"
+#include "game/Graphics/CameraSystem.hpp"
+#include "game/Core/InputRecording.hpp"
+#include "game/Entities/_Include.hpp"
+#include "game/game.h"
+
+namespace Ego
+{
+
+constexpr float AIScheduler::NEAR_DISTANCE;
+constexpr float AIScheduler::FAR_DISTANCE;
+constexpr uint32_t AIScheduler::MID_INTERVAL;
+constexpr uint32_t AIScheduler::FAR_INTERVAL;
+
+AIScheduler::AIScheduler() :
+    _focusPoints(),
+    _statistics(),
+    _lastStatistics()
+{
+    //ctor
+}
+
+void AIScheduler::beginUpdate()
+{
+    _statistics = Statistics();
+
+    _focusPoints.clear();
+    for(const std::shared_ptr<Player> &player : _currentModule->getPlayerList()) {
+        const std::shared_ptr<Object> object = player->getObject();
+        if(object && !object->isTerminated()) {
+            _focusPoints.push_back(object->getPosition());
+        }
+    }
+    // The cameras are not recorded (see InputRecording::isActive())
+    if(CameraSystem::get().isInitialized() && !InputRecording::isActive()) {
+        for(const std::shared_ptr<Camera> &camera : CameraSystem::get().getCameraList()) {
+            _focusPoints.push_back(camera->getCenter());
+        }
+    }
+}
+
+void AIScheduler::endUpdate()
+{
+    _lastStatistics = _statistics;
+}
+
+bool AIScheduler::isWokenUp(const Object &object)
+{
+    // Pending events
+    if(EMPTY_BIT_FIELD != object.ai.alert || object.ai.changed) {
+        return true;
+    }
+
+    // The AI timer was running when the script last ran and has run out since (see IfTimeOut)
+    return object.ai.timer >= object.ai.runlast_time && update_wld > object.ai.timer;
+}
+
+bool AIScheduler::isInCombat(const Object &object)
+{
+    if(object.ai.getTarget() == object.getObjRef()) {
+        return false;
+    }
+    const std::shared_ptr<Object> &target = _currentModule->getObjectHandler()[object.ai.getTarget()];
+    return target && !target->isTerminated() && target->isAlive() && object.getTeam().hatesTeam(target->getTeam());
+}
+
+uint32_t AIScheduler::getThinkInterval(const Object &object) const
+{
+    if(object.isPlayer() || _focusPoints.empty() || isInCombat(object)) {
+        return 1;
+    }
+
+    float distance2 = std::numeric_limits<float>::max();
+    for(const Vector3f &point : _focusPoints) {
+        distance2 = std::min(distance2, (object.getPosition() - point).length_2());
+    }
+
+    if(distance2 < NEAR_DISTANCE * NEAR_DISTANCE) {
+        return 1;
+    }
+    if(distance2 < FAR_DISTANCE * FAR_DISTANCE) {
+        return MID_INTERVAL;
+    }
+    return FAR_INTERVAL;
+}
+
+bool AIScheduler::isDue(const Object &object)
+{
+    const uint32_t interval = getThinkInterval(object);
+
+    // Spread the objects with the same interval over the updates, but never wait longer than the interval
+    if(1 == interval || 0 == (update_wld + object.getObjRef().get()) % interval || update_wld - object.ai.runlast_time >= interval) {
+        _statistics.scriptsRun++;
+        return true;
+    }
+
+    if(isWokenUp(object)) {
+        _statistics.scriptsRun++;
+        _statistics.scriptsWoken++;
+        return true;
+    }
+
+    _statistics.scriptsSkipped++;
+    return false;
+}
+
+} //Ego
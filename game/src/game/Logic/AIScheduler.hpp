@@ -0,0 +1,102 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+/// @file game/Logic/AIScheduler.hpp
+/// @details Decides how often the AI script of an object runs
+
+#pragma once
+
+#include "IdLib/IdLib.hpp"
+#include "egolib/egolib.h"
+
+//Forward declarations
+class Object;
+
+namespace Ego
+{
+
+/**
+* @brief
+*   Lowers the rate at which the AI scripts of objects far away from every player and camera run.
+*   Objects near a player or a camera, objects in combat and the players themselves think every update.
+* @remark
+*   An object whose script is skipped is woken up at once by any event: a pending alert (hit, bumped,
+*   called for help, ordered, at waypoint and so on), a changed state or an AI timer which has run out
+*   since the script last ran. The alerts of skipped updates accumulate and the AI timers are absolute
+*   update counts, so IfTimeOut and the alert conditions still hold when the script eventually runs.
+**/
+class AIScheduler : public Id::NonCopyable
+{
+public:
+    static constexpr float NEAR_DISTANCE = 1280.0f;  ///< 10 tiles, think every update within this distance
+    static constexpr float FAR_DISTANCE = 3840.0f;   ///< 30 tiles, think every FAR_INTERVAL updates beyond
+    static constexpr uint32_t MID_INTERVAL = 4;      ///< Updates between thinks between both distances
+    static constexpr uint32_t FAR_INTERVAL = 16;     ///< Updates between thinks beyond FAR_DISTANCE
+
+    struct Statistics
+    {
+        size_t scriptsRun;      ///< Scripts run in the last update
+        size_t scriptsSkipped;  ///< Scripts skipped in the last update
+        size_t scriptsWoken;    ///< Scripts run ahead of their schedule because of an event
+    };
+
+    AIScheduler();
+
+    /**
+    * @brief
+    *   Start scheduling the scripts of an update. Collects the positions of the players and the cameras.
+    **/
+    void beginUpdate();
+
+    /**
+    * @brief
+    *   Finish scheduling the scripts of an update and publish its statistics
+    **/
+    void endUpdate();
+
+    /**
+    * @brief
+    *   Decide if the script of an object is to run in this update and count the decision
+    * @remark
+    *   The alerts of the object must have been polled (set_alerts()) before.
+    **/
+    bool isDue(const Object &object);
+
+    /**
+    * @return
+    *   The number of updates between thinks of an object if no event wakes it
+    **/
+    uint32_t getThinkInterval(const Object &object) const;
+
+    /**
+    * @return
+    *   The statistics of the last update
+    **/
+    const Statistics& getStatistics() const { return _lastStatistics; }
+
+private:
+    static bool isWokenUp(const Object &object);
+    static bool isInCombat(const Object &object);
+
+    std::vector<Vector3f> _focusPoints;     ///< Positions of the players and the camera centers
+    Statistics _statistics;
+    Statistics _lastStatistics;
+};
+
+} //Ego
@@ -64,52 +64,77 @@ Ego::QuestLog& Player::getQuestLog()
     return _questLog;
 }
 
-void Player::updateLatches()
+PlayerInput::PlayerInput() :
+    buttons(),
+    joystick(Vector2f::zero()),
+    movement(Vector2f::zero()),
+    respawn(false)
 {
+    //ctor
+}
+
+PlayerInput Player::readInput() const
+{
+    PlayerInput input;
+    input.respawn = Ego::Input::InputSystem::get().isKeyDown(SDLK_SPACE);
+
     //Ensure this player is controlling a valid object
     std::shared_ptr<Object> object = getObject();
     if(!object || object->isTerminated()) {
-        return;
+        return input;
     }
-    object->resetInputCommands();
 
     // find the camera that is following this character
     const auto &pcam = CameraSystem::get().getCamera(object->getObjRef());
     if (!pcam) {
-        return;
+        return input;
+    }
+
+    for(size_t i = 0; i < input.buttons.size(); ++i) {
+        input.buttons[i] = getInputDevice().isButtonPressed(static_cast<Ego::Input::InputDevice::InputButton>(i));
     }
 
     // fast camera turn if it is enabled and there is only 1 local player
     bool fast_camera_turn = ( 1 == local_stats.player_count ) && ( CameraTurnMode::Good == pcam->getTurnMode() );
 
-    // Clear the player's latch buffers
-    Vector2f movementInput = Vector2f::zero();
-    Vector2f joy_pos = Vector2f::zero();
-
     // generate the transforms relative to the camera
     // this needs to be changed for multicamera
     float fsin = std::sin(pcam->getOrientation().facing_z);
     float fcos = std::cos(pcam->getOrientation().facing_z);
 
-    if(fast_camera_turn || !getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::CAMERA_CONTROL))
+    if(fast_camera_turn || !input.isButtonPressed(Ego::Input::InputDevice::InputButton::CAMERA_CONTROL))
     {
-        joy_pos = getInputDevice().getInputMovement();
+        input.joystick = getInputDevice().getInputMovement();
 
         //Rotate movement input from body frame to earth frame
-        movementInput.x() = ( joy_pos[XX] * fcos + joy_pos[YY] * fsin );
-        movementInput.y() = ( -joy_pos[XX] * fsin + joy_pos[YY] * fcos );
+        input.movement.x() = ( input.joystick[XX] * fcos + input.joystick[YY] * fsin );
+        input.movement.y() = ( -input.joystick[XX] * fsin + input.joystick[YY] * fcos );
     }
 
+    return input;
+}
+
+void Player::updateLatches(const PlayerInput &input)
+{
+    //Ensure this player is controlling a valid object
+    std::shared_ptr<Object> object = getObject();
+    if(!object || object->isTerminated()) {
+        return;
+    }
+    object->resetInputCommands();
+
+    Vector2f joy_pos = input.joystick;
+
     // Read control buttons
     if (!_inventoryMode)
     {
         // Now update movement and input
-        object->setLatchButton(LATCHBUTTON_JUMP, getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::JUMP));
-        object->setLatchButton(LATCHBUTTON_LEFT, getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::USE_LEFT));
-        object->setLatchButton(LATCHBUTTON_RIGHT, getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::USE_RIGHT));
-        object->setLatchButton(LATCHBUTTON_ALTLEFT, getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_LEFT));
-        object->setLatchButton(LATCHBUTTON_ALTRIGHT, getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_RIGHT));
-        object->getObjectPhysics().setDesiredVelocity(movementInput);
+        object->setLatchButton(LATCHBUTTON_JUMP, input.isButtonPressed(Ego::Input::InputDevice::InputButton::JUMP));
+        object->setLatchButton(LATCHBUTTON_LEFT, input.isButtonPressed(Ego::Input::InputDevice::InputButton::USE_LEFT));
+        object->setLatchButton(LATCHBUTTON_RIGHT, input.isButtonPressed(Ego::Input::InputDevice::InputButton::USE_RIGHT));
+        object->setLatchButton(LATCHBUTTON_ALTLEFT, input.isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_LEFT));
+        object->setLatchButton(LATCHBUTTON_ALTRIGHT, input.isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_RIGHT));
+        object->getObjectPhysics().setDesiredVelocity(input.movement);
     }
 
     //inventory mode
@@ -149,7 +174,7 @@ void Player::updateLatches()
         if ( object->inst.canBeInterrupted() && 0 == object->reload_timer )
         {
             //handle LEFT hand control
-            if (getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::USE_LEFT) || getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_LEFT))
+            if (input.isButtonPressed(Ego::Input::InputDevice::InputButton::USE_LEFT) || input.isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_LEFT))
             {
                 //put it away and swap with any existing item
                 Inventory::swap_item(object->getObjRef(), _inventorySlot, SLOT_LEFT, false);
@@ -160,7 +185,7 @@ void Player::updateLatches()
             }
 
             //handle RIGHT hand control
-            if (getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::USE_RIGHT) || getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_RIGHT))
+            if (input.isButtonPressed(Ego::Input::InputDevice::InputButton::USE_RIGHT) || input.isButtonPressed(Ego::Input::InputDevice::InputButton::GRAB_RIGHT))
             {
                 // put it away and swap with any existing item
                 Inventory::swap_item(object->getObjRef(), _inventorySlot, SLOT_RIGHT, false);
@@ -173,7 +198,7 @@ void Player::updateLatches()
     }
 
     //enable inventory mode?
-    if ( update_wld > _inventoryCooldown && getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::INVENTORY) )
+    if ( update_wld > _inventoryCooldown && input.isButtonPressed(Ego::Input::InputDevice::InputButton::INVENTORY) )
     {
         for(uint8_t ipla = 0; ipla < _currentModule->getPlayerList().size(); ++ipla) {
             if(_currentModule->getPlayer(ipla).get() == this) {
@@ -185,7 +210,7 @@ void Player::updateLatches()
     }
 
     //Enter or exit stealth mode?
-    if(getInputDevice().isButtonPressed(Ego::Input::InputDevice::InputButton::STEALTH) && update_wld > _inventoryCooldown) {
+    if(input.isButtonPressed(Ego::Input::InputDevice::InputButton::STEALTH) && update_wld > _inventoryCooldown) {
         if(!object->isStealthed()) {
             object->activateStealth();
         }
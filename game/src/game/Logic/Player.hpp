@@ -33,6 +33,24 @@ class Object;
 namespace Ego
 {
 
+/// The input of a player during one update
+struct PlayerInput
+{
+    using Buttons = std::bitset<static_cast<size_t>(Ego::Input::InputDevice::InputButton::COUNT)>;
+
+    PlayerInput();
+
+    bool isButtonPressed(const Ego::Input::InputDevice::InputButton button) const
+    {
+        return buttons[static_cast<size_t>(button)];
+    }
+
+    Buttons buttons;    ///< The pressed buttons of the input device
+    Vector2f joystick;  ///< The movement input of the input device
+    Vector2f movement;  ///< The movement input relative to the camera following the player
+    bool respawn;       ///< True if the respawn key is down
+};
+
 /// The state of a player
 class Player
 {
@@ -61,9 +79,19 @@ public:
 
     /**
     * @brief
-    *   Polls the input device and sets movement and action latches accordingly
+    *   Polls the input device of this Player
+    * @return
+    *   the input of this Player for the current update
+    **/
+    PlayerInput readInput() const;
+
+    /**
+    * @brief
+    *   Sets movement and action latches according to the input of this Player
+    * @param input
+    *   the input read by readInput() or replayed from an InputRecording
     **/
-    void updateLatches();
+    void updateLatches(const PlayerInput &input);
 
     /**
     * @brief
@@ -39,7 +39,9 @@ std::unique_ptr<GameModule> _currentModule = nullptr;
 
 GameModule::GameModule(const std::shared_ptr<ModuleProfile> &profile, const uint32_t seed) :
     _moduleProfile(profile),
+    _enchantments(),
     _gameObjects(),
+    _aiScheduler(),
     _playerNameList(),
     _playerList(),    
     _teamList(),
@@ -409,7 +411,7 @@ std::shared_ptr<Object> GameModule::spawnObject(const Vector3f& pos, const PRO_R
         case GenderProfile::Random:
             /// 50% male or female.
             /// @todo And what about Neuter?
-            if (Random::nextBool()) {
+            if (pchr->getRandomStream().nextBool()) {
                 pchr->gender = Gender::Female;
             } else {
                 pchr->gender = Gender::Male;
@@ -452,7 +454,7 @@ std::shared_ptr<Object> GameModule::spawnObject(const Vector3f& pos, const PRO_R
     pchr->giveMoney(ppro->getStartingMoney());
 
     // Experience
-    pchr->experience = Random::next( ppro->getStartingExperience() );
+    pchr->experience = pchr->getRandomStream().next( ppro->getStartingExperience() );
     pchr->experiencelevel = ppro->getStartingLevel();
 
     // Particle attachments
@@ -489,7 +491,7 @@ std::shared_ptr<Object> GameModule::spawnObject(const Vector3f& pos, const PRO_R
         {
             kursechance *= 0.5f;  // Easy mode halves chance for Kurses
         }
-        pchr->iskursed = Random::getPercent() <= kursechance;
+        pchr->iskursed = pchr->getRandomStream().getPercent() <= kursechance;
     }
 
     //Set our position
@@ -621,6 +623,9 @@ std::shared_ptr<const Ego::Texture> GameModule::getWaterTexture(const uint8_t la
 
 void GameModule::updateAllObjects()
 {
+    //Update all active enchantments in one pass
+    _enchantments.update();
+
    for(const std::shared_ptr<Object> &object : getObjectHandler().iterator())
     {
         //Skip terminated objects
@@ -775,8 +780,19 @@ void GameModule::enablePitsKill()
 
 void GameModule::updateDamageTiles()
 {
+    // only the objects on damage tiles are candidates
+    std::vector<ObjectRef> candidates;
+    _gameObjects.getTileOccupancy().find([this](int x, int y) {
+        const Index1D tile = _mesh->getTileIndex(Index2D(x, y));
+        return _mesh->grid_is_valid(tile) && 0 != _mesh->test_fx(tile, MAPFX_DAMAGE);
+    }, candidates);
+
     // do the damage tile stuff
-    for(const std::shared_ptr<Object> &pchr : _gameObjects.iterator()) {
+    for(ObjectRef ref : candidates) {
+        // a copy, damage might remove the object from the object handler
+        const std::shared_ptr<Object> pchr = _gameObjects[ref];
+        if (!pchr || pchr->isTerminated()) continue;
+
         // if the object is not really in the game, do nothing
         if (pchr->isHidden() || !pchr->isAlive()) continue;
 
@@ -27,14 +27,17 @@
 #include "game/Module/Water.hpp"
 #include "game/Module/module_spawn.h"
 #include "game/Module/damagetile_instance.h"
+#include "game/Logic/AIScheduler.hpp"
 
 //@todo This is an ugly hack to work around cyclic dependency and private header guards
 #ifndef GAME_ENTITIES_PRIVATE
     #define GAME_ENTITIES_PRIVATE 1
     #include "game/Entities/ObjectHandler.hpp"
+    #include "game/Entities/EnchantHandler.hpp"
     #undef GAME_ENTITIES_PRIVATE
 #else
     #include "game/Entities/ObjectHandler.hpp"
+    #include "game/Entities/EnchantHandler.hpp"
 #endif
 
 // Forward declarations.
@@ -108,6 +111,24 @@ public:
 
     void setRespawnValid(bool valid) {_isRespawnValid = valid;}
 
+    /// The kinds of entities with random streams of their own.
+    enum class RandomStreamDomain : uint64_t {
+        Object = 1,
+        Particle = 2,
+    };
+
+    /**
+     * @brief
+     *  Get the random stream of an entity, derived from the module seed.
+     * @param domain
+     *  the kind of the entity
+     * @param id
+     *  the identifier of the entity, unique within its domain e.g. an object reference
+     */
+    RandomStream getRandomStream(RandomStreamDomain domain, uint64_t id) const {
+        return RandomStream(_seed).derive(static_cast<uint64_t>(domain)).derive(id);
+    }
+
     /// @author ZF
     /// @details This function checks all passages if there is a player in it, if it is, it plays a specified
     /// song set in by the AI script functions
@@ -164,6 +185,18 @@ public:
     **/
     ObjectHandler& getObjectHandler() {return _gameObjects;}
 
+    /**
+    * @return
+    *   Get the active enchantments of this Module instance
+    **/
+    EnchantHandler& getEnchantHandler() {return _enchantments;}
+
+    /**
+    * @return
+    *   Get the scheduler deciding which AI scripts run in an update
+    **/
+    Ego::AIScheduler& getAIScheduler() {return _aiScheduler;}
+
     /**
     * @return
     *   true if the specified position is inside the level
@@ -282,7 +315,9 @@ private:
     const std::shared_ptr<ModuleProfile> _moduleProfile;
     std::vector<std::shared_ptr<Passage>> _passages;    ///< All passages in this module
     std::vector<Team> _teamList;
+    EnchantHandler _enchantments;               ///< Destroyed after the objects, so the enchantments no longer affect them
     ObjectHandler _gameObjects;
+    Ego::AIScheduler _aiScheduler;
     std::list<std::string> _playerNameList;     ///< List of all import players
     std::vector<std::shared_ptr<Ego::Player>> _playerList;
 
@@ -84,7 +84,7 @@ bool Passage::close()
         std::vector<std::shared_ptr<Object>> crushedCharacters;
 
         // Make sure it isn't blocked
-        for(const std::shared_ptr<Object> &object : _module.getObjectHandler().iterator())
+        for(const std::shared_ptr<Object> &object : getObjectsNearPassage())
         {
             //Scenery can neither be crushed nor prevents doors from closing
             if(object->isScenery()) {
@@ -129,14 +129,31 @@ bool Passage::objectIsInPassage(const std::shared_ptr<Object> &object) const
     return intersects(_area, object->getAxisAlignedBox2D());
 }
 
+std::vector<std::shared_ptr<Object>> Passage::getObjectsNearPassage() const
+{
+    std::vector<ObjectRef> refs;
+    _module.getObjectHandler().getBoundsOccupancy().find(TileOccupancy::Area::ofBox(_area), refs);
+
+    std::vector<std::shared_ptr<Object>> objects;
+    objects.reserve(refs.size());
+    for(ObjectRef ref : refs)
+    {
+        const std::shared_ptr<Object> &object = _module.getObjectHandler()[ref];
+        if(object && !object->isTerminated()) {
+            objects.push_back(object);
+        }
+    }
+    return objects;
+}
+
 ObjectRef Passage::whoIsBlockingPassage( ObjectRef objRef, const IDSZ2& idsz, const BIT_FIELD targeting_bits, const IDSZ2& require_item ) const
 {
     // Skip if the one who is looking doesn't exist
     if ( !_module.getObjectHandler().exists(objRef) ) return ObjectRef::Invalid;
     Object *psrc = _module.getObjectHandler().get(objRef);
 
-    // Look at each character
-    for(const std::shared_ptr<Object> &pchr : _module.getObjectHandler().iterator())
+    // Look at each character near the passage
+    for(const std::shared_ptr<Object> &pchr : getObjectsNearPassage())
     {
         if(pchr->isTerminated()) {
             continue;
@@ -167,7 +184,7 @@ ObjectRef Passage::whoIsBlockingPassage( ObjectRef objRef, const IDSZ2& idsz, co
                 }
                 
                 // II: Check the pack
-                for(const std::shared_ptr<Object> pitem : pchr->getInventory().iterate())
+                for(const std::shared_ptr<Object>& pitem : pchr->getInventory().iterate(Ego::Core::FrameArena::update()))
                 {
                     if ( pitem->getProfile()->hasTypeIDSZ(require_item) )
                     {
@@ -249,7 +266,7 @@ void Passage::makeShop(ObjectRef owner)
     _shopOwner = owner;
 
     // flag every item in the shop as a shop item
-    for(const std::shared_ptr<Object> &object : _module.getObjectHandler().iterator())
+    for(const std::shared_ptr<Object> &object : getObjectsNearPassage())
     {
         if (object->isTerminated()) continue;
 
@@ -128,6 +128,14 @@ public:
     **/
     const AxisAlignedBox2f& getAxisAlignedBox2f() const;
 
+private:
+    /**
+    * @brief
+    *	Get the objects whose bounding box touches a tile of this passage. These are all objects
+    *	which might be inside this passage (see objectIsInPassage()), in ascending order of their references.
+    **/
+    std::vector<std::shared_ptr<Object>> getObjectsNearPassage() const;
+
 private:
     GameModule& _module;			   ///< Reference to the module we are inside
 
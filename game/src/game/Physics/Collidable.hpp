@@ -104,7 +104,11 @@ public:
         _oldPosition = _position;
         _position = pos;
 
-        _tile = _currentModule->getMeshPointer()->getTileIndex(Vector2f(getPosX(), getPosY()));
+        const Index1D tile = _currentModule->getMeshPointer()->getTileIndex(Vector2f(getPosX(), getPosY()));
+        if (tile != _tile) {
+            _tile = tile;
+            onTileChanged();
+        }
 
         //Are we inside a wall now?
         Vector2f nrm;
@@ -206,6 +210,12 @@ public:
 	virtual BIT_FIELD test_wall(const Vector3f& pos) = 0;
 
 protected:
+    /**
+    * @brief
+    *   Called by setPosition() after this entity moved onto another tile
+    **/
+    virtual void onTileChanged() {}
+
     /**
     * @brief
     *  Current position in the world
@@ -258,6 +258,7 @@ void CollisionSystem::update()
 void CollisionSystem::updateObjectCollisions()
 {
     std::unordered_set<std::shared_ptr<Object>> handledObjects;
+    auto possibleCollisions = Ego::Core::makeFrameVector<std::shared_ptr<Object>>(Ego::Core::FrameArena::update());
 
     //Detect character -> character collisions
     for(const std::shared_ptr<Object> &object : _currentModule->getObjectHandler().iterator()) {
@@ -292,7 +293,7 @@ void CollisionSystem::updateObjectCollisions()
         bool canCollideWithScenery = !object->isScenery() || object->canuseplatforms;
 
         // Check collisions to nearby Objects
-        std::vector<std::shared_ptr<Object>> possibleCollisions;
+        possibleCollisions.clear();
         _currentModule->getObjectHandler().findObjects(aabb2d, possibleCollisions, canCollideWithScenery);
         for (const std::shared_ptr<Object> &other : possibleCollisions)
         {
@@ -317,6 +318,8 @@ void CollisionSystem::updateObjectCollisions()
 
 void CollisionSystem::updateParticleCollisions()
 {
+    auto possibleCollisions = Ego::Core::makeFrameVector<std::shared_ptr<Object>>(Ego::Core::FrameArena::update());
+
     //Check collisions with particles
     for(const std::shared_ptr<Ego::Particle> &particle : ParticleHandler::get().iterator())
     {
@@ -336,7 +339,7 @@ void CollisionSystem::updateParticleCollisions()
         const AxisAlignedBox2f aabb2d = AxisAlignedBox2f(Point2f(tmp_oct._mins[OCT_X], tmp_oct._mins[OCT_Y]), Point2f(tmp_oct._maxs[OCT_X], tmp_oct._maxs[OCT_Y]));
 
         //Detect collisions with nearby Objects
-        std::vector<std::shared_ptr<Object>> possibleCollisions;
+        possibleCollisions.clear();
          _currentModule->getObjectHandler().findObjects(aabb2d, possibleCollisions, true);
         for (const std::shared_ptr<Object> &object : possibleCollisions)
         {
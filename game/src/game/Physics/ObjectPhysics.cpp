@@ -670,7 +670,7 @@ bool ObjectPhysics::grabStuff(grip_offset_t grip_off, bool grab_people)
     float bestMatchDistance = std::numeric_limits<float>::max();
 
     // Go through all nearby objects to find the best match
-    std::vector<std::shared_ptr<Object>> nearbyObjects = _currentModule->getObjectHandler().findObjects(slot_pos.x(), slot_pos.y(), MAX_SEARCH_DIST, false);
+    auto nearbyObjects = _currentModule->getObjectHandler().findObjects(slot_pos.x(), slot_pos.y(), MAX_SEARCH_DIST, Ego::Core::FrameArena::update(), false);
     for(const std::shared_ptr<Object> &pchr_c : nearbyObjects)
     {
         //Skip invalid objects
@@ -1018,6 +1018,11 @@ void ObjectPhysics::updateCollisionSize(bool update_matrix)
                                _object.getPosY() + _object.chr_min_cv.getMin()[OCT_Y]),
                                Point2f(_object.getPosX() + _object.chr_min_cv.getMax()[OCT_X],
                                _object.getPosY() + _object.chr_min_cv.getMax()[OCT_Y]));
+
+    //Keep the tiles touched by the box current for passage queries
+    if (!_object.isTerminated()) {
+        _currentModule->getObjectHandler().getBoundsOccupancy().update(_object.getObjRef(), TileOccupancy::Area::ofBox(_aabb2D));
+    }
 }
 
 bool ObjectPhysics::floorIsSlippy() const
@@ -335,13 +335,13 @@ void ParticlePhysics::updateHoming()
     Vector3f vdither;
     int ival;
 
-    ival = Random::next(std::numeric_limits<uint16_t>::max());
+    ival = _particle.getRandomStream().next(std::numeric_limits<uint16_t>::max());
     vdither.x() = (((float)ival / 0x8000) - 1.0f)  * uncertainty;
 
-    ival = Random::next(std::numeric_limits<uint16_t>::max());
+    ival = _particle.getRandomStream().next(std::numeric_limits<uint16_t>::max());
     vdither.y() = (((float)ival / 0x8000) - 1.0f)  * uncertainty;
 
-    ival = Random::next(std::numeric_limits<uint16_t>::max());
+    ival = _particle.getRandomStream().next(std::numeric_limits<uint16_t>::max());
     vdither.z() = (((float)ival / 0x8000) - 1.0f)  * uncertainty;
 
     // take away any dithering along the direction of motion of the particle
@@ -472,7 +472,7 @@ void ParticlePhysics::updateGravity()
         const auto &particleTeam = _currentModule->getTeamList()[_particle.team];
 
         //Pull all nearby objects
-        std::vector<std::shared_ptr<Object>> affectedObjects = _currentModule->getObjectHandler().findObjects(_particle.getPosX(), _particle.getPosY(), pullDistance, false);
+        auto affectedObjects = _currentModule->getObjectHandler().findObjects(_particle.getPosX(), _particle.getPosY(), pullDistance, Ego::Core::FrameArena::update(), false);
         for(const std::shared_ptr<Object> &object : affectedObjects)
         {
             //Do not affect the object we are attached to
@@ -564,7 +564,7 @@ bool do_chr_prt_collision_deflect(chr_prt_collision_data_t& pdata)
                 total_block_rating += 2 * pdata.pchr->getAttribute(Ego::Attribute::MIGHT);
 
                 // Now determine the result of the block
-                if ( Random::getPercent() <= total_block_rating )
+                if ( pdata.pprt->getRandomStream().getPercent() <= total_block_rating )
                 {
                     // Defender won, the block holds
                     // Add a small stun to the attacker = 40/50 (0.8 seconds)
@@ -740,7 +740,7 @@ bool do_chr_prt_collision_damage( chr_prt_collision_data_t& pdata )
 
                     //Disintegrate perk deals +100 ZAP damage at 0.025% chance per Intellect!
                     if(pdata.pprt->damagetype == DAMAGE_ZAP && powner->hasPerk(Ego::Perks::DISINTEGRATE)) {
-                        if(Random::nextFloat()*100.0f <= powner->getAttribute(Ego::Attribute::INTELLECT) * 0.025f) {
+                        if(pdata.pprt->getRandomStream().nextFloat()*100.0f <= powner->getAttribute(Ego::Attribute::INTELLECT) * 0.025f) {
                             modifiedDamage.base += FLOAT_TO_FP8(100.0f);
                             BillboardSystem::get().makeBillboard(pdata.pchr->getObjRef(), "Disintegrated!", Ego::Math::Colour4f::white(), Ego::Math::Colour4f::purple(), 6, Billboard::Flags::All);
 
@@ -789,7 +789,7 @@ bool do_chr_prt_collision_damage( chr_prt_collision_data_t& pdata )
                 if(spawnerProfile != nullptr && powner->hasPerk(Ego::Perks::GRIM_REAPER)) {
 
                     //Is it a Scythe?
-                    if(spawnerProfile->getIDSZ(IDSZ_TYPE).equals('S','C','Y','T') && Random::getPercent() <= 5) {
+                    if(spawnerProfile->getIDSZ(IDSZ_TYPE).equals('S','C','Y','T') && pdata.pprt->getRandomStream().getPercent() <= 5) {
 
                         //Make sure they can be damaged by EVIL first
                         if(pdata.pchr->getAttribute(Ego::Attribute::EVIL_MODIFIER) == NONE) {
@@ -806,7 +806,7 @@ bool do_chr_prt_collision_damage( chr_prt_collision_data_t& pdata )
                 //Deadly Strike perk (1% chance per character level to trigger vs non undead)
                 if(meleeAttack && !pdata.pchr->getProfile()->getIDSZ(IDSZ_PARENT).equals('U','N','D','E'))
                 {
-                    if(powner->hasPerk(Ego::Perks::DEADLY_STRIKE) && powner->getExperienceLevel() >= Random::getPercent() && DamageType_isPhysical(pdata.pprt->damagetype)){
+                    if(powner->hasPerk(Ego::Perks::DEADLY_STRIKE) && powner->getExperienceLevel() >= pdata.pprt->getRandomStream().getPercent() && DamageType_isPhysical(pdata.pprt->damagetype)){
                         //Gain +0.25 damage per Agility
                         modifiedDamage.base += FLOAT_TO_FP8(powner->getAttribute(Ego::Attribute::AGILITY) * 0.25f);
                         BillboardSystem::get().makeBillboard(powner->getObjRef(), "Deadly Strike", Ego::Math::Colour4f::white(), Ego::Math::Colour4f::blue(), 3, Billboard::Flags::All);
@@ -841,7 +841,7 @@ bool do_chr_prt_collision_damage( chr_prt_collision_data_t& pdata )
                     critChance += 10.0f;
                 }
 
-                if(Random::getPercent() <= critChance) {
+                if(pdata.pprt->getRandomStream().getPercent() <= critChance) {
                     modifiedDamage.base += modifiedDamage.rand;
                     modifiedDamage.rand = 0;
                     BillboardSystem::get().makeBillboard(powner->getObjRef(), "Critical Hit!", Ego::Math::Colour4f::white(), Ego::Math::Colour4f::red(), 3, Billboard::Flags::All);
@@ -1048,7 +1048,7 @@ void do_chr_prt_collision_knockback(chr_prt_collision_data_t &pdata)
 
             //+3% chance per owner Intellect and -1% per target Might
             float chance = attacker->getAttribute(Ego::Attribute::INTELLECT) * 0.03f - pdata.pchr->getAttribute(Ego::Attribute::MIGHT)*0.01f;
-            if(Random::nextFloat() <= chance) {
+            if(pdata.pprt->getRandomStream().nextFloat() <= chance) {
                 knockbackFactor += 5.0f;
                 BillboardSystem::get().makeBillboard(attacker->getObjRef(), "Telekinetic Staff!", Ego::Math::Colour4f::white(), Ego::Math::Colour4f::purple(), 2, Billboard::Flags::All);
             }
@@ -1217,7 +1217,7 @@ bool do_chr_prt_collision(const std::shared_ptr<Object> &object, const std::shar
             }
 
             //1% dodge chance per Agility
-            if(Random::getPercent() <= dodgeChance) 
+            if(cn_data.pprt->getRandomStream().getPercent() <= dodgeChance) 
             {
                 dodged = true;
             }
@@ -1348,7 +1348,7 @@ int spawn_bump_particles(ObjectRef character, const ParticleRef particle)
         //check if we resisted the attack, we could resist some of the particles or none
         for (int cnt = 0; cnt < amount; cnt++)
         {
-            if (Random::nextFloat() <= pchr->getDamageReduction(pprt->damagetype)) amount--;
+            if (pprt->getRandomStream().nextFloat() <= pchr->getDamageReduction(pprt->damagetype)) amount--;
         }
 
         if (amount > 0 && !pchr->getProfile()->hasResistBumpSpawn() && !pchr->invictus)
@@ -37,6 +37,7 @@
 #include "game/script_implementation.h"
 #include "game/egoboo.h"
 #include "game/Core/GameEngine.hpp"
+#include "game/Core/InputRecording.hpp"
 #include "game/Module/Passage.hpp"
 #include "game/Graphics/CameraSystem.hpp"
 #include "game/Module/Module.hpp"
@@ -57,6 +58,7 @@ bool  overrideslots      = false;
 EndText g_endText;
 
 WeatherState g_weatherState;
+UpdatePhaseTimings g_updatePhaseTimings;
 fog_instance_t fog;
 AnimatedTilesState g_animatedTilesState;
 
@@ -270,14 +272,74 @@ egolib_rv export_all_players( bool require_local )
     return retval;
 }
 
+//--------------------------------------------------------------------------------------------
+UpdatePhaseTimings::UpdatePhaseTimings() :
+    durations(),
+    updates(0)
+{
+    reset();
+}
+
+void UpdatePhaseTimings::reset()
+{
+    durations.fill(std::chrono::high_resolution_clock::duration::zero());
+    updates = 0;
+}
+
+const char *UpdatePhaseTimings::getName(Phase phase)
+{
+    switch (phase)
+    {
+        case Misc:           return "misc";
+        case AI:             return "ai";
+        case ObjectUpdate:   return "objects";
+        case ParticleUpdate: return "particles";
+        case Movement:       return "movement";
+        case Collisions:     return "collisions";
+        case Camera:         return "camera";
+        default:             return "unknown";
+    }
+}
+
+/// The profiler zones of the phases of update_game().
+static const char *const g_updatePhaseZones[UpdatePhaseTimings::Count] =
+{
+    "update.misc", "update.ai", "update.objects", "update.particles", "update.movement", "update.collisions", "update.camera"
+};
+
+/// Adds the time until its destruction to a phase of g_updatePhaseTimings.
+struct UpdatePhaseScope
+{
+    UpdatePhaseScope(UpdatePhaseTimings::Phase phase) :
+        _phase(phase), _start(std::chrono::high_resolution_clock::now())
+    {
+        EGO_PROFILE_ENTER(g_updatePhaseZones[phase]);
+    }
+
+    ~UpdatePhaseScope()
+    {
+        EGO_PROFILE_LEAVE();
+        g_updatePhaseTimings.durations[_phase] += std::chrono::high_resolution_clock::now() - _start;
+    }
+
+    UpdatePhaseTimings::Phase _phase;
+    std::chrono::high_resolution_clock::time_point _start;
+};
+
 //--------------------------------------------------------------------------------------------
 void update_all_objects()
 {
     chr_stoppedby_tests = 0;
     chr_pressure_tests  = 0;
 
-    _currentModule->updateAllObjects();
-    ParticleHandler::get().updateAllParticles();
+    {
+        UpdatePhaseScope scope(UpdatePhaseTimings::ObjectUpdate);
+        _currentModule->updateAllObjects();
+    }
+    {
+        UpdatePhaseScope scope(UpdatePhaseTimings::ParticleUpdate);
+        ParticleHandler::get().updateAllParticles();
+    }
 }
 
 //--------------------------------------------------------------------------------------------
@@ -379,6 +441,12 @@ int update_game()
     /// @details This function does several iterations of character movements and such
     ///    to keep the game in sync.
 
+    EGO_PROFILE_ZONE("update");
+    Ego::Core::FrameArena::FrameScope frameArena(Ego::Core::FrameArena::update());
+    g_updatePhaseTimings.updates++;
+    const auto miscStart = std::chrono::high_resolution_clock::now();
+    EGO_PROFILE_ENTER(g_updatePhaseZones[UpdatePhaseTimings::Misc]);
+
     //status text for player stats
     check_stats();
 
@@ -388,7 +456,7 @@ int update_game()
     // keep the mpdfx lists up-to-date. No calculation is done unless one
     // of the mpdfx values was changed during the last update
     _currentModule->getMeshPointer()->_fxlists.synch(_currentModule->getMeshPointer()->_tmem, false);
-    
+
     // Get immediate mode state for the rest of the game
     Ego::Input::InputSystem::get().update();
 
@@ -408,22 +476,34 @@ int update_game()
         _currentModule->checkPassageMusic();
     }
     //---- end the code for updating misc. game stuff
+    EGO_PROFILE_LEAVE();
+    g_updatePhaseTimings.durations[UpdatePhaseTimings::Misc] += std::chrono::high_resolution_clock::now() - miscStart;
 
     //---- Run AI (but not on first update frame)
     if(_gameEngine->getCurrentUpdateFrame() > 0)
     {
+        UpdatePhaseScope scope(UpdatePhaseTimings::AI);
         let_all_characters_think();           //sets the non-player latches
         readPlayerInput();                    //sets latches generated by players
     }
 
     //---- begin the code for updating in-game objects
     update_all_objects();
-    move_all_objects();                            //movement
-    Ego::Physics::CollisionSystem::get().update(); //collisions
+    {
+        UpdatePhaseScope scope(UpdatePhaseTimings::Movement);
+        move_all_objects();                            //movement
+    }
+    {
+        UpdatePhaseScope scope(UpdatePhaseTimings::Collisions);
+        Ego::Physics::CollisionSystem::get().update(); //collisions
+    }
     //---- end the code for updating in-game objects
 
     // put the camera movement inside here
-    CameraSystem::get().updateAll(_currentModule->getMeshPointer().get());
+    {
+        UpdatePhaseScope scope(UpdatePhaseTimings::Camera);
+        CameraSystem::get().updateAll(_currentModule->getMeshPointer().get());
+    }
 
     // Timers
     clock_chr_stat++;
@@ -434,6 +514,12 @@ int update_game()
         local_stats.revivetimer--;
     }
 
+    // Record or verify the state at the end of this update
+    if (g_inputRecording)
+    {
+        g_inputRecording->checkState(update_wld);
+    }
+
     update_wld++;
 
     return 1;
@@ -608,7 +694,7 @@ ObjectRef chr_find_target( Object * psrc, float max_dist, const IDSZ2& idsz, con
         for(const std::shared_ptr<Ego::Player> &player : _currentModule->getPlayerList())
         {
             const std::shared_ptr<Object> &object = player->getObject();
-            if(player) {
+            if(object) {
 
                 //Within range?
                 float distance = (object->getPosition() - psrc->getPosition()).length();
@@ -620,26 +706,84 @@ ObjectRef chr_find_target( Object * psrc, float max_dist, const IDSZ2& idsz, con
         }
     }
 
-    //All objects in level
-    else if(max_dist == NEAREST)
-    {
-        searchList = _currentModule->getObjectHandler().getAllObjects();
-    }
-
-    //All objects within range
-    else
-    {
-        searchList = _currentModule->getObjectHandler().findObjects(psrc->getPosX(), psrc->getPosY(), max_dist, true);
-    }
-
-
     // set the line-of-sight source
     los_info.x0         = psrc->getPosX();
     los_info.y0         = psrc->getPosY();
     los_info.z0         = psrc->getPosZ() + psrc->bump.height;
     los_info.stopped_by = psrc->stoppedby;
 
+    auto isVisible = [psrc, &los_info](const std::shared_ptr<Object> &ptst)
+    {
+        //Invictus chars do not need a line of sight
+        if ( psrc->isInvincible() ) return true;
+
+        // set the line-of-sight target
+        los_info.x1 = ptst->getPosition()[kX];
+        los_info.y1 = ptst->getPosition()[kY];
+        los_info.z1 = ptst->getPosition()[kZ] + std::max( 1.0f, ptst->bump.height );
+
+        return !line_of_sight_info_t::blocked( los_info, _currentModule->getMeshPointer() );
+    };
+
     ObjectRef best_target = ObjectRef::Invalid;
+
+    auto isCandidate = [psrc, &idsz, targeting_bits](const std::shared_ptr<Object> &ptst)
+    {
+        //Skip held items and objects removed from the world
+        if ( ptst->isTerminated() || ptst->isHidden() || ptst->isBeingHeld() ) return false;
+        return chr_check_target(psrc, ptst, idsz, targeting_bits);
+    };
+
+    //Search all objects in the level for the nearest one we can actually see. The team index is only
+    //rebuilt once per update, so search the live objects instead to also find objects spawned, moved
+    //or moved to another team during this update. The line of sight is only tested for objects nearer
+    //than the best target found so far.
+    if ( HAS_NO_BITS( targeting_bits, TARGET_PLAYERS ) && HAS_NO_BITS( targeting_bits, TARGET_QUEST ) && max_dist == NEAREST )
+    {
+        float best_dist2 = std::numeric_limits<float>::max();
+        for(const std::shared_ptr<Object> &ptst : _currentModule->getObjectHandler().iterator())
+        {
+            if ( !isCandidate(ptst) ) continue;
+
+            float dist2 = (psrc->getPosition() - ptst->getPosition()).length_2();
+            if ( dist2 < best_dist2 && isVisible(ptst) )
+            {
+                best_target = ptst->getObjRef();
+                best_dist2  = dist2;
+            }
+        }
+
+        return best_target;
+    }
+
+    //Search the objects of all teams we might target within range, nearest first, and
+    //stop at the first one we can actually see
+    if ( HAS_NO_BITS( targeting_bits, TARGET_PLAYERS ) && HAS_NO_BITS( targeting_bits, TARGET_QUEST ) )
+    {
+        TeamSpatialIndex::TeamMask teams;
+        for ( TEAM_REF team = 0; team < Team::TEAM_MAX; ++team )
+        {
+            // Items ignore the team filter of chr_check_target()
+            if ( HAS_SOME_BITS( targeting_bits, TARGET_ITEMS ) ) { teams.set(team); continue; }
+
+            bool is_hated = psrc->getTeam().hatesTeam(_currentModule->getTeamList()[team]);
+            if ( is_hated ? HAS_SOME_BITS( targeting_bits, TARGET_ENEMIES ) : HAS_SOME_BITS( targeting_bits, TARGET_FRIENDS ) )
+            {
+                teams.set(team);
+            }
+        }
+
+        _currentModule->getObjectHandler().getTeamIndex().visitNearest(teams, psrc->getPosition(), max_dist, isCandidate,
+            [&best_target, &isVisible](const std::shared_ptr<Object> &ptst, float)
+            {
+                if ( !isVisible(ptst) ) return false;
+                best_target = ptst->getObjRef();
+                return true;
+            });
+
+        return best_target;
+    }
+
     float best_dist2  = (max_dist == NEAREST) ? std::numeric_limits<float>::max() : max_dist*max_dist + 1.0f;
     for(const std::shared_ptr<Object> &ptst : searchList)
     {
@@ -651,19 +795,8 @@ ObjectRef chr_find_target( Object * psrc, float max_dist, const IDSZ2& idsz, con
         if (!chr_check_target(psrc, ptst, idsz, targeting_bits)) continue;
 
 		float dist2 = (psrc->getPosition() - ptst->getPosition()).length_2();
-        if (dist2 < best_dist2)
+        if (dist2 < best_dist2 && isVisible(ptst))
         {
-            //Invictus chars do not need a line of sight
-            if ( !psrc->isInvincible() )
-            {
-                // set the line-of-sight source
-                los_info.x1 = ptst->getPosition()[kX];
-                los_info.y1 = ptst->getPosition()[kY];
-                los_info.z1 = ptst->getPosition()[kZ] + std::max( 1.0f, ptst->bump.height );
-
-                if ( line_of_sight_info_t::blocked( los_info, _currentModule->getMeshPointer() ) ) continue;
-            }
-
             //Set the new best target found
             best_target = ptst->getObjRef();
             best_dist2  = dist2;
@@ -721,7 +854,9 @@ void WeatherState::animate()
 //--------------------------------------------------------------------------------------------
 void readPlayerInput()
 {
-    for(const std::shared_ptr<Ego::Player>& player : _currentModule->getPlayerList()) {
+    const std::vector<std::shared_ptr<Ego::Player>> &players = _currentModule->getPlayerList();
+    for(size_t index = 0; index < players.size(); ++index) {
+        const std::shared_ptr<Ego::Player>& player = players[index];
 
         //Only valid players
         const std::shared_ptr<Object> &pchr = player->getObject();
@@ -729,12 +864,14 @@ void readPlayerInput()
             continue;
         }
 
-        //Read input from the device controlling the player into object latches
-        player->updateLatches();
+        //Read input from the device controlling the player (or from the recording) into object latches
+        const Ego::PlayerInput input = g_inputRecording ? g_inputRecording->getInput(update_wld, index, *player)
+                                                        : player->readInput();
+        player->updateLatches(input);
 
         //Press space to respawn!
         bool respawnRequested = false;
-        if (Ego::Input::InputSystem::get().isKeyDown(SDLK_SPACE)
+        if (input.respawn
             && (local_stats.allpladead || _currentModule->canRespawnAnyTime())
             && _currentModule->isRespawnValid()
             && egoboo_config_t::get().game_difficulty.getValue() < Ego::GameDifficulty::Hard)
@@ -1066,6 +1203,7 @@ void game_quit_module()
     /// @details all of the de-initialization code after the module actually ends
 
     // stop the module
+    InputRecording::endModule();
     _currentModule.reset(nullptr);
 
     // deallocate any dynamically allocated scripting memory
@@ -1085,12 +1223,18 @@ void game_quit_module()
 
 //--------------------------------------------------------------------------------------------
 bool game_begin_module(const std::shared_ptr<ModuleProfile> &module)
+{
+    return game_begin_module(module, time(NULL));
+}
+
+bool game_begin_module(const std::shared_ptr<ModuleProfile> &module, const uint32_t seed)
 {
     /// @author BB
     /// @details all of the initialization code before the module actually starts
 
     // start the module
-    _currentModule = std::make_unique<GameModule>(module, time(NULL));
+    InputRecording::beginModule(module->getFolderName(), seed);
+    _currentModule = std::make_unique<GameModule>(module, seed);
 
     //After loading, spawn all the data and initialize everything (spawn.txt)
     //Due to dependency on the global _currentModule, we cannot do this in the constructor above
@@ -1099,6 +1243,44 @@ bool game_begin_module(const std::shared_ptr<ModuleProfile> &module)
     return true;
 }
 
+//--------------------------------------------------------------------------------------------
+bool game_import_players(const std::list<std::string> &playersToLoad)
+{
+    // blank out any existing data
+    import_list_t::init(g_importList);
+
+    // loop through the selected players and store all the valid data in the list of imported players
+    for(const std::string &loadPath : playersToLoad)
+    {
+        // get a new import data pointer
+        import_element_t *import_ptr = g_importList.lst + g_importList.count;
+        g_importList.count++;
+
+        //figure out which player we are (1, 2, 3 or 4)
+        import_ptr->local_player_num = g_importList.count-1;
+
+        // set the import info
+        import_ptr->slot            = (import_ptr->local_player_num) * MAX_IMPORT_PER_PLAYER;
+        import_ptr->player          = (import_ptr->local_player_num);
+
+        import_ptr->srcDir = loadPath;
+        import_ptr->dstDir = "";
+    }
+
+    if(g_importList.count > 0) {
+        if(game_copy_imports(&g_importList) == rv_success) {
+            return true;
+        }
+        else {
+            // erase the data in the import folder
+            vfs_removeDirectoryAndContents( "import", VFS_TRUE );
+            return false;
+        }
+    }
+
+    return false;
+}
+
 //--------------------------------------------------------------------------------------------
 bool game_finish_module()
 {
@@ -1130,6 +1312,9 @@ void let_all_characters_think()
 {
     /// @author ZZ
     /// @details This function funst the ai scripts for all eligible objects
+    Ego::AIScheduler& scheduler = _currentModule->getAIScheduler();
+    scheduler.beginUpdate();
+
     for(const std::shared_ptr<Object> &object : _currentModule->getObjectHandler().iterator())
     {
         if(object->isTerminated()) {
@@ -1151,6 +1336,13 @@ void let_all_characters_think()
             // Figure out alerts that weren't already set
             set_alerts(object->getObjRef());
 
+            // Objects far away from the players think less often, unless an event wakes them
+            if (!scheduler.isDue(*object)) {
+                // Keep moving towards the waypoint, but do not repeat the button presses of the last think
+                object->resetLatchButtons();
+                continue;
+            }
+
             // Cleaned up characters shouldn't be alert to anything else
             if (is_cleanedup) { 
                 object->ai.alert = ALERTIF_CLEANEDUP; 
@@ -1166,6 +1358,8 @@ void let_all_characters_think()
             scr_run_chr_script(object.get());
         }
     }
+
+    scheduler.endUpdate();
 }
 
 //--------------------------------------------------------------------------------------------
@@ -2389,7 +2583,7 @@ bool chr_do_latch_attack( Object * pchr, slot_t which_slot )
                     pchr->inst.setAnimationSpeed(0.80f + agility * 0.02f);   //every Agility increases base attack speed by 2%
 
                     //If Quick Strike perk triggers then we have fastest possible attack (10% chance)
-                    if(pchr->hasPerk(Ego::Perks::QUICK_STRIKE) && pweapon->getProfile()->isMeleeWeapon() && Random::getPercent() <= 10) {
+                    if(pchr->hasPerk(Ego::Perks::QUICK_STRIKE) && pweapon->getProfile()->isMeleeWeapon() && pchr->getRandomStream().getPercent() <= 10) {
                         pchr->inst.setAnimationSpeed(3.0f);
                         BillboardSystem::get().makeBillboard(pchr->getObjRef(), "Quick Strike!", Ego::Math::Colour4f::white(), Ego::Math::Colour4f::blue(), 3, Billboard::Flags::All);
                     }
@@ -2542,7 +2736,7 @@ void character_swipe( ObjectRef ichr, slot_t slot )
                     && pchr->hasPerk(Ego::Perks::WAND_MASTERY)) {
 
                     //1% chance per Intellect
-                    if(Random::getPercent() <= pchr->getAttribute(Ego::Attribute::INTELLECT)) {
+                    if(pchr->getRandomStream().getPercent() <= pchr->getAttribute(Ego::Attribute::INTELLECT)) {
                         BillboardSystem::get().makeBillboard(pchr->getObjRef(), "Wand Mastery!", Ego::Math::Colour4f::white(), Ego::Math::Colour4f::purple(), 3, Billboard::Flags::All);
                     }
                     else {
@@ -2561,7 +2755,7 @@ void character_swipe( ObjectRef ichr, slot_t slot )
             if(pchr->hasPerk(Ego::Perks::DOUBLE_SHOT) && weaponProfile->getIDSZ(IDSZ_PARENT).equals('L','B','O','W'))
             {
                 //1% chance per Agility
-                if(Random::getPercent() <= pchr->getAttribute(Ego::Attribute::AGILITY) && pweapon->ammo > 0) {
+                if(pchr->getRandomStream().getPercent() <= pchr->getAttribute(Ego::Attribute::AGILITY) && pweapon->ammo > 0) {
                     NR_OF_ATTACK_PARTICLES = 2;
                     BillboardSystem::get().makeBillboard(pchr->getObjRef(), "Double Shot!", Ego::Math::Colour4f::white(), Ego::Math::Colour4f::green(), 3, Billboard::Flags::All);                    
 
@@ -2724,13 +2918,13 @@ void character_swipe( ObjectRef ichr, slot_t slot )
                     }
                     else
                     {
-                        Log::get().debug("%s: - unable to spawn attack particle for %s\n", __FUNCTION__, weaponProfile->getClassName().c_str());
+                        EGO_LOG(Log::Level::Debug, "%s: - unable to spawn attack particle for %s\n", __FUNCTION__, weaponProfile->getClassName().c_str());
                     }
                 }
             }
             else
             {
-                Log::get().debug("%s: invalid attack particle: %s\n", __FUNCTION__, weaponProfile->getClassName().c_str());
+                EGO_LOG(Log::Level::Debug, "%s: invalid attack particle: %s\n", __FUNCTION__, weaponProfile->getClassName().c_str());
             }
         }
         else
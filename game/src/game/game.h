@@ -116,6 +116,29 @@ struct AnimatedTilesState {
 
 int update_game();
 
+/// The time spent in the phases of update_game(), accumulated over all updates since the last reset.
+struct UpdatePhaseTimings {
+    enum Phase {
+        Misc,           ///< Stats, input, quad tree, water, tiles, weather, sounds and billboards.
+        AI,             ///< Object scripts and player latches.
+        ObjectUpdate,   ///< Updating the objects.
+        ParticleUpdate, ///< Updating the particles.
+        Movement,       ///< Object and particle physics.
+        Collisions,     ///< The collision system.
+        Camera,         ///< The cameras.
+        Count
+    };
+
+    std::array<std::chrono::high_resolution_clock::duration, Count> durations;
+    uint32_t updates;   ///< The number of updates measured.
+
+    UpdatePhaseTimings();
+    void reset();
+    static const char *getName(Phase phase);
+};
+
+extern UpdatePhaseTimings g_updatePhaseTimings;
+
 //--------------------------------------------------------------------------------------------
 
 /// The state of the weather.
@@ -234,6 +257,10 @@ void game_quit_module();
 /// the hook for exporting all the current players and reloading them
 bool game_finish_module();
 bool game_begin_module(const std::shared_ptr<ModuleProfile> &module);
+/// the hook for starting a module with a fixed random seed
+bool game_begin_module(const std::shared_ptr<ModuleProfile> &module, const uint32_t seed);
+/// copy the saved characters (e.g. "mp_players/advent.obj") into the import folder
+bool game_import_players(const std::list<std::string> &playersToLoad);
 void game_load_module_profiles(const std::string& modname);
 
 /// Exporting stuff
@@ -57,20 +57,13 @@
 
 using namespace Ego::Time;
 
-/// Profiling timer for sorting the dolist(s) for unreflected rendering.
-Clock<ClockPolicy::NonRecursive> sortDoListUnreflected_timer("render.sortDoListUnreflected", 512);
-/// Profiling timer for sorting the dolist(s) for reflected rendering.
-Clock<ClockPolicy::NonRecursive> sortDoListReflected_timer("render.sortDoListReflected", 512);
+Clock<ClockPolicy::NonRecursive>  render_scene_init_timer("render.scene.init", 512, true);
+Clock<ClockPolicy::NonRecursive>  render_scene_mesh_timer("render.scene.mesh", 512, true);
 
-Clock<ClockPolicy::NonRecursive>  render_scene_init_timer("render.scene.init", 512);
-Clock<ClockPolicy::NonRecursive>  render_scene_mesh_timer("render.scene.mesh", 512);
-
-Clock<ClockPolicy::NonRecursive>  gfx_make_tileList_timer("gfx.make.tileList", 512);
-Clock<ClockPolicy::NonRecursive>  gfx_make_entityList_timer("gfx.make.entityList", 512);
-Clock<ClockPolicy::NonRecursive>  do_grid_lighting_timer("do.grid.lighting", 512);
-Clock<ClockPolicy::NonRecursive>  light_fans_timer("light.fans", 512);
-Clock<ClockPolicy::NonRecursive>  gfx_update_all_chr_instance_timer("gfx.update.all.chr.instance", 512);
-Clock<ClockPolicy::NonRecursive>  update_all_prt_instance_timer("update.all.prt.instance", 512);
+Clock<ClockPolicy::NonRecursive>  do_grid_lighting_timer("do.grid.lighting", 512, true);
+Clock<ClockPolicy::NonRecursive>  light_fans_timer("light.fans", 512, true);
+Clock<ClockPolicy::NonRecursive>  gfx_update_all_chr_instance_timer("gfx.update.all.chr.instance", 512, true);
+Clock<ClockPolicy::NonRecursive>  update_all_prt_instance_timer("update.all.prt.instance", 512, true);
 
 //--------------------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------------------
@@ -96,14 +89,9 @@ static dynalist_t _dynalist;
 //--------------------------------------------------------------------------------------------
 
 void reinitClocks() {
-	sortDoListUnreflected_timer.reinit();
-	sortDoListReflected_timer.reinit();
-
 	render_scene_init_timer.reinit();
 	render_scene_mesh_timer.reinit();
 
-	gfx_make_tileList_timer.reinit();
-	gfx_make_entityList_timer.reinit();
 	do_grid_lighting_timer.reinit();
 	light_fans_timer.reinit();
 	gfx_update_all_chr_instance_timer.reinit();
@@ -170,7 +158,7 @@ GFX::GFX() {
                                   // otherwise, it will not update until the frame count reaches whatever
                                   // left over or random value is in this counter
     _dynalist.frame = -1;
-    _dynalist.size = 0;
+    _dynalist.lst.clear();
 
     // Initialize the billboard system.
     try {
@@ -270,9 +258,51 @@ void GFX::initializeSDLGraphics()
     Ego::GraphicsSystem::window->setTitle(std::string("Egoboo ") + GameEngine::GAME_VERSION);
 }
 
+//--------------------------------------------------------------------------------------------
+gfx_rv gfx_system_prepare_world(std::shared_ptr<Camera> camera, std::shared_ptr<Ego::Graphics::TileList> tileList, std::shared_ptr<Ego::Graphics::EntityList> entityList)
+{
+    EGO_PROFILE_ZONE("render.prepare");
+
+    if (!camera)
+    {
+        throw std::invalid_argument("nullptr == camera");
+    }
+    if (!tileList) {
+        throw std::invalid_argument("nullptr == tileList");
+    }
+    if (!entityList) {
+        throw std::invalid_argument("nullptr == entityList");
+    }
+
+    {
+        EGO_PROFILE_ZONE("render.prepare.tileList");
+        // Which tiles can be displayed
+        if (gfx_error == gfx_make_tileList(*tileList, *camera))
+        {
+            return gfx_error;
+        }
+    }
+    {
+        EGO_PROFILE_ZONE("render.prepare.entityList");
+        // determine which objects are visible
+        if (gfx_error == gfx_make_entityList(*entityList, *camera))
+        {
+            return gfx_error;
+        }
+    }
+    {
+        EGO_PROFILE_ZONE("render.prepare.sort");
+        // sort the entities for rendering them and their reflections
+        entityList->sort(*camera);
+    }
+
+    return gfx_success;
+}
+
 //--------------------------------------------------------------------------------------------
 void gfx_system_render_world(std::shared_ptr<Camera> camera, std::shared_ptr<Ego::Graphics::TileList> tileList, std::shared_ptr<Ego::Graphics::EntityList> entityList)
 {
+    EGO_PROFILE_ZONE("render.world");
     gfx_error_state_t * err_tmp;
 
     gfx_error_clear();
@@ -313,7 +343,10 @@ void gfx_system_render_world(std::shared_ptr<Camera> camera, std::shared_ptr<Ego
     Renderer3D::end3D();
 
     // Render the billboards
-    BillboardSystem::get().render_all(*camera);
+    {
+        EGO_PROFILE_ZONE("render.billboards");
+        BillboardSystem::get().render_all(*camera);
+    }
 
     err_tmp = gfx_error_pop();
     if (err_tmp)
@@ -342,10 +375,15 @@ void gfx_system_main()
 {
     /// @author ZZ
     /// @details This function does all the drawing stuff
+    EGO_PROFILE_ZONE("render");
+    Ego::Core::FrameArena::FrameScope frameArena(Ego::Core::FrameArena::render());
 
-    CameraSystem::get().renderAll(gfx_system_render_world);
+    CameraSystem::get().renderAll(gfx_system_prepare_world, gfx_system_render_world);
 
-    draw_hud();
+    {
+        EGO_PROFILE_ZONE("render.hud");
+        draw_hud();
+    }
 
     gfx_request_flip_pages();
 }
@@ -826,32 +864,15 @@ gfx_rv render_scene_init(Ego::Graphics::TileList& tl, Ego::Graphics::EntityList&
     // assume the best;
     gfx_rv retval = gfx_success;
 
-    {
-		ClockScope<ClockPolicy::NonRecursive> scope(gfx_make_tileList_timer);
-        // Which tiles can be displayed
-        if (gfx_error == gfx_make_tileList(tl, cam))
-        {
-            retval = gfx_error;
-        }
-    }
-
+    // the tiles and entities were determined by gfx_system_prepare_world(),
+    // apply the changes of the lists to the mesh and to the particles
     auto mesh = tl.getMesh();
     if (!mesh)
     {
 		throw Id::RuntimeErrorException(__FILE__, __LINE__, "tile list is not attached to a mesh");
     }
-
-    {
-		ClockScope<ClockPolicy::NonRecursive> scope(gfx_make_entityList_timer);
-        // determine which objects are visible
-        if (gfx_error == gfx_make_entityList(el, cam))
-        {
-            retval = gfx_error;
-        }
-    }
-
-    // put off sorting the entity list until later
-    // because it has to be sorted differently for reflected and non-reflected objects
+    tl.commit();
+    el.commit();
 
     {
 		ClockScope<ClockPolicy::NonRecursive> scope(do_grid_lighting_timer);
@@ -967,22 +988,12 @@ gfx_rv render_scene(Camera& cam, Ego::Graphics::TileList& tl, Ego::Graphics::Ent
     }
     {
 		ClockScope<ClockPolicy::NonRecursive> clockScope(render_scene_mesh_timer);
-        {
-			// Sort dolist for reflected rendering.
-			ClockScope<ClockPolicy::NonRecursive> clockScope2(sortDoListReflected_timer);
-			el.sort(cam, true);
-        }
         // Render the mesh tiles and reflections of entities.
         if (gfx_error == render_scene_mesh(cam, tl, el))
         {
             retval = gfx_error;
         }
     }
-	{
-		// Sort dolist for unreflected rendering.
-		ClockScope<ClockPolicy::NonRecursive> scope(sortDoListUnreflected_timer);
-        el.sort(cam, false);
-	}
 
     // Render solid entities.
 	Ego::Graphics::RenderPasses::g_solidEntities.run(cam, tl, el);
@@ -1079,7 +1090,7 @@ void gfx_config_t::download(gfx_config_t& self, egoboo_config_t& cfg)
     self.draw_background = cfg.graphic_background_enable.getValue();
     self.draw_overlay = cfg.graphic_overlay_enable.getValue();
 
-    self.dynalist_max = Ego::Math::constrain(cfg.graphic_simultaneousDynamicLights_max.getValue(), (uint16_t)0, (uint16_t)TOTAL_MAX_DYNA);
+    self.dynalist_max = Ego::Math::constrain(cfg.graphic_simultaneousDynamicLights_max.getValue(), (uint16_t)0, (uint16_t)MAX_DYNA_BUDGET);
 }
 
 void gfx_config_t::init(gfx_config_t& self)
@@ -1108,6 +1119,10 @@ egolib_rv gfx_error_add(const char * file, const char * function, int line, int
 {
     gfx_error_state_t * pstate;
 
+    // errors may be added by the threads updating the particle instances
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
     // too many errors?
     if (gfx_error_stack.count >= GFX_ERROR_MAX) return rv_fail;
 
@@ -1804,7 +1819,7 @@ bool sum_global_lighting(std::array<float, LIGHTING_VEC_SIZE> &lighting)
 // SEMI OBSOLETE FUNCTIONS
 //--------------------------------------------------------------------------------------------
 void dynalist_t::init(dynalist_t& self) {
-    self.size = 0;
+    self.lst.clear();
 }
 
 //--------------------------------------------------------------------------------------------
@@ -1814,15 +1829,6 @@ gfx_rv gfx_make_dynalist(dynalist_t& dyl, Camera& cam)
     /// @details This function figures out which particles are visible, and it sets up dynamic
     ///    lighting
 
-    size_t    tnc;
-	Vector3f  vdist;
-
-    float         distance = 0.0f;
-    dynalight_data_t * plight = NULL;
-
-    float         distance_max = 0.0f;
-    dynalight_data_t * plight_max = NULL;
-
     // HACK: if dynalist is ahead of the game by 30 frames or more, reset and force an update
     if ((Uint32)(dyl.frame + 30) >= _gameEngine->getNumberOfFramesRendered())
         dyl.frame = -1;
@@ -1845,60 +1851,17 @@ gfx_rv gfx_make_dynalist(dynalist_t& dyl, Camera& cam)
         // is the light on?
         if (!pprt_dyna.on || 0.0f == pprt_dyna.level) continue;
 
-        // reset the dynalight pointer
-        plight = NULL;
-
-        // find the distance to the camera
-        vdist = particle->getPosition() - cam.getTrackPosition();
-        distance = vdist.length_2();
-
-        // insert the dynalight
-        if (dyl.size < gfx.dynalist_max && dyl.size < TOTAL_MAX_DYNA)
-        {
-            if (0 == dyl.size)
-            {
-                distance_max = distance;
-            }
-            else
-            {
-                distance_max = std::max(distance_max, distance);
-            }
-
-            // grab a new light from the list
-            plight = dyl.lst + dyl.size;
-            dyl.size++;
-
-            if (distance_max == distance)
-            {
-                plight_max = plight;
-            }
-        }
-        else if (distance < distance_max)
-        {
-            plight = plight_max;
-
-            // find the new maximum distance
-            distance_max = dyl.lst[0].distance;
-            plight_max = dyl.lst + 0;
-            for (tnc = 1; tnc < gfx.dynalist_max; tnc++)
-            {
-                if (dyl.lst[tnc].distance > distance_max)
-                {
-                    plight_max = dyl.lst + tnc;
-                    distance_max = plight_max->distance;
-                }
-            }
-        }
-
-        if (NULL != plight)
-        {
-            plight->distance = distance;
-            plight->pos = particle->getPosition();
-            plight->level = pprt_dyna.level;
-            plight->falloff = pprt_dyna.falloff;
-        }
+        dynalight_data_t light;
+        light.distance = (particle->getPosition() - cam.getTrackPosition()).length_2();
+        light.pos = particle->getPosition();
+        light.level = pprt_dyna.level;
+        light.falloff = pprt_dyna.falloff;
+        dyl.lst.push_back(light);
     }
 
+    // keep the most important lights within the budget
+    dyna_lighting_select(dyl.lst, gfx.dynalist_max);
+
     // the list is updated, so update the frame count
     dyl.frame = _gameEngine->getNumberOfFramesRendered();
 
@@ -1920,9 +1883,6 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
 
     std::array<float, LIGHTING_VEC_SIZE> global_lighting = {0};
 
-    size_t               reg_count = 0;
-    dynalight_registry_t reg[TOTAL_MAX_DYNA];
-
     ego_frect_t mesh_bound, light_bound;
     dynalight_data_t fake_dynalight;
 
@@ -1958,7 +1918,8 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
         return gfx_success;
 
     // clear out the dynalight registry
-    reg_count = 0;
+    dyl.registry.clear();
+    dyl.bounds.clear();
 
     // refresh the dynamic light list
     gfx_make_dynalist(dyl, cam);
@@ -1978,7 +1939,7 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
     // make bounding boxes for each dynamic light
     if (gfx.gouraudShading_enable)
     {
-        for (cnt = 0; cnt < dyl.size; cnt++)
+        for (cnt = 0; cnt < dyl.lst.size(); cnt++)
         {
             float radius;
             ego_frect_t ftmp;
@@ -1998,9 +1959,8 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
             // check to see if it intersects the "frustum"
             if (ftmp.xmin >= ftmp.xmax || ftmp.ymin >= ftmp.ymax) continue;
 
-            reg[reg_count].bound = ftmp;
-            reg[reg_count].reference = cnt;
-            reg_count++;
+            dyl.registry.push_back(cnt);
+            dyl.bounds.push_back(ftmp);
 
             // determine the maxumum bounding box that encloses all valid lights
             light_bound.xmin = std::min(light_bound.xmin, ftmp.xmin);
@@ -2010,7 +1970,7 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
         }
 
         // are there any dynalights visible?
-        if (reg_count > 0 && light_bound.xmax >= light_bound.xmin && light_bound.ymax >= light_bound.ymin)
+        if (!dyl.registry.empty() && light_bound.xmax >= light_bound.xmin && light_bound.ymax >= light_bound.ymin)
         {
             needs_dynalight = true;
         }
@@ -2021,7 +1981,7 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
         float dyna_weight_sum = 0.0f;
 
         // evaluate all the lights at the camera position
-        for (cnt = 0; cnt < dyl.size; cnt++)
+        for (cnt = 0; cnt < dyl.lst.size(); cnt++)
         {
 			dynalight_data_t& pdyna = dyl.lst[cnt];
 
@@ -2061,15 +2021,20 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
             light_bound = ftmp;
 
             // register the fake dynalight
-            reg[reg_count].bound = ftmp;
-            reg[reg_count].reference = -1;
-            reg_count++;
+            dyl.registry.push_back(-1);
+            dyl.bounds.push_back(ftmp);
 
             // let the downstream calc know we are coming
             needs_dynalight = true;
         }
     }
 
+    // bin the registered lights so that each grid only tests the lights of its cluster
+    if (needs_dynalight)
+    {
+        dyl.clusters.rebuild(mesh_bound, dyl.bounds, Info<float>::Grid::Size() * 0.5f);
+    }
+
     // sum up the lighting from global sources
     sum_global_lighting(global_lighting);
 
@@ -2132,24 +2097,25 @@ gfx_rv GridIllumination::do_grid_lighting(Ego::Graphics::TileList& tl, dynalist_
                 if (fgrid_rect.ymin <= light_bound.ymax && fgrid_rect.ymax >= light_bound.ymin)
                 {
                     // this grid has dynamic lighting. add it.
-                    for (cnt = 0; cnt < reg_count; cnt++)
+                    for (uint32_t ref : dyl.clusters.get(x0, y0))
                     {
 						Vector3f nrm;
                         dynalight_data_t *pdyna;
+                        const ego_frect_t& bound = dyl.bounds[ref];
 
                         // does this dynamic light intersects this grid?
-                        if (fgrid_rect.xmin > reg[cnt].bound.xmax || fgrid_rect.xmax < reg[cnt].bound.xmin) continue;
-                        if (fgrid_rect.ymin > reg[cnt].bound.ymax || fgrid_rect.ymax < reg[cnt].bound.ymin) continue;
+                        if (fgrid_rect.xmin > bound.xmax || fgrid_rect.xmax < bound.xmin) continue;
+                        if (fgrid_rect.ymin > bound.ymax || fgrid_rect.ymax < bound.ymin) continue;
 
                         // this should be a valid intersection, so proceed
-                        tnc = reg[cnt].reference;
+                        tnc = dyl.registry[ref];
                         if (tnc < 0)
                         {
                             pdyna = &fake_dynalight;
                         }
                         else
                         {
-                            pdyna = dyl.lst + tnc;
+                            pdyna = &dyl.lst[tnc];
                         }
 
                         nrm[kX] = pdyna->pos[kX] - x0;
@@ -2238,14 +2204,15 @@ gfx_rv gfx_make_entityList(Ego::Graphics::EntityList& el, Camera& cam)
     el.clear();
 
     // collide the characters with the frustum
-    std::vector<std::shared_ptr<Object>> visibleObjects = 
+    auto visibleObjects = 
         _currentModule->getObjectHandler().findObjects(
             cam.getCenter()[kX], 
             cam.getCenter()[kY], 
 			Info<float>::Grid::Size() * 10,  //@todo: use camera view size here instead
+            Ego::Core::FrameArena::render(),
             true);
 
-    for(const std::shared_ptr<Object> object : visibleObjects) {
+    for(const std::shared_ptr<Object> &object : visibleObjects) {
         el.add(cam, *object.get());
     }
 
@@ -2363,6 +2330,10 @@ gfx_rv gfx_update_all_chr_instance()
     // assume the best
     retval = gfx_success;
 
+    // the characters on the map and whether their vertices could be interpolated
+    std::vector<std::pair<Object *, bool>> instances;
+    instances.reserve(_currentModule->getObjectHandler().getObjectCount());
+
     for (const std::shared_ptr<Object> &pchr : _currentModule->getObjectHandler().iterator())
     {
         //Dont do terminated characters
@@ -2375,17 +2346,25 @@ gfx_rv gfx_update_all_chr_instance()
         if (!mesh->grid_is_valid(pchr->getTile())) continue;
 
         // make sure that the vertices are interpolated
-        if(pchr->inst.updateVertices(-1, -1, true) == gfx_error) {
+        const bool interpolated = pchr->inst.updateVertices(-1, -1, true) != gfx_error;
+        if (!interpolated) {
             retval = gfx_error;
         }
+        instances.emplace_back(pchr.get(), interpolated);
+    }
 
+    // update the matrices of all characters at once, holders before held items
+    update_all_character_matrices();
+
+    for (const auto &instance : instances)
+    {
         // the instance has changed, refresh the collision bound
-        else {
-            pchr->getObjectPhysics().updateCollisionSize(true);            
+        if (instance.second) {
+            instance.first->getObjectPhysics().updateCollisionSize(false);
         }
 
         // do the basic lighting
-        pchr->inst.updateLighting();
+        instance.first->inst.updateLighting();
     }
 
     return retval;
@@ -28,6 +28,7 @@
 #include "game/egoboo.h"
 #include "game/Graphics/TileList.hpp"
 #include "game/Graphics/EntityList.hpp"
+#include "game/Graphics/DynamicLightClusters.hpp"
 #include "game/Graphics/Vertex.hpp"
 #include "game/Graphics/RenderPasses.hpp"
 #include "egolib/Graphics/MD2Model.hpp"
@@ -213,7 +214,10 @@ void gfx_system_init_all_graphics();
 void gfx_system_release_all_graphics();
 void gfx_system_load_assets();
 
-// the render engine callback
+// the render engine callbacks
+/// Determine the visible tiles and entities of a camera and sort the entities. Touches no OpenGL state
+/// and no shared state, so it is run for all cameras concurrently.
+gfx_rv gfx_system_prepare_world(const std::shared_ptr<Camera> camera, std::shared_ptr<Ego::Graphics::TileList> tl, std::shared_ptr<Ego::Graphics::EntityList> el);
 void gfx_system_render_world(const std::shared_ptr<Camera> camera, std::shared_ptr<Ego::Graphics::TileList> tl, std::shared_ptr<Ego::Graphics::EntityList> el);
 
 void gfx_request_clear_screen();
@@ -232,20 +236,16 @@ void draw_passages(Camera& cam);
 struct dynalist_t
 {
 	int frame; ///< The last frame in shich the list was updated. @a -1 if there was no update yet.
-	size_t size; ///< The size of the list.
-	dynalight_data_t lst[TOTAL_MAX_DYNA];  ///< The list.
+	std::vector<dynalight_data_t> lst;  ///< The list.
+	std::vector<int> registry;  ///< The lights visible in the "frustum". @a -1 refers to the fake dynalight.
+	std::vector<ego_frect_t> bounds;  ///< The bounds of the lights in the registry, clipped to the visible part of the mesh. Not grown.
+	Ego::Graphics::DynamicLightClusters clusters;  ///< Indices into the registry and the bounds, binned by cluster. A light is binned into every cluster its bounds grown by half a grid overlap.
 	static void init(dynalist_t& self);
     dynalist_t()
-        : frame(-1), size(0), lst{}
+        : frame(-1), lst(), registry(), bounds(), clusters()
     {}
 };
 
-/// Structure for keeping track of which dynalights are visible
-struct dynalight_registry_t {
-    int reference;
-    ego_frect_t bound;
-};
-
 /// Illuminate the "grid".
 struct GridIllumination {
 private:
@@ -30,11 +30,136 @@
 #include "game/GUI/UIManager.hpp"
 #include "game/CharacterMatrix.h"
 
+constexpr int BillboardAtlas::PAGE_SIZE;
+constexpr size_t BillboardAtlas::MAX_PAGES;
+constexpr int BillboardAtlas::SHELF_GRANULARITY;
+
+BillboardAtlas::BillboardAtlas() :
+    _pages() {
+}
+
+bool BillboardAtlas::allocate(const std::shared_ptr<SDL_Surface>& text, Slot& slot) {
+    // Keep a transparent border of one pixel around each text, so filtering does not pick up its neighbours.
+    const int width = text->w + 2;
+    const int height = (text->h + 2 + SHELF_GRANULARITY - 1) / SHELF_GRANULARITY * SHELF_GRANULARITY;
+    if (width > PAGE_SIZE || height > PAGE_SIZE) {
+        return false;
+    }
+
+    bool found = false;
+    for (size_t page = 0; page < _pages.size() && !found; ++page) {
+        found = allocate(page, width, height, slot);
+    }
+    if (!found) {
+        if (_pages.size() >= MAX_PAGES) {
+            return false;
+        }
+        // Create a new, transparent page.
+        Page page;
+        const auto& pfd = Ego::PixelFormatDescriptor::get<Ego::PixelFormat::R8G8B8A8>();
+        page.surface = std::shared_ptr<SDL_Surface>(SDL_CreateRGBSurface(0, PAGE_SIZE, PAGE_SIZE, pfd.getColourDepth().getDepth(),
+                                                                         pfd.getRedMask(), pfd.getGreenMask(), pfd.getBlueMask(), pfd.getAlphaMask()),
+                                                    SDL_FreeSurface);
+        if (!page.surface) {
+            return false;
+        }
+        SDL_FillRect(page.surface.get(), nullptr, 0);
+        auto texture = std::make_shared<Ego::OpenGL::Texture>();
+        texture->load("billboard atlas", page.surface, Ego::TextureType::_2D,
+                      Ego::TextureSampler(Ego::TextureFilter::Linear, Ego::TextureFilter::Linear, Ego::TextureFilter::None,
+                                          Ego::TextureAddressMode::Clamp, Ego::TextureAddressMode::Clamp, 1.0f));
+        texture->setMinFilter(Ego::TextureFilter::Linear);
+        texture->setMagFilter(Ego::TextureFilter::Linear);
+        texture->setMipMapFilter(Ego::TextureFilter::None);
+        page.texture = texture;
+        page.top = 0;
+        _pages.push_back(page);
+        if (!allocate(_pages.size() - 1, width, height, slot)) {
+            return false;
+        }
+    }
+    slot.textWidth = text->w;
+    slot.textHeight = text->h;
+
+    // Copy the text into the page and upload the slot.
+    Page& page = _pages[slot.page];
+    SDL_Rect rectangle = {slot.x, slot.y, slot.width, height};
+    SDL_FillRect(page.surface.get(), &rectangle, 0);
+    SDL_Rect position = {slot.x + 1, slot.y + 1, text->w, text->h};
+    SDL_SetSurfaceBlendMode(text.get(), SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(text.get(), nullptr, page.surface.get(), &position);
+    static_cast<Ego::OpenGL::Texture *>(page.texture.get())->reload(slot.x, slot.y, slot.width, height);
+    return true;
+}
+
+bool BillboardAtlas::allocate(size_t pageIndex, int width, int height, Slot& slot) {
+    Page& page = _pages[pageIndex];
+    for (size_t shelfIndex = 0; shelfIndex < page.shelves.size(); ++shelfIndex) {
+        Shelf& shelf = page.shelves[shelfIndex];
+        if (shelf.height != height) continue;
+        // Reuse a freed slot wide enough.
+        for (auto it = shelf.freeSlots.begin(); it != shelf.freeSlots.end(); ++it) {
+            if (it->second >= width) {
+                slot = Slot{pageIndex, shelfIndex, it->first, shelf.y, it->second, 0, 0};
+                shelf.freeSlots.erase(it);
+                shelf.count++;
+                return true;
+            }
+        }
+        // Append to the shelf.
+        if (shelf.used + width <= PAGE_SIZE) {
+            slot = Slot{pageIndex, shelfIndex, shelf.used, shelf.y, width, 0, 0};
+            shelf.used += width;
+            shelf.count++;
+            return true;
+        }
+    }
+    // Resize the last shelf if it is empty or open a new shelf.
+    if (!page.shelves.empty() && 0 == page.shelves.back().count && page.shelves.back().y + height <= PAGE_SIZE) {
+        Shelf& shelf = page.shelves.back();
+        shelf.height = height;
+        shelf.used = width;
+        shelf.count = 1;
+        page.top = shelf.y + height;
+        slot = Slot{pageIndex, page.shelves.size() - 1, 0, shelf.y, width, 0, 0};
+        return true;
+    }
+    if (page.top + height <= PAGE_SIZE) {
+        page.shelves.push_back(Shelf{page.top, height, width, 1, {}});
+        page.top += height;
+        slot = Slot{pageIndex, page.shelves.size() - 1, 0, page.shelves.back().y, width, 0, 0};
+        return true;
+    }
+    return false;
+}
+
+void BillboardAtlas::free(const Slot& slot) {
+    Shelf& shelf = _pages[slot.page].shelves[slot.shelf];
+    if (0 == --shelf.count) {
+        shelf.used = 0;
+        shelf.freeSlots.clear();
+    } else if (slot.x + slot.width == shelf.used) {
+        shelf.used = slot.x;
+    } else {
+        shelf.freeSlots.emplace_back(slot.x, slot.width);
+    }
+}
+
+void BillboardAtlas::clear() {
+    _pages.clear();
+}
+
 Billboard::Billboard(Time::Ticks endTime, std::shared_ptr<Ego::Texture> texture, const float size)
     : _endTime(endTime),
       _position(), _offset(), _offset_add(),
       _size(size), _size_add(0.0f),
-      _texture(texture), _object(),
+      _texture(texture),
+      _s0(0.0f), _t0(0.0f),
+      _s1((float)texture->getSourceWidth() / (float)texture->getWidth()),
+      _t1((float)texture->getSourceHeight() / (float)texture->getHeight()),
+      _width(texture->getSourceWidth()), _height(texture->getSourceHeight()),
+      _slot(), _hasSlot(false),
+      _object(),
       _tint(Colour3f::white(), 1.0f), _tint_add(0.0f, 0.0f, 0.0f, 0.0f) {
     /* Intentionally empty. */
 }
@@ -78,11 +203,39 @@ void BillboardSystem::update()
 {
     const Time::Ticks ticks = Time::now<Time::Unit::Ticks>();
 
-    _billboardList.erase(
-        std::remove_if(_billboardList.begin(), _billboardList.end(), [&ticks](const std::shared_ptr<Billboard>& billboard) {
-            return !billboard->update(ticks);
-        }),
-    _billboardList.end());
+    size_t fallbacks = 0;
+    for (auto it = _billboardList.begin(); it != _billboardList.end();) {
+        if (!(*it)->update(ticks)) {
+            release(**it);
+            it = _billboardList.erase(it);
+        } else {
+            fallbacks += (*it)->_hasSlot ? 0 : 1;
+            ++it;
+        }
+    }
+
+    _statistics.billboards = _billboardList.size();
+    _statistics.pages = _atlas.getPageCount();
+    _statistics.fallbacks = fallbacks;
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed = std::chrono::duration<double>(now - _statisticsTime).count();
+    if (elapsed >= 1.0) {
+        const size_t count = Ego::OpenGL::Texture::getNumberOfTexturesCreated();
+        _statistics.texturesCreatedPerSecond = (count - _statisticsTextureCount) / elapsed;
+        _statisticsTextureCount = count;
+        _statisticsTime = now;
+    }
+}
+
+const BillboardSystem::Statistics& BillboardSystem::getStatistics() const {
+    return _statistics;
+}
+
+void BillboardSystem::release(Billboard& billboard) {
+    if (billboard._hasSlot) {
+        _atlas.free(billboard._slot);
+        billboard._hasSlot = false;
+    }
 }
 
 bool BillboardSystem::hasBillboard(const Object& object) const {
@@ -146,8 +299,12 @@ std::shared_ptr<Billboard> BillboardSystem::makeBillboard(Time::Seconds lifetime
 BillboardSystem *BillboardSystem::singleton = nullptr;
 
 BillboardSystem::BillboardSystem() :
-    _billboardList(), 
-    vertexBuffer(4, Ego::VertexFormatFactory::get<Ego::VertexFormat::P3FT2F>()) {
+    _billboardList(),
+    _atlas(),
+    _vertexBuffer(nullptr),
+    _statistics{0, 0, 0, 0.0},
+    _statisticsTime(std::chrono::steady_clock::now()),
+    _statisticsTextureCount(Ego::OpenGL::Texture::getNumberOfTexturesCreated()) {
 }
 
 BillboardSystem::~BillboardSystem() {
@@ -168,7 +325,11 @@ void BillboardSystem::uninitialize() {
 }
 
 void BillboardSystem::reset() {
+    for (const auto& billboard : _billboardList) {
+        release(*billboard);
+    }
     _billboardList.clear();
+    _atlas.clear();
 }
 
 BillboardSystem& BillboardSystem::get() {
@@ -178,71 +339,32 @@ BillboardSystem& BillboardSystem::get() {
     return *singleton;
 }
 
-bool BillboardSystem::render_one(Billboard& billboard, const Vector3f& cameraUp, const Vector3f& cameraRight)
+void BillboardSystem::addVertices(const Billboard& billboard, const Vector3f& cameraUp, const Vector3f& cameraRight, Vertex *vertices)
 {
-    auto obj_ptr = billboard._object.lock();
-    // Do not display billboards for objects that are being held of are inside an inventory.
-    if (!obj_ptr || obj_ptr->isTerminated() || obj_ptr->isBeingHeld() || obj_ptr->isInsideInventory()) {
-        return false;
-    }
-
-	auto texture = billboard._texture.get();
-
-    // Compute the texture coordinates.
-    float s = (float)texture->getSourceWidth()  / (float)texture->getWidth(),
-          t = (float)texture->getSourceHeight() / (float)texture->getHeight();
     // Compute the scaled right and up vectors.
-	Vector3f right = cameraRight * (texture->getSourceWidth()  * billboard._size),
-             up    = cameraUp    * (texture->getSourceHeight() * billboard._size);
-
-	{
-        Vector3f tmp;
-		Ego::VertexBufferScopedLock lock(vertexBuffer);
-		Vertex *vertices = lock.get<Vertex>();
-
-        // bottom left
-		tmp = billboard._position + billboard._offset + (-right - up * 0);
-		vertices[0].x = tmp.x();
-		vertices[0].y = tmp.y();
-		vertices[0].z = tmp.z();
-		vertices[0].s = s;
-		vertices[0].t = t;
-
-		// top left
-		tmp = billboard._position + billboard._offset + (-right + up * 2);
-		vertices[1].x = tmp.x();
-		vertices[1].y = tmp.y();
-		vertices[1].z = tmp.z();
-		vertices[1].s = s;
-		vertices[1].t = 0;
-
-		// top right
-		tmp = billboard._position + billboard._offset + (right + up * 2);
-		vertices[2].x = tmp.x();
-		vertices[2].y = tmp.y();
-		vertices[2].z = tmp.z();
-		vertices[2].s = 0;
-		vertices[2].t = 0;
-
-		// bottom right
-		tmp = billboard._position + billboard._offset + (right - up * 0);
-		vertices[3].x = tmp.x();
-		vertices[3].y = tmp.y();
-		vertices[3].z = tmp.z();
-		vertices[3].s = 0;
-		vertices[3].t = t;
-	}
-
-    {
-        auto& renderer = Ego::Renderer::get();
-        renderer.setColour(billboard._tint);
-		renderer.getTextureUnit().setActivated(texture);
-
-        // Go on and draw it
-		renderer.render(vertexBuffer, Ego::PrimitiveType::Quadriliterals, 0, 4);
+	Vector3f right = cameraRight * (billboard._width  * billboard._size),
+             up    = cameraUp    * (billboard._height * billboard._size);
+
+    // bottom left, top left, top right, bottom right
+    const Vector3f corners[4] = {
+        billboard._position + billboard._offset + (-right - up * 0),
+        billboard._position + billboard._offset + (-right + up * 2),
+        billboard._position + billboard._offset + (right + up * 2),
+        billboard._position + billboard._offset + (right - up * 0),
+    };
+    const float s[4] = {billboard._s1, billboard._s1, billboard._s0, billboard._s0};
+    const float t[4] = {billboard._t1, billboard._t0, billboard._t0, billboard._t1};
+    for (size_t i = 0; i < 4; ++i) {
+        vertices[i].x = corners[i].x();
+        vertices[i].y = corners[i].y();
+        vertices[i].z = corners[i].z();
+        vertices[i].r = billboard._tint.getRed();
+        vertices[i].g = billboard._tint.getGreen();
+        vertices[i].b = billboard._tint.getBlue();
+        vertices[i].a = billboard._tint.getAlpha();
+        vertices[i].s = s[i];
+        vertices[i].t = t[i];
     }
-
-    return true;
 }
 
 void BillboardSystem::render_all(Camera& camera)
@@ -272,8 +394,43 @@ void BillboardSystem::render_all(Camera& camera)
             renderer.setAlphaTestEnabled(true);
 			renderer.setAlphaFunction(Ego::CompareFunction::Greater, 0.0f);
 
+            // Do not display billboards for objects that are being held of are inside an inventory.
+            std::vector<const Billboard *> billboards;
             for (const auto &billboard : _billboardList) {
-                render_one(*billboard, camera.getUp(), camera.getRight());
+                auto obj_ptr = billboard->_object.lock();
+                if (!obj_ptr || obj_ptr->isTerminated() || obj_ptr->isBeingHeld() || obj_ptr->isInsideInventory()) {
+                    continue;
+                }
+                billboards.push_back(billboard.get());
+            }
+            if (!billboards.empty()) {
+                // Batch the billboards sharing a texture i.e. an atlas page.
+                std::stable_sort(billboards.begin(), billboards.end(), [](const Billboard *x, const Billboard *y) {
+                    return std::less<const Ego::Texture *>()(x->_texture.get(), y->_texture.get());
+                });
+
+                const size_t numberOfVertices = 4 * billboards.size();
+                if (!_vertexBuffer || _vertexBuffer->getNumberOfVertices() < numberOfVertices) {
+                    const size_t capacity = std::max(numberOfVertices, _vertexBuffer ? 2 * _vertexBuffer->getNumberOfVertices() : 64);
+                    _vertexBuffer = std::make_shared<Ego::VertexBuffer>(capacity, Ego::VertexFormatFactory::get<Ego::VertexFormat::P3FC4FT2F>());
+                }
+                {
+                    Ego::VertexBufferScopedLock lock(*_vertexBuffer);
+                    Vertex *vertices = lock.get<Vertex>();
+                    for (size_t i = 0; i < billboards.size(); ++i) {
+                        addVertices(*billboards[i], camera.getUp(), camera.getRight(), vertices + 4 * i);
+                    }
+                }
+
+                for (size_t first = 0; first < billboards.size();) {
+                    size_t last = first + 1;
+                    while (last < billboards.size() && billboards[last]->_texture == billboards[first]->_texture) {
+                        last++;
+                    }
+                    renderer.getTextureUnit().setActivated(billboards[first]->_texture.get());
+                    renderer.render(*_vertexBuffer, Ego::PrimitiveType::Quadriliterals, 4 * first, 4 * (last - first));
+                    first = last;
+                }
             }
         }
     }
@@ -287,20 +444,46 @@ std::shared_ptr<Billboard> BillboardSystem::makeBillboard(ObjectRef obj_ref, con
         return nullptr;
     }
 
+    // Without a renderer (headless runs) the text is not rendered: the billboard has no texture
+    // and expires at its first update, but it is made like any other so the game logic sees no difference.
+    if (!Ego::Renderer::isInitialized() || !_gameEngine->getUIManager()) {
+        auto billboard = makeBillboard(lifetime_secs, nullptr, tint, opt_bits, size);
+        billboard->_object = std::weak_ptr<Object>(obj_ptr);
+        billboard->_position = obj_ptr->getPosition();
+        return billboard;
+    }
+
     // Pre-render the text.
-    std::shared_ptr<Ego::Texture> tex;
-    try {
-        tex = std::make_shared<Ego::OpenGL::Texture>();
-    } catch (...) {
+    auto surface = _gameEngine->getUIManager()->getFloatingTextFont()->drawTextToSurface(text, Ego::Math::Colour3f(textColor.getRed(), textColor.getGreen(), textColor.getBlue()));
+    if (!surface) {
         return nullptr;
     }
-    _gameEngine->getUIManager()->getFloatingTextFont()->drawTextToTexture(tex.get(), text, Ego::Math::Colour3f(textColor.getRed(), textColor.getGreen(), textColor.getBlue()));
-    tex->setName("billboard text");
 
-    // Create a new billboard.
-    auto billboard = makeBillboard(lifetime_secs, tex, tint, opt_bits, size);
-    if (!billboard) {
-        return nullptr;
+    // Create a new billboard, its text in the atlas if it fits or in a texture of its own otherwise.
+    std::shared_ptr<Billboard> billboard;
+    BillboardAtlas::Slot slot;
+    if (_atlas.allocate(surface, slot)) {
+        billboard = makeBillboard(lifetime_secs, _atlas.getTexture(slot.page), tint, opt_bits, size);
+        const float scale = 1.0f / BillboardAtlas::PAGE_SIZE;
+        billboard->_s0 = (slot.x + 1) * scale;
+        billboard->_t0 = (slot.y + 1) * scale;
+        billboard->_s1 = (slot.x + 1 + slot.textWidth) * scale;
+        billboard->_t1 = (slot.y + 1 + slot.textHeight) * scale;
+        billboard->_width = slot.textWidth;
+        billboard->_height = slot.textHeight;
+        billboard->_slot = slot;
+        billboard->_hasSlot = true;
+    } else {
+        std::shared_ptr<Ego::Texture> tex;
+        try {
+            tex = std::make_shared<Ego::OpenGL::Texture>();
+            tex->load("billboard text", surface);
+        } catch (...) {
+            return nullptr;
+        }
+        tex->setAddressModeS(Ego::TextureAddressMode::Clamp);
+        tex->setAddressModeT(Ego::TextureAddressMode::Clamp);
+        billboard = makeBillboard(lifetime_secs, tex, tint, opt_bits, size);
     }
 
     billboard->_object = std::weak_ptr<Object>(obj_ptr);
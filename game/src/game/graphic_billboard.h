@@ -27,6 +27,70 @@
 class Camera;
 namespace Ego { class Font; }
 
+/**
+ * @brief
+ *  Texts of billboards packed into a few large textures, the pages. A page is divided into shelves,
+ *  rows of texts of the same (rounded) height placed left to right. A freed slot is reused by a text
+ *  of at most its width and a shelf without texts is emptied.
+ */
+struct BillboardAtlas : public Id::NonCopyable {
+    /// The width and height of a page.
+    static constexpr int PAGE_SIZE = 512;
+    /// The maximum number of pages.
+    static constexpr size_t MAX_PAGES = 4;
+    /// The heights of shelves are multiples of this.
+    static constexpr int SHELF_GRANULARITY = 8;
+
+    /// A rectangle of a page holding a text.
+    struct Slot {
+        size_t page, shelf;
+        int x, y;           ///< the position of the slot
+        int width;          ///< the width of the slot
+        int textWidth, textHeight;
+    };
+
+    BillboardAtlas();
+
+    /**
+     * @brief
+     *  Copy a text into a free slot of this atlas.
+     * @param text
+     *  the surface of the text
+     * @param [out] slot
+     *  the slot
+     * @return
+     *  @a true on success, @a false if the text does not fit into this atlas
+     */
+    bool allocate(const std::shared_ptr<SDL_Surface>& text, Slot& slot);
+
+    /// Free a slot allocated by this atlas.
+    void free(const Slot& slot);
+
+    /// Free all slots and delete all pages.
+    void clear();
+
+    const std::shared_ptr<Ego::Texture>& getTexture(size_t page) const { return _pages[page].texture; }
+    size_t getPageCount() const { return _pages.size(); }
+
+private:
+    struct Shelf {
+        int y, height;
+        int used;                                   ///< the width used by slots
+        size_t count;                               ///< the number of allocated slots
+        std::vector<std::pair<int, int>> freeSlots; ///< the positions and widths of freed slots
+    };
+    struct Page {
+        std::shared_ptr<SDL_Surface> surface;
+        std::shared_ptr<Ego::Texture> texture;
+        std::vector<Shelf> shelves;
+        int top;                                    ///< the height used by shelves
+    };
+
+    bool allocate(size_t page, int width, int height, Slot& slot);
+
+    std::vector<Page> _pages;
+};
+
 /**
  * @brief
  *  Supposed to be a generic billboard.
@@ -76,6 +140,18 @@ struct Billboard {
      *  The texture reference.
      */
     std::shared_ptr<Ego::Texture> _texture;
+    /**
+     * @brief
+     *  The texture coordinates and the size (in pixels) of the billboard within the texture.
+     */
+    float _s0, _t0, _s1, _t1;
+    int _width, _height;
+    /**
+     * @brief
+     *  The slot of the billboard in the billboard atlas if @a _hasSlot is @a true.
+     */
+    BillboardAtlas::Slot _slot;
+    bool _hasSlot;
     Vector3f _position;          ///< the position of the bottom-missle of the box
 
     /**
@@ -115,6 +191,10 @@ struct Billboard {
     float _size;
     float _size_add;
 
+    /**
+     * @brief
+     *  Construct a billboard showing an entire texture.
+     */
     Billboard(Time::Ticks endTime, std::shared_ptr<Ego::Texture> texture, const float size);
 
     /**
@@ -136,24 +216,43 @@ public:
     static void uninitialize();
     static BillboardSystem& get();
 public:
-    bool render_one(Billboard& billboard, const Vector3f& cam_up, const Vector3f& cam_rgt);
+    struct Statistics {
+        size_t billboards;              ///< the number of billboards
+        size_t pages;                   ///< the number of pages of the billboard atlas
+        size_t fallbacks;               ///< the number of billboards with their own texture
+        double texturesCreatedPerSecond;///< textures created per second by the whole game, over the last second
+    };
+
     /**
      * @brief Update all billboards in this billboard system with the time of "now".
      */
     void update();
     void reset();
     bool hasBillboard(const Object& object) const;
+    const Statistics& getStatistics() const;
 
 private:
+    /// Remove a billboard and free its slot.
+    void release(Billboard& billboard);
+
     // List of used billboards.
     std::list<std::shared_ptr<Billboard>> _billboardList;
+    // The texts of the billboards.
+    BillboardAtlas _atlas;
     // A vertex type used by the billboard system.
     struct Vertex {
         float x, y, z;
+        float r, g, b, a;
         float s, t;
     };
-    // A vertex buffer used by the billboard system.
-    Ego::VertexBuffer vertexBuffer;
+    /// Write the four vertices of a billboard.
+    void addVertices(const Billboard& billboard, const Vector3f& cam_up, const Vector3f& cam_rgt, Vertex *vertices);
+    // A vertex buffer used by the billboard system, grown as needed.
+    std::shared_ptr<Ego::VertexBuffer> _vertexBuffer;
+    // The statistics and the time and texture count at which they were last updated.
+    Statistics _statistics;
+    std::chrono::steady_clock::time_point _statisticsTime;
+    size_t _statisticsTextureCount;
 
 private:
 
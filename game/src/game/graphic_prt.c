@@ -30,6 +30,8 @@
 #include "game/Graphics/CameraSystem.hpp"
 #include "game/Entities/_Include.hpp"
 #include "game/CharacterMatrix.h"
+#include "game/Core/GameEngine.hpp"
+#include "egolib/Core/ThreadPool.hpp"
 
 //--------------------------------------------------------------------------------------------
 
@@ -77,82 +79,161 @@ void prt_set_texture_params(const std::shared_ptr<const Ego::Texture>& texture,
 }
 
 //--------------------------------------------------------------------------------------------
-static gfx_rv prt_instance_update(Camera& camera, const ParticleRef particle, Uint8 trans, bool do_lighting);
-static void calc_billboard_verts(Ego::VertexBuffer& vb, prt_instance_t& pinst, float size, bool do_reflect);
+static gfx_rv prt_instance_update(Camera& camera, Ego::Particle& particle, Uint8 trans, bool do_lighting);
+static void calc_billboard_verts(ParticleBatch::Vertex *v, const prt_instance_t& inst, float size, bool do_reflect, const Ego::Math::Colour4f& colour);
 static void draw_one_attachment_point(Ego::Graphics::ObjectGraphics& inst, int vrt_offset);
 static void prt_draw_attached_point(const std::shared_ptr<Ego::Particle> &bdl_prt);
 static void render_prt_bbox(const std::shared_ptr<Ego::Particle> &bdl_prt);
 
 //--------------------------------------------------------------------------------------------
 
-gfx_rv render_one_prt_solid(const ParticleRef iprt)
+ParticleBatch::ParticleBatch() :
+    _mode(Mode::Solid),
+    _size(0),
+    _vertexBuffer(),
+    _frame(0),
+    _thisFrame(),
+    _lastFrame()
+{}
+
+ParticleBatch& ParticleBatch::get()
 {
-    /// @author BB
-    /// @details Render the solid version of the particle
+    static ParticleBatch batch;
+    return batch;
+}
 
-    const std::shared_ptr<Ego::Particle> &pprt = ParticleHandler::get()[iprt];
-    if (pprt == nullptr || pprt->isTerminated())
+void ParticleBatch::add(Mode mode, const prt_instance_t& inst, const Ego::Math::Colour4f& colour)
+{
+    // The statistics of a frame are complete once the next frame is drawn.
+    if (_frame != _gameEngine->getNumberOfFramesRendered())
     {
-        gfx_error_add(__FILE__, __FUNCTION__, __LINE__, iprt.get(), "invalid particle");
-        return gfx_error;
+        _frame = _gameEngine->getNumberOfFramesRendered();
+        _lastFrame = _thisFrame;
+        _thisFrame = Statistics();
     }
 
-    // if the particle is hidden, do not continue
-    if (pprt->isHidden()) return gfx_fail;
+    if (_size > 0 && mode != _mode)
+    {
+        flush();
+    }
+    _mode = mode;
 
-    // if the particle instance data is not valid, do not continue
-    if (!pprt->inst.valid) return gfx_fail;
-    prt_instance_t& pinst = pprt->inst;
+    const size_t numberOfVertices = 4 * (_size + 1);
+    if (!_vertexBuffer || _vertexBuffer->getNumberOfVertices() < numberOfVertices)
+    {
+        const size_t capacity = std::max(numberOfVertices, _vertexBuffer ? 2 * _vertexBuffer->getNumberOfVertices() : 256);
+        auto vertexBuffer = std::make_shared<Ego::VertexBuffer>(capacity, Ego::VertexFormatFactory::get<Ego::VertexFormat::P3FC4FT2F>());
+        if (_size > 0)
+        {
+            Ego::VertexBufferScopedLock source(*_vertexBuffer), target(*vertexBuffer);
+            std::copy_n(source.get<Vertex>(), 4 * _size, target.get<Vertex>());
+        }
+        _vertexBuffer = vertexBuffer;
+    }
 
-    // only render solid sprites
-    if (SPRITE_SOLID != pprt->type) return gfx_fail;
+    const bool reflected = Mode::ReflectedLight == mode || Mode::ReflectedAlpha == mode;
+    {
+        Ego::VertexBufferScopedLock lock(*_vertexBuffer);
+        calc_billboard_verts(lock.get<Vertex>() + 4 * _size, inst, inst.size, reflected, colour);
+    }
+    _size++;
+}
+
+void ParticleBatch::flush()
+{
+    if (0 == _size)
+    {
+        return;
+    }
+
+    _thisFrame.billboards += _size;
+    _thisFrame.drawCalls++;
 
     Ego::Renderer::get().setWorldMatrix(Matrix4f4f::identity());
     {
         Ego::OpenGL::PushAttrib pa(GL_ENABLE_BIT | GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT | GL_CURRENT_BIT);
-        {
-            auto& renderer = Ego::Renderer::get();
-            // Use the depth test to eliminate hidden portions of the particle
-            renderer.setDepthTestEnabled(true);
-            renderer.setDepthFunction(Ego::CompareFunction::Less);                                   // GL_DEPTH_BUFFER_BIT
+        setRenderState(_mode);
+        Ego::Renderer::get().render(*_vertexBuffer, Ego::PrimitiveType::Quadriliterals, 0, 4 * _size);
+    }
+    _size = 0;
+}
 
-            // enable the depth mask for the solid portion of the particles
-            renderer.setDepthWriteEnabled(true);
+void ParticleBatch::setRenderState(Mode mode)
+{
+    auto& renderer = Ego::Renderer::get();
 
-            // draw draw front and back faces of polygons
-            renderer.setCullingMode(Ego::CullingMode::None);
+    // draw front and back faces of polygons
+    renderer.setCullingMode(Ego::CullingMode::None);
 
-            // Since the textures are probably mipmapped or minified with some kind of
-            // interpolation, we can never really turn blending off.
-            renderer.setBlendingEnabled(true);
-            renderer.setBlendFunction(Ego::BlendFunction::SourceAlpha, Ego::BlendFunction::OneMinusSourceAlpha);
+    // Since the textures are probably mipmapped or minified with some kind of
+    // interpolation, we can never really turn blending off.
+    renderer.setBlendingEnabled(true);
+
+    // Use the depth test to eliminate hidden portions of the particles.
+    renderer.setDepthTestEnabled(true);
+
+    switch (mode)
+    {
+        case Mode::Solid:
+            // enable the depth mask for the solid portion of the particles
+            renderer.setDepthWriteEnabled(true);
+            renderer.setDepthFunction(Ego::CompareFunction::Less);
 
             // only display the portion of the particle that is 100% solid
             renderer.setAlphaTestEnabled(true);
             renderer.setAlphaFunction(Ego::CompareFunction::Equal, 1.0f);
+            renderer.setBlendFunction(Ego::BlendFunction::SourceAlpha, Ego::BlendFunction::OneMinusSourceAlpha);
+            break;
 
-            renderer.getTextureUnit().setActivated(ParticleHandler::get().getTransparentParticleTexture().get());
+        case Mode::SolidEdge:
+            // Do the alpha blended edge ("anti-aliasing") of the solid particle.
+            // Only display the alpha-edge of the particle.
+            renderer.setDepthWriteEnabled(false);
+            renderer.setDepthFunction(Ego::CompareFunction::LessOrEqual);
+            renderer.setAlphaTestEnabled(true);
+            renderer.setAlphaFunction(Ego::CompareFunction::Less, 1.0f);
+            renderer.setBlendFunction(Ego::BlendFunction::SourceAlpha, Ego::BlendFunction::OneMinusSourceAlpha);
+            break;
 
-            renderer.setColour(Ego::Math::Colour4f(pinst.fintens, pinst.fintens, pinst.fintens, 1.0f));
+        case Mode::Light:
+            renderer.setDepthWriteEnabled(false);
+            renderer.setDepthFunction(Ego::CompareFunction::LessOrEqual);
+            renderer.setAlphaTestEnabled(false);
+            renderer.setBlendFunction(Ego::BlendFunction::One, Ego::BlendFunction::One);
+            break;
 
-            // billboard for the particle
-            auto vb = std::make_shared<Ego::VertexBuffer>(4, Ego::VertexFormatFactory::get<Ego::VertexFormat::P3FT2F>());
-            calc_billboard_verts(*vb, pinst, pinst.size, false);
+        case Mode::Alpha:
+        case Mode::ReflectedLight:
+        case Mode::ReflectedAlpha:
+            // don't write into the depth buffer (disable glDepthMask for transparent objects)
+            renderer.setDepthWriteEnabled(false);
+            renderer.setDepthFunction(Ego::CompareFunction::LessOrEqual);
 
-            renderer.render(*vb, Ego::PrimitiveType::TriangleFan, 0, 4);
-        }
+            // do not display the completely transparent portion
+            renderer.setAlphaTestEnabled(true);
+            renderer.setAlphaFunction(Ego::CompareFunction::Greater, 0.0f);
+            renderer.setBlendFunction(Ego::BlendFunction::SourceAlpha, Ego::BlendFunction::OneMinusSourceAlpha);
+            break;
     }
 
-    return gfx_success;
+    if (Mode::Light == mode || Mode::ReflectedLight == mode)
+    {
+        renderer.getTextureUnit().setActivated(ParticleHandler::get().getLightParticleTexture().get());
+    }
+    else
+    {
+        renderer.getTextureUnit().setActivated(ParticleHandler::get().getTransparentParticleTexture().get());
+    }
 }
 
-gfx_rv render_one_prt_trans(const ParticleRef iprt)
+//--------------------------------------------------------------------------------------------
+
+gfx_rv render_one_prt_solid(const ParticleRef iprt)
 {
     /// @author BB
-    /// @details do all kinds of transparent sprites next
+    /// @details Render the solid version of the particle
 
     const std::shared_ptr<Ego::Particle> &pprt = ParticleHandler::get()[iprt];
-
     if (pprt == nullptr || pprt->isTerminated())
     {
         gfx_error_add(__FILE__, __FUNCTION__, __LINE__, iprt.get(), "invalid particle");
@@ -164,97 +245,65 @@ gfx_rv render_one_prt_trans(const ParticleRef iprt)
 
     // if the particle instance data is not valid, do not continue
     if (!pprt->inst.valid) return gfx_fail;
-    prt_instance_t& inst = pprt->inst;
-
-    {
-        Ego::Renderer::get().setWorldMatrix(Matrix4f4f::identity());
-        Ego::OpenGL::PushAttrib pa(GL_ENABLE_BIT | GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT | GL_CURRENT_BIT);
-        {
-            auto& renderer = Ego::Renderer::get();
-            // Do not write into the depth buffer.
-            renderer.setDepthWriteEnabled(false);
-
-            // Enable depth test: Incoming fragment's depth value must be less or equal.
-            renderer.setDepthTestEnabled(true);
-            renderer.setDepthFunction(Ego::CompareFunction::LessOrEqual);
-
-            // Draw front-facing and back-facing polygons.
-            renderer.setCullingMode(Ego::CullingMode::None);
-
-            Ego::Math::Colour4f particleColour;
-
-            switch(pprt->type)
-            {
-                // Solid sprites.
-                case SPRITE_SOLID:
-                {
-                    // Do the alpha blended edge ("anti-aliasing") of the solid particle.
-                    // Only display the alpha-edge of the particle.
-                    renderer.setAlphaTestEnabled(true);
-                    renderer.setAlphaFunction(Ego::CompareFunction::Less, 1.0f);
-
-                    renderer.setBlendingEnabled(true);
-                    renderer.setBlendFunction(Ego::BlendFunction::SourceAlpha, Ego::BlendFunction::OneMinusSourceAlpha);
-
-                    particleColour = Ego::Math::Colour4f(inst.fintens, inst.fintens, inst.fintens, 1.0f);
-
-                    renderer.getTextureUnit().setActivated(ParticleHandler::get().getTransparentParticleTexture().get());
-                }
-                break;
+    prt_instance_t& pinst = pprt->inst;
 
-                // Light sprites.
-                case SPRITE_LIGHT:
-                {
-                    //Is particle invisible?
-                    if(inst.fintens * inst.falpha <= 0.0f) {
-                        return gfx_success;
-                    }
+    // only render solid sprites
+    if (SPRITE_SOLID != pprt->type) return gfx_fail;
 
-                    renderer.setAlphaTestEnabled(false);
-                    renderer.setBlendingEnabled(true);
-                    renderer.setBlendFunction(Ego::BlendFunction::One, Ego::BlendFunction::One);
+    ParticleBatch::get().add(ParticleBatch::Mode::Solid, pinst, Ego::Math::Colour4f(pinst.fintens, pinst.fintens, pinst.fintens, 1.0f));
 
-                    particleColour = Ego::Math::Colour4f(1.0f, 1.0f, 1.0f, inst.fintens * inst.falpha);
+    return gfx_success;
+}
 
-                    renderer.getTextureUnit().setActivated(ParticleHandler::get().getLightParticleTexture().get());
-                }
-                break;
+gfx_rv render_one_prt_trans(const ParticleRef iprt)
+{
+    /// @author BB
+    /// @details do all kinds of transparent sprites next
 
-                // Transparent sprites.
-                case SPRITE_ALPHA:
-                {
-                    //Is particle invisible?
-                    if(inst.falpha <= 0.0f) {
-                        return gfx_success;
-                    }
+    const std::shared_ptr<Ego::Particle> &pprt = ParticleHandler::get()[iprt];
 
-                    // do not display the completely transparent portion
-                    renderer.setAlphaTestEnabled(true);
-                    renderer.setAlphaFunction(Ego::CompareFunction::Greater, 0.0f);
+    if (pprt == nullptr || pprt->isTerminated())
+    {
+        gfx_error_add(__FILE__, __FUNCTION__, __LINE__, iprt.get(), "invalid particle");
+        return gfx_error;
+    }
 
-                    renderer.setBlendingEnabled(true);
-                    renderer.setBlendFunction(Ego::BlendFunction::SourceAlpha, Ego::BlendFunction::OneMinusSourceAlpha);
+    // if the particle is hidden, do not continue
+    if (pprt->isHidden()) return gfx_fail;
 
-                    particleColour = Ego::Math::Colour4f(inst.fintens, inst.fintens, inst.fintens, inst.falpha);
+    // if the particle instance data is not valid, do not continue
+    if (!pprt->inst.valid) return gfx_fail;
+    prt_instance_t& inst = pprt->inst;
 
-                    renderer.getTextureUnit().setActivated(ParticleHandler::get().getTransparentParticleTexture().get());
-                }
-                break;
+    switch(pprt->type)
+    {
+        // Solid sprites.
+        case SPRITE_SOLID:
+            ParticleBatch::get().add(ParticleBatch::Mode::SolidEdge, inst, Ego::Math::Colour4f(inst.fintens, inst.fintens, inst.fintens, 1.0f));
+        break;
 
-                // unknown type
-                default:
-                    return gfx_error;
-                break;
+        // Light sprites.
+        case SPRITE_LIGHT:
+            //Is particle invisible?
+            if(inst.fintens * inst.falpha <= 0.0f) {
+                return gfx_success;
             }
+            ParticleBatch::get().add(ParticleBatch::Mode::Light, inst, Ego::Math::Colour4f(1.0f, 1.0f, 1.0f, inst.fintens * inst.falpha));
+        break;
 
-            auto vb = std::make_shared<Ego::VertexBuffer>(4, Ego::VertexFormatFactory::get<Ego::VertexFormat::P3FT2F>());
-            calc_billboard_verts(*vb, inst, inst.size, false);
-
-            renderer.setColour(particleColour);
+        // Transparent sprites.
+        case SPRITE_ALPHA:
+            //Is particle invisible?
+            if(inst.falpha <= 0.0f) {
+                return gfx_success;
+            }
+            ParticleBatch::get().add(ParticleBatch::Mode::Alpha, inst, Ego::Math::Colour4f(inst.fintens, inst.fintens, inst.fintens, inst.falpha));
+        break;
 
-            // Go on and draw it
-            renderer.render(*vb, Ego::PrimitiveType::TriangleFan, 0, 4);
-        }
+        // unknown type
+        default:
+            return gfx_error;
+        break;
     }
 
     return gfx_success;
@@ -283,102 +332,52 @@ gfx_rv render_one_prt_ref(const ParticleRef iprt)
 
     if (fadeoff > 0.0f)
     {
-        Ego::Renderer::get().setWorldMatrix(Matrix4f4f::identity());
+        switch(pprt->type) 
         {
-            Ego::OpenGL::PushAttrib pa(GL_ENABLE_BIT | GL_DEPTH_BUFFER_BIT | GL_CURRENT_BIT);
+            case SPRITE_LIGHT:
             {
-                Ego::Colour4f particle_colour;
-
-                auto& renderer = Ego::Renderer::get();
-                // don't write into the depth buffer (disable glDepthMask for transparent objects)
-                renderer.setDepthWriteEnabled(false); // ENABLE_BIT
-
-                // do not draw hidden surfaces
-                renderer.setDepthTestEnabled(true);
-                renderer.setDepthFunction(Ego::CompareFunction::LessOrEqual);
-
-                // draw draw front and back faces of polygons
-                renderer.setCullingMode(Ego::CullingMode::None);
-
-                // do not display the completely transparent portion
-                renderer.setAlphaTestEnabled(true);
-                renderer.setAlphaFunction(Ego::CompareFunction::Greater, 0.0f);
-
-                renderer.setBlendingEnabled(true);
-                renderer.setBlendFunction(Ego::BlendFunction::SourceAlpha, Ego::BlendFunction::OneMinusSourceAlpha);
-
-                switch(pprt->type) 
-                {
-                    case SPRITE_LIGHT:
-                    {
-                        // do the light sprites
-                        float alpha = fadeoff * inst.falpha;
-
-                        //Nothing to draw?
-                        if(alpha <= 0.0f) {
-                            return gfx_fail;
-                        }
-
-                        particle_colour = Ego::Math::Colour4f(1.0f, 1.0f, 1.0f, alpha);
-
-                        renderer.getTextureUnit().setActivated(ParticleHandler::get().getLightParticleTexture().get());
-                    }
-                    break;
+                // do the light sprites
+                float alpha = fadeoff * inst.falpha;
 
-                    case SPRITE_SOLID:
-                    case SPRITE_ALPHA:
-                    {
-                        float alpha = fadeoff;
-                        if (SPRITE_ALPHA == pprt->type) {
-                            alpha *= inst.falpha;
-
-                            //Nothing to draw?
-                            if(alpha <= 0.0f) {
-                                return gfx_fail;
-                            }
-                        }
+                //Nothing to draw?
+                if(alpha <= 0.0f) {
+                    return gfx_fail;
+                }
 
-                        particle_colour = Ego::Math::Colour4f(inst.fintens, inst.fintens, inst.fintens, alpha);
+                ParticleBatch::get().add(ParticleBatch::Mode::ReflectedLight, inst, Ego::Math::Colour4f(1.0f, 1.0f, 1.0f, alpha));
+            }
+            break;
 
-                        renderer.getTextureUnit().setActivated(ParticleHandler::get().getTransparentParticleTexture().get());
-                    }
-                    break;
+            case SPRITE_SOLID:
+            case SPRITE_ALPHA:
+            {
+                float alpha = fadeoff;
+                if (SPRITE_ALPHA == pprt->type) {
+                    alpha *= inst.falpha;
 
-                    // unknown type
-                    default:
+                    //Nothing to draw?
+                    if(alpha <= 0.0f) {
                         return gfx_fail;
-                    break;
+                    }
                 }
 
-                // Calculate the position of the four corners of the billboard
-                // used to display the particle.
-                auto vb = std::make_shared<Ego::VertexBuffer>(4, Ego::VertexFormatFactory::get<Ego::VertexFormat::P3FT2F>());
-                calc_billboard_verts(*vb, inst, inst.size, true);
-
-                renderer.setColour(particle_colour); // GL_CURRENT_BIT
-
-                renderer.render(*vb, Ego::PrimitiveType::TriangleFan, 0, 4);
+                ParticleBatch::get().add(ParticleBatch::Mode::ReflectedAlpha, inst, Ego::Math::Colour4f(inst.fintens, inst.fintens, inst.fintens, alpha));
             }
+            break;
+
+            // unknown type
+            default:
+                return gfx_fail;
+            break;
         }
     }
 
     return gfx_success;
 }
 
-void calc_billboard_verts(Ego::VertexBuffer& vb, prt_instance_t& inst, float size, bool do_reflect)
+void calc_billboard_verts(ParticleBatch::Vertex *v, const prt_instance_t& inst, float size, bool do_reflect, const Ego::Math::Colour4f& colour)
 {
-    // Calculate the position and texture coordinates of the four corners of the billboard used to display the particle.
-
-    if (vb.getNumberOfVertices() < 4)
-    {
-        throw std::runtime_error("vertex buffer too small");
-    }
-    /// @todo Add a compare by equality for vertex format descriptors and assert the vertex buffer has the required format.
-    struct Vertex
-    {
-        float x, y, z;
-        float s, t;
-    };
+    // Calculate the position, colour and texture coordinates of the four corners of the billboard used to display the particle.
 
     int i, index;
 	Vector3f prt_pos, prt_up, prt_right;
@@ -409,13 +408,16 @@ void calc_billboard_verts(Ego::VertexBuffer& vb, prt_instance_t& inst, float siz
         prt_right = inst.right;
     }
 
-    Vertex *v = static_cast<Vertex *>(vb.lock());
-
     for (i = 0; i < 4; i++)
     {
         v[i].x = prt_pos[kX];
         v[i].y = prt_pos[kY];
         v[i].z = prt_pos[kZ];
+
+        v[i].r = colour.getRed();
+        v[i].g = colour.getGreen();
+        v[i].b = colour.getBlue();
+        v[i].a = colour.getAlpha();
     }
 
     v[0].x += (-prt_right[kX] - prt_up[kX]) * size;
@@ -445,8 +447,6 @@ void calc_billboard_verts(Ego::VertexBuffer& vb, prt_instance_t& inst, float siz
 
     v[3].s = CALCULATE_PRT_U1(index, inst.image_ref);
     v[3].t = CALCULATE_PRT_V0(index, inst.image_ref);
-
-    vb.unlock();
 }
 
 void render_all_prt_attachment()
@@ -507,33 +507,102 @@ gfx_rv update_all_prt_instance(Camera& camera)
     if (instance_update == update_wld) return gfx_success;
     instance_update = update_wld;
 
-    // assume the best
-    gfx_rv retval = gfx_success;
+    EGO_PROFILE_ZONE("render.particles.instances");
 
-    for(const std::shared_ptr<Ego::Particle> &particle : ParticleHandler::get().iterator())
+    // The instances are independent of each other, so they are updated in parallel.
+    // No particle is added or removed while the iterator is alive.
+    auto particles = ParticleHandler::get().iterator();
+    return update_prt_instances(particles.begin(), particles.end(), std::max(1U, std::thread::hardware_concurrency()),
+                                [&camera](Ego::Particle& particle)
     {
-        if(particle->isTerminated()) continue;
-        
-        prt_instance_t *pinst = &(particle->inst);
+        if (particle.isTerminated()) return gfx_success;
 
         // only do frame counting for particles that are fully activated!
-        particle->frame_count++;
+        particle.frame_count++;
 
-        if (!particle->inst.indolist)
+        if (!particle.inst.indolist)
         {
-            pinst->valid = false;
-            pinst->ref_valid = false;
+            particle.inst.valid = false;
+            particle.inst.ref_valid = false;
+            return gfx_success;
         }
-        else
+
+        // calculate the "billboard" for this particle
+        return prt_instance_update(camera, particle, 255, true);
+    });
+}
+
+gfx_rv update_prt_instances(ParticleVectorIterator begin, ParticleVectorIterator end, size_t numberOfThreads,
+                            const std::function<gfx_rv(Ego::Particle&)>& update)
+{
+    // Below this many particles per thread, handing them to the worker threads costs more than it saves.
+    static const size_t MIN_PARTICLES_PER_THREAD = 128;
+    static const size_t numberOfWorkers = std::max(1U, std::thread::hardware_concurrency()) - 1;
+    static std::unique_ptr<ThreadPool> pool;
+
+    auto updateRange = [&update](ParticleVectorIterator first, ParticleVectorIterator last)
+    {
+        // assume the best
+        gfx_rv retval = gfx_success;
+
+        for (auto it = first; it != last; ++it)
+        {
+            if (gfx_error == update(**it))
+            {
+                retval = gfx_error;
+            }
+        }
+        return retval;
+    };
+
+    const size_t count = end - begin;
+    const size_t numberOfRanges = std::min({numberOfWorkers + 1, numberOfThreads, count / MIN_PARTICLES_PER_THREAD});
+    if (numberOfRanges <= 1)
+    {
+        return updateRange(begin, end);
+    }
+
+    if (!pool)
+    {
+        pool = std::make_unique<ThreadPool>(numberOfWorkers);
+    }
+    std::vector<std::future<gfx_rv>> pending;
+    for (size_t i = 1; i < numberOfRanges; ++i)
+    {
+        pending.push_back(pool->submit(updateRange, begin + count * i / numberOfRanges,
+                                                    begin + count * (i + 1) / numberOfRanges));
+    }
+
+    // wait for all worker threads before passing on an exception, they refer to this stack frame
+    gfx_rv retval = gfx_success;
+    std::exception_ptr error;
+    try
+    {
+        retval = updateRange(begin, begin + count / numberOfRanges);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    for (std::future<gfx_rv>& future : pending)
+    {
+        try
         {
-            // calculate the "billboard" for this particle
-            if (gfx_error == prt_instance_update(camera, particle->getParticleID(), 255, true))
+            if (gfx_error == future.get())
             {
                 retval = gfx_error;
             }
         }
+        catch (...)
+        {
+            if (!error) error = std::current_exception();
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
     }
- 
+
     return retval;
 }
 
@@ -891,27 +960,21 @@ gfx_rv prt_instance_t::update_lighting(prt_instance_t& pinst, Ego::Particle *ppr
     return gfx_success;
 }
 
-gfx_rv prt_instance_update(Camera& camera, const ParticleRef particle, Uint8 trans, bool do_lighting)
+gfx_rv prt_instance_update(Camera& camera, Ego::Particle& particle, Uint8 trans, bool do_lighting)
 {
-    const std::shared_ptr<Ego::Particle> &pprt = ParticleHandler::get()[particle];
-    if(!pprt) {
-        gfx_error_add(__FILE__, __FUNCTION__, __LINE__, particle.get(), "invalid particle");
-        return gfx_error;
-    }
-
-    prt_instance_t& pinst = pprt->inst;
+    prt_instance_t& pinst = particle.inst;
 
     // assume the best
     gfx_rv retval = gfx_success;
 
     // make sure that the vertices are interpolated
-    if (gfx_error == prt_instance_t::update_vertices(pinst, camera, pprt.get()))
+    if (gfx_error == prt_instance_t::update_vertices(pinst, camera, &particle))
     {
         retval = gfx_error;
     }
 
     // do the lighting
-    if (gfx_error == prt_instance_t::update_lighting(pinst, pprt.get(), trans, do_lighting))
+    if (gfx_error == prt_instance_t::update_lighting(pinst, &particle, trans, do_lighting))
     {
         retval = gfx_error;
     }
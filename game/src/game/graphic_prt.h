@@ -162,10 +162,78 @@ struct prt_instance_t
     static gfx_rv update_lighting(prt_instance_t& inst, Ego::Particle *pprt, Uint8 trans, bool do_lighting);
 };
 
+/**
+ * @brief
+ *  Gathers the billboards of particles drawn with the same texture and blend mode
+ *  and draws each run of them with a single draw call, setting the render state once per run.
+ * @remark
+ *  Billboards are drawn in the order in which they were added, so adding a billboard
+ *  of another mode ends the current run. Call flush() before rendering anything else.
+ */
+class ParticleBatch : public Id::NonCopyable
+{
+public:
+    enum class Mode
+    {
+        Solid,          ///< The opaque part of solid sprites.
+        SolidEdge,      ///< The alpha blended edge of solid sprites.
+        Light,          ///< Light sprites.
+        Alpha,          ///< Transparent sprites.
+        ReflectedLight, ///< Reflections of light sprites.
+        ReflectedAlpha, ///< Reflections of solid and transparent sprites.
+    };
+
+    struct Vertex
+    {
+        float x, y, z;
+        float r, g, b, a;
+        float s, t;
+    };
+
+    struct Statistics
+    {
+        size_t billboards;  ///< The number of billboards drawn.
+        size_t drawCalls;   ///< The number of draw calls issued for them.
+    };
+
+    static ParticleBatch& get();
+
+    /// Queue the billboard of a particle instance.
+    void add(Mode mode, const prt_instance_t& inst, const Ego::Math::Colour4f& colour);
+
+    /// Draw the queued billboards.
+    void flush();
+
+    /// @return the statistics of the last frame
+    const Statistics& getStatistics() const { return _lastFrame; }
+
+private:
+    ParticleBatch();
+
+    static void setRenderState(Mode mode);
+
+    Mode _mode;
+    /// The number of queued billboards.
+    size_t _size;
+    /// A vertex buffer holding the queued billboards, grown as needed.
+    std::shared_ptr<Ego::VertexBuffer> _vertexBuffer;
+    uint32_t _frame;
+    Statistics _thisFrame, _lastFrame;
+};
+
+/// Queue the opaque part of a solid particle into ParticleBatch::get().
 gfx_rv render_one_prt_solid(const ParticleRef iprt);
+/// Queue a transparent or light particle or the edge of a solid particle into ParticleBatch::get().
 gfx_rv render_one_prt_trans(const ParticleRef iprt);
+/// Queue the reflection of a particle into ParticleBatch::get().
 gfx_rv render_one_prt_ref(const ParticleRef iprt);
 void render_all_prt_bbox();
 void render_all_prt_attachment();
 gfx_rv update_all_prt_instance(Camera& cam);
 
+using ParticleVectorIterator = std::vector<std::shared_ptr<Ego::Particle>>::iterator;
+/// Apply @a update to every particle in [begin, end), splitting them over at most @a numberOfThreads threads.
+/// @a update must only touch the particle it is given. Used by update_all_prt_instance().
+gfx_rv update_prt_instances(ParticleVectorIterator begin, ParticleVectorIterator end, size_t numberOfThreads,
+                            const std::function<gfx_rv(Ego::Particle&)>& update);
+
@@ -501,6 +501,40 @@ float dyna_lighting_intensity( const dynalight_data_t * pdyna, const Vector3f& d
     return level;
 }
 
+//--------------------------------------------------------------------------------------------
+float dyna_lighting_importance( const dynalight_data_t& light )
+{
+    // the squared radius of the light as in dyna_lighting_intensity()
+    float radius_sqr = std::max( 0.0f, light.falloff ) * 765.0f * 0.5f;
+
+    return std::abs( light.level ) * radius_sqr / ( radius_sqr + light.distance + 1.0f );
+}
+
+//--------------------------------------------------------------------------------------------
+void dyna_lighting_select( std::vector<dynalight_data_t>& lights, size_t budget )
+{
+    if ( lights.size() <= budget ) return;
+
+    // rank the lights, ties are broken by the original order
+    std::vector<std::pair<float, size_t>> ranking;
+    ranking.reserve( lights.size() );
+    for ( size_t cnt = 0; cnt < lights.size(); cnt++ )
+    {
+        ranking.emplace_back( -dyna_lighting_importance( lights[cnt] ), cnt );
+    }
+    std::nth_element( ranking.begin(), ranking.begin() + budget, ranking.end() );
+    ranking.resize( budget );
+
+    // restore the original order of the kept lights
+    std::sort( ranking.begin(), ranking.end(),
+               []( const std::pair<float, size_t>& x, const std::pair<float, size_t>& y ) { return x.second < y.second; } );
+    for ( size_t cnt = 0; cnt < budget; cnt++ )
+    {
+        lights[cnt] = lights[ranking[cnt].second];
+    }
+    lights.resize( budget );
+}
+
 //--------------------------------------------------------------------------------------------
 bool sum_dyna_lighting( const dynalight_data_t * pdyna, LightingVector& lighting, const Vector3f& nrm )
 {
@@ -116,7 +116,7 @@ struct lighting_cache_t
 
 //--------------------------------------------------------------------------------------------
 #define MAXDYNADIST                     2700        // Leeway for offscreen lights
-#define TOTAL_MAX_DYNA                    64          // Absolute max number of dynamic lights
+#define MAX_DYNA_BUDGET                   1024        // Absolute max number of dynamic lights
 
 /// A definition of a single in-game dynamic light
 struct dynalight_data_t
@@ -175,3 +175,10 @@ bool sum_dyna_lighting( const dynalight_data_t * pdyna, LightingVector& lighting
 ///              exact problem because the infinite range means that it can potentally affect
 ///              the entire mesh, causing problems with computing a large number of lights
 float  dyna_lighting_intensity( const dynalight_data_t * pdyna, const Vector3f& diff );
+
+/// The importance of a dynamic light when ranking lights against a budget.
+/// Bright, large lights close to the camera are the most important.
+float  dyna_lighting_importance( const dynalight_data_t& light );
+/// Keep the @a budget most important dynamic lights and drop the rest.
+/// The kept lights stay in their original order.
+void   dyna_lighting_select( std::vector<dynalight_data_t>& lights, size_t budget );
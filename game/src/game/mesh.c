@@ -925,6 +925,7 @@ bool ego_mesh_t::clear_fx( const Index1D& i, const BIT_FIELD flags )
 
     if (_tmem.get(i).removeFX(flags)) {
         _fxlists.dirty = true;
+        touch();
         return true;
     } else {
         return false;
@@ -946,6 +947,7 @@ bool ego_mesh_t::add_fx(const Index1D& i, const BIT_FIELD flags)
     if ( retval )
     {
         _fxlists.dirty = true;
+        touch();
     }
 
     return retval;
@@ -1272,7 +1274,13 @@ BIT_FIELD ego_mesh_t::hit_wall(const Vector3f& pos, const float radius, const BI
 }
 
 ego_mesh_t::ego_mesh_t(const Ego::MeshInfo& mesh_info)
-	: _info(mesh_info), _tmem(mesh_info), _fxlists(mesh_info) {
+	: _info(mesh_info), _tmem(mesh_info), _fxlists(mesh_info), _revision(0) {
+	touch();
+}
+
+void ego_mesh_t::touch() {
+	static std::atomic<uint32_t> revisions(0);
+	_revision = ++revisions;
 }
 
 ego_mesh_t::~ego_mesh_t() {
@@ -1309,7 +1317,12 @@ bool ego_mesh_t::set_texture(const Index1D& index1D, Uint16 image)
 	uint16_t tile_upper = tile_value & TILE_UPPER_MASK;
 
 	// Set the actual image.
+	const bool wasFanOff = _tmem.get(index1D).isFanOff();
 	_tmem.get(index1D)._img = tile_upper | tile_lower;
+	if (wasFanOff != _tmem.get(index1D).isFanOff()) {
+		// Fan-off tiles are ignored by fx tests
+		touch();
+	}
 
 	// Update the pre-computed texture info.
 	return update_texture(index1D);
@@ -389,6 +389,10 @@ public:
     tile_mem_t _tmem;
     mpdfx_lists_t _fxlists;
 
+    /// @brief A number which changes whenever the result of test_fx() might change.
+    /// @remark Unique across all meshes, so caches keyed by it are also invalidated if the mesh is replaced.
+    uint32_t getRevision() const { return _revision; }
+
     Vector3f get_diff(const Vector3f& pos, float radius, float center_pressure, const BIT_FIELD bits);
     float get_pressure(const Vector3f& pos, float radius, const BIT_FIELD bits) const;
 	/// @brief Remove extra ambient light in the lightmap.
@@ -480,6 +484,10 @@ private:
 	/// Set the bounding box for each tile, and for the entire mesh
 	void make_bbox();
 
+    /// @brief Give this mesh a new revision.
+    void touch();
+
+    uint32_t _revision;
 };
 
 /// Some look-up tables for meshes (and independent of the particular mesh).
@@ -1284,7 +1284,7 @@ Uint8 scr_CostTargetItemID( script_state_t& state, ai_state_t& self )
     //need to search inventory as well?
     if (!pitem)
     {
-        for(const std::shared_ptr<Object> &inventoryItem : ptarget->getInventory().iterate())
+        for(const std::shared_ptr<Object> &inventoryItem : ptarget->getInventory().iterate(Ego::Core::FrameArena::update()))
         {
             //matching idsz?
             if ( inventoryItem->getProfile()->hasTypeIDSZ(idsz) ) {
@@ -2967,7 +2967,7 @@ Uint8 scr_RestockTargetAmmoIDAll( script_state_t& state, ai_state_t& self )
     ichr = pself_target->holdingwhich[SLOT_RIGHT];
     iTmp += RestockAmmo( ichr, Interpreter::safeCast<IDSZ2>(state.argument) );
 
-    for(const std::shared_ptr<Object> pitem : pchr->getInventory().iterate())
+    for(const std::shared_ptr<Object>& pitem : pchr->getInventory().iterate(Ego::Core::FrameArena::update()))
     {
         iTmp += RestockAmmo( pitem->getObjRef(), Interpreter::safeCast<IDSZ2>(state.argument) );
     }
@@ -3005,7 +3005,7 @@ Uint8 scr_RestockTargetAmmoIDFirst( script_state_t& state, ai_state_t& self )
 
     if (iTmp == 0)
     {
-        for(const std::shared_ptr<Object> pitem : pchr->getInventory().iterate())
+        for(const std::shared_ptr<Object>& pitem : pchr->getInventory().iterate(Ego::Core::FrameArena::update()))
         {
             iTmp += RestockAmmo( pitem->getObjRef(), Interpreter::safeCast<IDSZ2>(state.argument) );
             if ( 0 != iTmp ) break;
@@ -3704,7 +3704,7 @@ Uint8 scr_IfHoldingRangedWeapon( script_state_t& state, ai_state_t& self )
     }
 
     //50% chance to check left hand even though we have already found one in our right hand
-    if ( !returncode || Random::nextBool() )
+    if ( !returncode || pchr->getRandomStream().nextBool() )
     {
         // Check left hand
         const std::shared_ptr<Object> &leftHandItem = _currentModule->getObjectHandler()[pchr->holdingwhich[SLOT_LEFT]];
@@ -5120,12 +5120,12 @@ Uint8 scr_CorrectActionForHand( script_state_t& state, ai_state_t& self )
         if ( pchr->inwhich_slot == SLOT_LEFT )
         {
             // A or B
-            state.argument += Random::next(1);
+            state.argument += pchr->getRandomStream().next(1);
         }
         else
         {
             // C or D
-            state.argument += 2 + Random::next(1);
+            state.argument += 2 + pchr->getRandomStream().next(1);
         }
     }
 
@@ -5572,7 +5572,7 @@ Uint8 scr_UnkurseTargetInventory( script_state_t& state, ai_state_t& self )
         _currentModule->getObjectHandler().get(ichr)->iskursed = false;
     }
 
-    for(const std::shared_ptr<Object> pitem : pchr->getInventory().iterate())
+    for(const std::shared_ptr<Object>& pitem : pchr->getInventory().iterate(Ego::Core::FrameArena::update()))
     {
         pitem->iskursed = false;
     }
@@ -6420,10 +6420,8 @@ Uint8 scr_DisenchantAll( script_state_t& state, ai_state_t& self )
 
     SCRIPT_FUNCTION_BEGIN();
 
-    for(const std::shared_ptr<Object> &object : _currentModule->getObjectHandler().iterator()) {
-        for(const std::shared_ptr<Ego::Enchantment> &enchant : object->getActiveEnchants()) {
-            enchant->requestTerminate();
-        }
+    for(const std::shared_ptr<Ego::Enchantment> &enchant : _currentModule->getEnchantHandler().getAllEnchantments()) {
+        enchant->requestTerminate();
     }
 
     SCRIPT_FUNCTION_END();
@@ -6715,12 +6713,12 @@ Uint8 scr_SpawnPoofSpeedSpacingDamage( script_state_t& state, ai_state_t& self )
             if(poofParticle) {
 
                 //Add random horizontal velocity offset
-                Vector2f xyVelOffset = Vector2f(velOffsetBase + Random::next(ppip->getSpawnVelocityOffsetXY().rand), velOffsetBase + Random::next(ppip->getSpawnVelocityOffsetXY().rand));
+                Vector2f xyVelOffset = Vector2f(velOffsetBase + pchr->getRandomStream().next(ppip->getSpawnVelocityOffsetXY().rand), velOffsetBase + pchr->getRandomStream().next(ppip->getSpawnVelocityOffsetXY().rand));
                 poofParticle->vel.x() += xyVelOffset.x();
                 poofParticle->vel.y() += xyVelOffset.y();
 
                 //Add random horizontal position offset
-                Vector2f xyPosOffset = Vector2f(posOffsetBase + Random::next(ppip->getSpawnPositionOffsetXY().rand), posOffsetBase + Random::next(ppip->getSpawnPositionOffsetXY().rand));
+                Vector2f xyPosOffset = Vector2f(posOffsetBase + pchr->getRandomStream().next(ppip->getSpawnPositionOffsetXY().rand), posOffsetBase + pchr->getRandomStream().next(ppip->getSpawnPositionOffsetXY().rand));
                 poofParticle->setPosition(poofParticle->getPosX() + xyPosOffset.x(), poofParticle->getPosY() + xyPosOffset.y(), poofParticle->getPosZ());
 
                 //Adjust damage
@@ -7458,7 +7456,8 @@ Uint8 scr_TakePicture( script_state_t& state, ai_state_t& self )
 
     SCRIPT_FUNCTION_BEGIN();
 
-    returncode = _gameEngine->getUIManager()->dumpScreenshot();
+    // A headless run has no screen to take a picture of.
+    returncode = _gameEngine->getUIManager() && _gameEngine->getUIManager()->dumpScreenshot();
 
     SCRIPT_FUNCTION_END();
 }
@@ -31,7 +31,7 @@ int32_t load_VARTMPARGUMENT(script_state_t& scriptState, ai_state_t& aiState, Ob
 
 int32_t load_VARRAND(script_state_t& scriptState, ai_state_t& aiState, Object *pobject, Object *ptarget, Object *powner, Object *pleader)
 {
-    return Random::next(std::numeric_limits<uint16_t>::max());
+    return pobject->getRandomStream().next(std::numeric_limits<uint16_t>::max());
 }
 
 int32_t load_VARSELFX(script_state_t& scriptState, ai_state_t& aiState, Object *pobject, Object *ptarget, Object *powner, Object *pleader)
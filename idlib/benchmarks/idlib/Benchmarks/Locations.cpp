@@ -0,0 +1,39 @@
+//********************************************************************************************
+//*
+//*    This file is part of Egoboo.
+//*
+//*    Egoboo is free software: you can redistribute it and/or modify it
+//*    under the terms of the GNU General Public License as published by
+//*    the Free Software Foundation, either version 3 of the License, or
+//*    (at your option) any later version.
+//*
+//*    Egoboo is distributed in the hope that it will be useful, but
+//*    WITHOUT ANY WARRANTY; without even the implied warranty of
+//*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//*    General Public License for more details.
+//*
+//*    You should have received a copy of the GNU General Public License
+//*    along with Egoboo.  If not, see <http://www.gnu.org/licenses/>.
+//*
+//********************************************************************************************
+
+#include "EgoBench/EgoBench.hpp"
+#include "IdLib/IdLib.hpp"
+
+namespace Id {
+namespace Bench {
+
+EgoBench_BenchCase(Locations) {
+    EgoBench_Bench(copyAndCompare) {
+        Id::Location a("data/modules/adventurer.mod/objects/sword.obj/script.txt", 1);
+        size_t i = 0;
+        while (state.keepRunning()) {
+            Id::Location b("data/modules/adventurer.mod/objects/sword.obj/script.txt", i++);
+            Id::Location c(a);
+            EgoBench::doNotOptimize(b == c);
+        }
+    }
+};
+
+} // namespace Bench
+} // namespace Id